@@ -0,0 +1,951 @@
+/* ==================================== JUCER_BINARY_RESOURCE ====================================
+
+   This is an auto-generated file: Any edits you make may be overwritten!
+
+*/
+
+#include <cstring>
+
+namespace BinaryData
+{
+
+//================== abloop.svg ==================
+static const unsigned char temp_binary_data_0[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,112,97,116,104,32,100,61,34,77,50,32,49,55,46,53,67,50,32,49,54,46,53,54,53,52,32,50,32,49,54,46,48,57,56,49,32,
+50,46,50,48,48,57,54,32,49,53,46,55,53,67,50,46,51,51,50,54,49,32,49,53,46,53,50,50,32,50,46,53,50,49,57,55,32,49,53,46,
+51,51,50,54,32,50,46,55,53,32,49,53,46,50,48,49,67,51,46,48,57,56,48,56,32,49,53,32,51,46,53,54,53,51,56,32,49,53,32,52,
+46,53,32,49,53,67,53,46,52,51,52,54,50,32,49,53,32,53,46,57,48,49,57,50,32,49,53,32,54,46,50,53,32,49,53,46,50,48,49,67,
+54,46,52,55,56,48,51,32,49,53,46,51,51,50,54,32,54,46,54,54,55,51,57,32,49,53,46,53,50,50,32,54,46,55,57,57,48,52,32,49,
+53,46,55,53,67,55,32,49,54,46,48,57,56,49,32,55,32,49,54,46,53,54,53,52,32,55,32,49,55,46,53,67,55,32,49,56,46,52,51,52,
+54,32,55,32,49,56,46,57,48,49,57,32,54,46,55,57,57,48,52,32,49,57,46,50,53,67,54,46,54,54,55,51,57,32,49,57,46,52,55,56,
+32,54,46,52,55,56,48,51,32,49,57,46,54,54,55,52,32,54,46,50,53,32,49,57,46,55,57,57,67,53,46,57,48,49,57,50,32,50,48,32,
+53,46,52,51,52,54,50,32,50,48,32,52,46,53,32,50,48,67,51,46,53,54,53,51,56,32,50,48,32,51,46,48,57,56,48,56,32,50,48,32,
+50,46,55,53,32,49,57,46,55,57,57,67,50,46,53,50,49,57,55,32,49,57,46,54,54,55,52,32,50,46,51,51,50,54,49,32,49,57,46,52,
+55,56,32,50,46,50,48,48,57,54,32,49,57,46,50,53,67,50,32,49,56,46,57,48,49,57,32,50,32,49,56,46,52,51,52,54,32,50,32,49,
+55,46,53,90,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,
+34,47,62,32,60,112,97,116,104,32,100,61,34,77,57,46,53,32,49,55,46,53,67,57,46,53,32,49,54,46,53,54,53,52,32,57,46,53,32,49,
+54,46,48,57,56,49,32,57,46,55,48,48,57,54,32,49,53,46,55,53,67,57,46,56,51,50,54,49,32,49,53,46,53,50,50,32,49,48,46,48,
+50,50,32,49,53,46,51,51,50,54,32,49,48,46,50,53,32,49,53,46,50,48,49,67,49,48,46,53,57,56,49,32,49,53,32,49,49,46,48,54,
+53,52,32,49,53,32,49,50,32,49,53,67,49,50,46,57,51,52,54,32,49,53,32,49,51,46,52,48,49,57,32,49,53,32,49,51,46,55,53,32,
+49,53,46,50,48,49,67,49,51,46,57,55,56,32,49,53,46,51,51,50,54,32,49,52,46,49,54,55,52,32,49,53,46,53,50,50,32,49,52,46,
+50,57,57,32,49,53,46,55,53,67,49,52,46,53,32,49,54,46,48,57,56,49,32,49,52,46,53,32,49,54,46,53,54,53,52,32,49,52,46,53,
+32,49,55,46,53,67,49,52,46,53,32,49,56,46,52,51,52,54,32,49,52,46,53,32,49,56,46,57,48,49,57,32,49,52,46,50,57,57,32,49,
+57,46,50,53,67,49,52,46,49,54,55,52,32,49,57,46,52,55,56,32,49,51,46,57,55,56,32,49,57,46,54,54,55,52,32,49,51,46,55,53,
+32,49,57,46,55,57,57,67,49,51,46,52,48,49,57,32,50,48,32,49,50,46,57,51,52,54,32,50,48,32,49,50,32,50,48,67,49,49,46,48,
+54,53,52,32,50,48,32,49,48,46,53,57,56,49,32,50,48,32,49,48,46,50,53,32,49,57,46,55,57,57,67,49,48,46,48,50,50,32,49,57,
+46,54,54,55,52,32,57,46,56,51,50,54,49,32,49,57,46,52,55,56,32,57,46,55,48,48,57,54,32,49,57,46,50,53,67,57,46,53,32,49,
+56,46,57,48,49,57,32,57,46,53,32,49,56,46,52,51,52,54,32,57,46,53,32,49,55,46,53,90,34,32,115,116,114,111,107,101,61,34,35,70,
+69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,47,62,32,60,112,97,116,104,32,100,61,34,77,49,55,
+32,49,55,46,53,67,49,55,32,49,54,46,53,54,53,52,32,49,55,32,49,54,46,48,57,56,49,32,49,55,46,50,48,49,32,49,53,46,55,53,
+67,49,55,46,51,51,50,54,32,49,53,46,53,50,50,32,49,55,46,53,50,50,32,49,53,46,51,51,50,54,32,49,55,46,55,53,32,49,53,46,
+50,48,49,67,49,56,46,48,57,56,49,32,49,53,32,49,56,46,53,54,53,52,32,49,53,32,49,57,46,53,32,49,53,67,50,48,46,52,51,52,
+54,32,49,53,32,50,48,46,57,48,49,57,32,49,53,32,50,49,46,50,53,32,49,53,46,50,48,49,67,50,49,46,52,55,56,32,49,53,46,51,
+51,50,54,32,50,49,46,54,54,55,52,32,49,53,46,53,50,50,32,50,49,46,55,57,57,32,49,53,46,55,53,67,50,50,32,49,54,46,48,57,
+56,49,32,50,50,32,49,54,46,53,54,53,52,32,50,50,32,49,55,46,53,67,50,50,32,49,56,46,52,51,52,54,32,50,50,32,49,56,46,57,
+48,49,57,32,50,49,46,55,57,57,32,49,57,46,50,53,67,50,49,46,54,54,55,52,32,49,57,46,52,55,56,32,50,49,46,52,55,56,32,49,
+57,46,54,54,55,52,32,50,49,46,50,53,32,49,57,46,55,57,57,67,50,48,46,57,48,49,57,32,50,48,32,50,48,46,52,51,52,54,32,50,
+48,32,49,57,46,53,32,50,48,67,49,56,46,53,54,53,52,32,50,48,32,49,56,46,48,57,56,49,32,50,48,32,49,55,46,55,53,32,49,57,
+46,55,57,57,67,49,55,46,53,50,50,32,49,57,46,54,54,55,52,32,49,55,46,51,51,50,54,32,49,57,46,52,55,56,32,49,55,46,50,48,
+49,32,49,57,46,50,53,67,49,55,32,49,56,46,57,48,49,57,32,49,55,32,49,56,46,52,51,52,54,32,49,55,32,49,55,46,53,90,34,32,
+115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,47,62,32,60,112,
+97,116,104,32,100,61,34,77,52,46,53,32,49,53,86,57,67,52,46,53,32,54,46,54,52,50,57,56,32,52,46,53,32,53,46,52,54,52,52,55,
+32,53,46,50,51,50,50,51,32,52,46,55,51,50,50,51,67,53,46,57,54,52,52,55,32,52,32,55,46,49,52,50,57,56,32,52,32,57,46,53,
+32,52,72,49,48,46,53,77,49,52,46,53,32,52,67,49,54,46,56,53,55,32,52,32,49,56,46,48,51,53,53,32,52,32,49,56,46,55,54,55,
+56,32,52,46,55,51,50,50,51,67,49,57,46,53,32,53,46,52,54,52,52,55,32,49,57,46,53,32,54,46,54,52,50,57,56,32,49,57,46,53,
+32,57,86,49,50,77,49,57,46,53,32,49,50,76,50,49,46,53,32,49,48,77,49,57,46,53,32,49,50,76,49,55,46,53,32,49,48,34,32,115,
+116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,
+101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,
+34,47,62,32,60,47,103,62,10,13,60,47,115,118,103,62,0 };
+
+const char* abloop_svg = (const char*) temp_binary_data_0;
+
+
+//================== backward.svg ==================
+static const unsigned char temp_binary_data_1[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,112,97,116,104,32,100,61,34,77,55,46,53,32,49,48,46,53,76,49,48,32,56,46,53,86,49,53,46,53,34,32,115,116,114,111,107,
+101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,
+110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,47,62,32,
+60,112,97,116,104,32,100,61,34,77,49,50,46,53,32,49,51,46,55,53,86,49,48,46,50,53,67,49,50,46,53,32,57,46,50,56,51,53,32,49,
+51,46,50,56,51,53,32,56,46,53,32,49,52,46,50,53,32,56,46,53,67,49,53,46,50,49,54,53,32,56,46,53,32,49,54,32,57,46,50,56,
+51,53,32,49,54,32,49,48,46,50,53,86,49,51,46,55,53,67,49,54,32,49,52,46,55,49,54,53,32,49,53,46,50,49,54,53,32,49,53,46,
+53,32,49,52,46,50,53,32,49,53,46,53,67,49,51,46,50,56,51,53,32,49,53,46,53,32,49,50,46,53,32,49,52,46,55,49,54,53,32,49,
+50,46,53,32,49,51,46,55,53,90,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,
+104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,32,60,112,97,116,104,32,100,
+61,34,77,49,52,32,52,46,53,76,49,50,32,50,67,49,55,46,53,50,50,56,32,50,32,50,50,32,54,46,52,55,55,49,53,32,50,50,32,49,
+50,67,50,50,32,49,55,46,53,50,50,56,32,49,55,46,53,50,50,56,32,50,50,32,49,50,32,50,50,67,56,46,55,50,56,56,32,50,50,32,
+53,46,56,50,52,52,54,32,50,48,46,52,50,57,51,32,52,32,49,56,46,48,48,49,77,56,32,50,46,56,51,50,48,57,67,54,46,56,55,55,
+53,52,32,51,46,51,50,50,53,49,32,53,46,56,54,50,53,49,32,52,46,48,49,51,48,51,32,53,32,52,46,56,53,56,53,55,67,51,46,49,
+52,56,54,52,32,54,46,54,55,51,52,57,32,50,32,57,46,50,48,50,54,49,32,50,32,49,50,67,50,32,49,50,46,54,56,52,57,32,50,46,
+48,54,56,56,54,32,49,51,46,51,53,51,56,32,50,46,50,48,48,48,52,32,49,52,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,
+53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,
+117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,47,62,32,60,47,103,62,10,13,60,47,115,
+118,103,62,0 };
+
+const char* backward_svg = (const char*) temp_binary_data_1;
+
+
+//================== endsong.svg ==================
+static const unsigned char temp_binary_data_2[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,112,97,116,104,32,100,61,34,77,50,32,49,49,76,50,32,49,56,46,57,54,55,49,67,50,32,50,49,46,50,55,54,51,32,52,46,
+49,51,52,49,57,32,50,50,46,55,51,54,32,53,46,56,55,48,56,51,32,50,49,46,54,49,52,53,76,49,54,46,54,53,57,56,32,49,52,46,
+54,52,55,52,67,49,56,46,52,52,54,55,32,49,51,46,52,57,51,53,32,49,56,46,52,52,54,55,32,49,48,46,53,48,54,53,32,49,54,46,
+54,53,57,56,32,57,46,51,53,50,53,56,76,53,46,56,55,48,56,52,32,50,46,51,56,53,52,56,67,52,46,49,51,52,49,57,32,49,46,50,
+54,52,48,50,32,50,32,50,46,55,50,51,54,56,32,50,32,53,46,48,51,50,56,57,86,55,34,32,115,116,114,111,107,101,61,34,35,70,69,69,
+55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,
+114,111,117,110,100,34,47,62,32,60,112,97,116,104,32,100,61,34,77,50,50,32,53,86,49,50,77,50,50,32,49,54,86,49,57,34,32,115,116,114,
+111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,
+108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,32,60,47,103,62,10,13,60,47,115,118,103,62,0 };
+
+const char* endsong_svg = (const char*) temp_binary_data_2;
+
+
+//================== forward.svg ==================
+static const unsigned char temp_binary_data_3[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,112,97,116,104,32,100,61,34,77,55,46,53,32,49,48,46,53,76,49,48,32,56,46,53,86,49,53,46,53,34,32,115,116,114,111,107,
+101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,
+110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,47,62,32,
+60,112,97,116,104,32,100,61,34,77,49,50,46,53,32,49,51,46,55,53,86,49,48,46,50,53,67,49,50,46,53,32,57,46,50,56,51,53,32,49,
+51,46,50,56,51,53,32,56,46,53,32,49,52,46,50,53,32,56,46,53,67,49,53,46,50,49,54,53,32,56,46,53,32,49,54,32,57,46,50,56,
+51,53,32,49,54,32,49,48,46,50,53,86,49,51,46,55,53,67,49,54,32,49,52,46,55,49,54,53,32,49,53,46,50,49,54,53,32,49,53,46,
+53,32,49,52,46,50,53,32,49,53,46,53,67,49,51,46,50,56,51,53,32,49,53,46,53,32,49,50,46,53,32,49,52,46,55,49,54,53,32,49,
+50,46,53,32,49,51,46,55,53,90,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,
+104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,32,60,112,97,116,104,32,100,
+61,34,77,49,48,32,52,46,53,76,49,50,32,50,67,54,46,52,55,55,49,53,32,50,32,50,32,54,46,52,55,55,49,53,32,50,32,49,50,67,
+50,32,49,50,46,54,56,52,57,32,50,46,48,54,56,56,54,32,49,51,46,51,53,51,56,32,50,46,50,48,48,48,52,32,49,52,77,49,54,32,
+50,46,56,51,50,48,57,67,49,57,46,53,51,49,56,32,52,46,51,55,53,50,32,50,50,32,55,46,56,57,57,51,54,32,50,50,32,49,50,67,
+50,50,32,49,55,46,53,50,50,56,32,49,55,46,53,50,50,56,32,50,50,32,49,50,32,50,50,67,56,46,55,50,56,53,50,32,50,50,32,53,
+46,56,50,52,52,51,32,50,48,46,52,50,56,55,32,52,32,49,56,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,
+114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,
+115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,47,62,32,60,47,103,62,10,13,60,47,115,118,103,62,0 };
+
+const char* forward_svg = (const char*) temp_binary_data_3;
+
+
+//================== loop.svg ==================
+static const unsigned char temp_binary_data_4[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,112,97,116,104,32,100,61,34,77,51,46,54,55,57,56,49,32,49,49,46,51,51,51,51,72,50,46,57,50,57,56,49,72,51,46,54,
+55,57,56,49,90,77,51,46,54,55,57,56,49,32,49,51,76,51,46,49,53,49,53,55,32,49,51,46,53,51,50,52,67,51,46,52,52,51,57,56,
+32,49,51,46,56,50,50,53,32,51,46,57,49,53,54,53,32,49,51,46,56,50,50,53,32,52,46,50,48,56,48,53,32,49,51,46,53,51,50,52,
+76,51,46,54,55,57,56,49,32,49,51,90,77,53,46,56,56,55,56,55,32,49,49,46,56,54,53,55,67,54,46,49,56,49,57,49,32,49,49,46,
+53,55,52,32,54,46,49,56,51,55,55,32,49,49,46,48,57,57,49,32,53,46,56,57,50,48,51,32,49,48,46,56,48,53,49,67,53,46,54,48,
+48,50,57,32,49,48,46,53,49,49,32,53,46,49,50,53,52,50,32,49,48,46,53,48,57,50,32,52,46,56,51,49,51,56,32,49,48,46,56,48,
+48,57,76,53,46,56,56,55,56,55,32,49,49,46,56,54,53,55,90,77,50,46,53,50,56,50,52,32,49,48,46,56,48,48,57,67,50,46,50,51,
+52,50,32,49,48,46,53,48,57,50,32,49,46,55,53,57,51,51,32,49,48,46,53,49,49,32,49,46,52,54,55,53,57,32,49,48,46,56,48,53,
+49,67,49,46,49,55,53,56,53,32,49,49,46,48,57,57,49,32,49,46,49,55,55,55,50,32,49,49,46,53,55,52,32,49,46,52,55,49,55,54,
+32,49,49,46,56,54,53,55,76,50,46,53,50,56,50,52,32,49,48,46,56,48,48,57,90,77,49,56,46,54,49,53,54,32,55,46,51,57,50,55,
+57,67,49,56,46,56,51,50,53,32,55,46,55,52,53,54,53,32,49,57,46,50,57,52,52,32,55,46,56,53,53,56,53,32,49,57,46,54,52,55,
+51,32,55,46,54,51,56,57,50,67,50,48,46,48,48,48,49,32,55,46,52,50,49,57,57,32,50,48,46,49,49,48,51,32,54,46,57,54,48,48,
+55,32,49,57,46,56,57,51,52,32,54,46,54,48,55,50,49,76,49,56,46,54,49,53,54,32,55,46,51,57,50,55,57,90,77,49,54,46,56,57,
+51,49,32,51,46,54,48,55,56,55,67,49,54,46,53,52,48,51,32,51,46,51,57,48,55,55,32,49,54,46,48,55,56,52,32,51,46,53,48,48,
+55,52,32,49,53,46,56,54,49,51,32,51,46,56,53,51,53,67,49,53,46,54,52,52,50,32,52,46,50,48,54,50,54,32,49,53,46,55,53,52,
+49,32,52,46,54,54,56,50,50,32,49,54,46,49,48,54,57,32,52,46,56,56,53,51,50,76,49,54,46,56,57,51,49,32,51,46,54,48,55,56,
+55,90,77,49,50,46,52,54,51,51,32,51,46,55,53,57,51,57,67,49,50,46,56,55,55,32,51,46,55,55,57,54,54,32,49,51,46,50,50,56,
+56,32,51,46,52,54,48,55,49,32,49,51,46,50,52,57,49,32,51,46,48,52,55,67,49,51,46,50,54,57,52,32,50,46,54,51,51,50,56,32,
+49,50,46,57,53,48,52,32,50,46,50,56,49,52,54,32,49,50,46,53,51,54,55,32,50,46,50,54,49,49,57,76,49,50,46,52,54,51,51,32,
+51,46,55,53,57,51,57,90,77,49,50,46,48,55,56,57,32,50,46,50,53,67,55,46,48,51,49,53,53,32,50,46,50,53,32,50,46,57,50,57,
+56,49,32,54,46,51,49,49,50,32,50,46,57,50,57,56,49,32,49,49,46,51,51,51,51,72,52,46,52,50,57,56,49,67,52,46,52,50,57,56,
+49,32,55,46,49,53,48,55,50,32,55,46,56,52,56,56,52,32,51,46,55,53,32,49,50,46,48,55,56,57,32,51,46,55,53,86,50,46,50,53,
+90,77,50,46,57,50,57,56,49,32,49,49,46,51,51,51,51,76,50,46,57,50,57,56,49,32,49,51,72,52,46,52,50,57,56,49,76,52,46,52,
+50,57,56,49,32,49,49,46,51,51,51,51,72,50,46,57,50,57,56,49,90,77,52,46,50,48,56,48,53,32,49,51,46,53,51,50,52,76,53,46,
+56,56,55,56,55,32,49,49,46,56,54,53,55,76,52,46,56,51,49,51,56,32,49,48,46,56,48,48,57,76,51,46,49,53,49,53,55,32,49,50,
+46,52,54,55,54,76,52,46,50,48,56,48,53,32,49,51,46,53,51,50,52,90,77,52,46,50,48,56,48,53,32,49,50,46,52,54,55,54,76,50,
+46,53,50,56,50,52,32,49,48,46,56,48,48,57,76,49,46,52,55,49,55,54,32,49,49,46,56,54,53,55,76,51,46,49,53,49,53,55,32,49,
+51,46,53,51,50,52,76,52,46,50,48,56,48,53,32,49,50,46,52,54,55,54,90,77,49,57,46,56,57,51,52,32,54,46,54,48,55,50,49,67,
+49,57,46,49,52,52,49,32,53,46,51,56,56,52,54,32,49,56,46,49,49,52,51,32,52,46,51,53,57,52,49,32,49,54,46,56,57,51,49,32,
+51,46,54,48,55,56,55,76,49,54,46,49,48,54,57,32,52,46,56,56,53,51,50,67,49,55,46,49,50,56,55,32,53,46,53,49,52,49,57,32,
+49,55,46,57,56,57,57,32,54,46,51,55,53,48,54,32,49,56,46,54,49,53,54,32,55,46,51,57,50,55,57,76,49,57,46,56,57,51,52,32,
+54,46,54,48,55,50,49,90,77,49,50,46,53,51,54,55,32,50,46,50,54,49,49,57,67,49,50,46,51,56,53,32,50,46,50,53,51,55,54,32,
+49,50,46,50,51,50,51,32,50,46,50,53,32,49,50,46,48,55,56,57,32,50,46,50,53,86,51,46,55,53,67,49,50,46,50,48,55,56,32,51,
+46,55,53,32,49,50,46,51,51,54,32,51,46,55,53,51,49,54,32,49,50,46,52,54,51,51,32,51,46,55,53,57,51,57,76,49,50,46,53,51,
+54,55,32,50,46,50,54,49,49,57,90,34,32,102,105,108,108,61,34,35,70,69,69,55,49,53,34,47,62,32,60,112,97,116,104,32,100,61,34,77,
+49,49,46,56,56,50,53,32,50,49,86,50,49,46,55,53,86,50,49,90,77,50,48,46,51,49,51,55,32,49,50,46,54,54,54,55,72,50,49,46,
+48,54,51,55,72,50,48,46,51,49,51,55,90,77,50,48,46,51,49,51,55,32,49,49,76,50,48,46,56,52,48,57,32,49,48,46,52,54,54,54,
+67,50,48,46,53,52,56,55,32,49,48,46,49,55,55,56,32,50,48,46,48,55,56,54,32,49,48,46,49,55,55,56,32,49,57,46,55,56,54,52,
+32,49,48,46,52,54,54,54,76,50,48,46,51,49,51,55,32,49,49,90,77,49,56,46,49,48,48,50,32,49,50,46,49,51,51,51,67,49,55,46,
+56,48,53,54,32,49,50,46,52,50,52,52,32,49,55,46,56,48,50,56,32,49,50,46,56,57,57,51,32,49,56,46,48,57,52,32,49,51,46,49,
+57,51,57,67,49,56,46,51,56,53,50,32,49,51,46,52,56,56,53,32,49,56,46,56,54,32,49,51,46,52,57,49,51,32,49,57,46,49,53,52,
+54,32,49,51,46,50,48,48,49,76,49,56,46,49,48,48,50,32,49,50,46,49,51,51,51,90,77,50,49,46,52,55,50,55,32,49,51,46,50,48,
+48,49,67,50,49,46,55,54,55,51,32,49,51,46,52,57,49,51,32,50,50,46,50,52,50,49,32,49,51,46,52,56,56,53,32,50,50,46,53,51,
+51,51,32,49,51,46,49,57,51,57,67,50,50,46,56,50,52,53,32,49,50,46,56,57,57,51,32,50,50,46,56,50,49,55,32,49,50,46,52,50,
+52,52,32,50,50,46,53,50,55,49,32,49,50,46,49,51,51,50,76,50,49,46,52,55,50,55,32,49,51,46,50,48,48,49,90,77,53,46,51,49,
+55,54,57,32,49,54,46,54,48,54,49,67,53,46,49,48,48,49,54,32,49,54,46,50,53,51,54,32,52,46,54,51,56,48,54,32,49,54,46,49,
+52,52,50,32,52,46,50,56,53,53,55,32,49,54,46,51,54,49,56,67,51,46,57,51,51,48,55,32,49,54,46,53,55,57,51,32,51,46,56,50,
+51,54,54,32,49,55,46,48,52,49,52,32,52,46,48,52,49,50,32,49,55,46,51,57,51,57,76,53,46,51,49,55,54,57,32,49,54,46,54,48,
+54,49,90,77,49,49,46,53,51,51,49,32,50,48,46,50,52,50,51,67,49,49,46,49,49,57,51,32,50,48,46,50,50,52,32,49,48,46,55,54,
+57,32,50,48,46,53,52,52,55,32,49,48,46,55,53,48,55,32,50,48,46,57,53,56,53,67,49,48,46,55,51,50,53,32,50,49,46,51,55,50,
+51,32,49,49,46,48,53,51,49,32,50,49,46,55,50,50,54,32,49,49,46,52,54,54,57,32,50,49,46,55,52,48,56,76,49,49,46,53,51,51,
+49,32,50,48,46,50,52,50,51,90,77,55,46,49,49,50,57,50,32,50,48,46,52,50,57,54,67,55,46,52,54,55,55,32,50,48,46,54,52,51,
+51,32,55,46,57,50,56,54,49,32,50,48,46,53,50,57,32,56,46,49,52,50,51,57,32,50,48,46,49,55,52,50,67,56,46,51,53,54,49,55,
+32,49,57,46,56,49,57,53,32,56,46,50,52,49,56,54,32,49,57,46,51,53,56,54,32,55,46,56,56,55,48,56,32,49,57,46,49,52,52,56,
+76,55,46,49,49,50,57,50,32,50,48,46,52,50,57,54,90,77,49,49,46,56,56,50,53,32,50,49,46,55,53,67,49,54,46,57,52,52,56,32,
+50,49,46,55,53,32,50,49,46,48,54,51,55,32,49,55,46,54,57,49,53,32,50,49,46,48,54,51,55,32,49,50,46,54,54,54,55,72,49,57,
+46,53,54,51,55,67,49,57,46,53,54,51,55,32,49,54,46,56,52,54,54,32,49,54,46,49,51,51,32,50,48,46,50,53,32,49,49,46,56,56,
+50,53,32,50,48,46,50,53,86,50,49,46,55,53,90,77,50,49,46,48,54,51,55,32,49,50,46,54,54,54,55,86,49,49,72,49,57,46,53,54,
+51,55,86,49,50,46,54,54,54,55,72,50,49,46,48,54,51,55,90,77,49,57,46,55,56,54,52,32,49,48,46,52,54,54,54,76,49,56,46,49,
+48,48,50,32,49,50,46,49,51,51,51,76,49,57,46,49,53,52,54,32,49,51,46,50,48,48,49,76,50,48,46,56,52,48,57,32,49,49,46,53,
+51,51,52,76,49,57,46,55,56,54,52,32,49,48,46,52,54,54,54,90,77,49,57,46,55,56,54,52,32,49,49,46,53,51,51,52,76,50,49,46,
+52,55,50,55,32,49,51,46,50,48,48,49,76,50,50,46,53,50,55,49,32,49,50,46,49,51,51,50,76,50,48,46,56,52,48,57,32,49,48,46,
+52,54,54,54,76,49,57,46,55,56,54,52,32,49,49,46,53,51,51,52,90,77,49,49,46,52,54,54,57,32,50,49,46,55,52,48,56,67,49,49,
+46,54,48,52,55,32,50,49,46,55,52,54,57,32,49,49,46,55,52,51,51,32,50,49,46,55,53,32,49,49,46,56,56,50,53,32,50,49,46,55,
+53,86,50,48,46,50,53,67,49,49,46,55,54,53,51,32,50,48,46,50,53,32,49,49,46,54,52,56,56,32,50,48,46,50,52,55,52,32,49,49,
+46,53,51,51,49,32,50,48,46,50,52,50,51,76,49,49,46,52,54,54,57,32,50,49,46,55,52,48,56,90,77,52,46,48,52,49,50,32,49,55,
+46,51,57,51,57,67,52,46,56,48,53,54,57,32,49,56,46,54,51,50,55,32,53,46,56,54,49,48,54,32,49,57,46,54,55,53,50,32,55,46,
+49,49,50,57,50,32,50,48,46,52,50,57,54,76,55,46,56,56,55,48,56,32,49,57,46,49,52,52,56,67,54,46,56,51,56,55,50,32,49,56,
+46,53,49,51,49,32,53,46,57,53,54,48,50,32,49,55,46,54,52,48,53,32,53,46,51,49,55,54,57,32,49,54,46,54,48,54,49,76,52,46,
+48,52,49,50,32,49,55,46,51,57,51,57,90,34,32,102,105,108,108,61,34,35,70,69,69,55,49,53,34,47,62,32,60,47,103,62,10,13,60,47,
+115,118,103,62,0 };
+
+const char* loop_svg = (const char*) temp_binary_data_4;
+
+
+//================== marker.svg ==================
+static const unsigned char temp_binary_data_5[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,112,97,116,104,32,100,61,34,77,49,54,46,57,55,56,53,32,50,49,46,53,51,54,49,67,49,53,46,53,49,50,53,32,50,49,46,
+56,51,49,50,32,49,51,46,56,49,50,54,32,50,50,32,49,50,32,50,50,67,54,46,52,55,55,49,53,32,50,50,32,50,32,50,48,46,52,51,
+51,32,50,32,49,56,46,53,67,50,32,49,54,46,53,54,55,32,54,46,52,55,55,49,53,32,49,53,32,49,50,32,49,53,67,49,55,46,53,50,
+50,56,32,49,53,32,50,50,32,49,54,46,53,54,55,32,50,50,32,49,56,46,53,67,50,50,32,49,57,46,48,52,55,54,32,50,49,46,54,52,
+48,55,32,49,57,46,53,54,53,57,32,50,49,32,50,48,46,48,50,55,52,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,
+115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,
+34,47,62,32,60,112,97,116,104,32,100,61,34,77,49,50,32,49,56,86,50,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,
+115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,
+34,47,62,32,60,112,97,116,104,32,100,61,34,77,49,49,46,57,57,57,56,32,51,46,53,76,49,55,46,52,50,50,49,32,54,46,50,49,49,49,
+52,67,49,56,46,57,56,51,50,32,54,46,57,57,49,54,57,32,49,57,46,55,54,51,56,32,55,46,51,56,49,57,54,32,49,57,46,55,54,51,
+56,32,56,67,49,57,46,55,54,51,56,32,56,46,54,49,56,48,52,32,49,56,46,57,56,51,50,32,57,46,48,48,56,51,49,32,49,55,46,52,
+50,50,49,32,57,46,55,56,56,56,54,76,49,49,46,57,57,57,56,32,49,50,46,53,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,
+53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,
+117,110,100,34,47,62,32,60,47,103,62,10,13,60,47,115,118,103,62,0 };
+
+const char* marker_svg = (const char*) temp_binary_data_5;
+
+
+//================== mixer.svg ==================
+static const unsigned char temp_binary_data_6[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,112,97,116,104,32,100,61,34,77,50,32,49,54,46,50,53,67,49,46,53,56,53,55,57,32,49,54,46,50,53,32,49,46,50,53,32,
+49,54,46,53,56,53,56,32,49,46,50,53,32,49,55,67,49,46,50,53,32,49,55,46,52,49,52,50,32,49,46,53,56,53,55,57,32,49,55,46,
+55,53,32,50,32,49,55,46,55,53,86,49,54,46,50,53,90,77,53,46,54,48,50,56,54,32,49,55,46,55,53,67,54,46,48,49,55,48,55,32,
+49,55,46,55,53,32,54,46,51,53,50,56,54,32,49,55,46,52,49,52,50,32,54,46,51,53,50,56,54,32,49,55,67,54,46,51,53,50,56,54,
+32,49,54,46,53,56,53,56,32,54,46,48,49,55,48,55,32,49,54,46,50,53,32,53,46,54,48,50,56,54,32,49,54,46,50,53,86,49,55,46,
+55,53,90,77,49,48,46,55,52,55,56,32,49,52,46,48,56,55,76,49,48,46,49,48,52,55,32,49,51,46,55,48,49,49,76,49,48,46,55,52,
+55,56,32,49,52,46,48,56,55,90,77,49,51,46,50,53,50,50,32,57,46,57,49,51,48,51,76,49,51,46,56,57,53,51,32,49,48,46,50,57,
+56,57,76,49,51,46,50,53,50,50,32,57,46,57,49,51,48,51,90,77,50,50,32,55,76,50,50,46,53,51,48,51,32,55,46,53,51,48,51,51,
+67,50,50,46,56,50,51,50,32,55,46,50,51,55,52,52,32,50,50,46,56,50,51,50,32,54,46,55,54,50,53,54,32,50,50,46,53,51,48,51,
+32,54,46,52,54,57,54,55,76,50,50,32,55,90,77,49,57,46,52,54,57,55,32,56,46,52,54,57,54,55,67,49,57,46,49,55,54,56,32,56,
+46,55,54,50,53,54,32,49,57,46,49,55,54,56,32,57,46,50,51,55,52,52,32,49,57,46,52,54,57,55,32,57,46,53,51,48,51,51,67,49,
+57,46,55,54,50,54,32,57,46,56,50,51,50,50,32,50,48,46,50,51,55,52,32,57,46,56,50,51,50,50,32,50,48,46,53,51,48,51,32,57,
+46,53,51,48,51,51,76,49,57,46,52,54,57,55,32,56,46,52,54,57,54,55,90,77,50,48,46,53,51,48,51,32,52,46,52,54,57,54,55,67,
+50,48,46,50,51,55,52,32,52,46,49,55,54,55,56,32,49,57,46,55,54,50,54,32,52,46,49,55,54,55,56,32,49,57,46,52,54,57,55,32,
+52,46,52,54,57,54,55,67,49,57,46,49,55,54,56,32,52,46,55,54,50,53,54,32,49,57,46,49,55,54,56,32,53,46,50,51,55,52,52,32,
+49,57,46,52,54,57,55,32,53,46,53,51,48,51,51,76,50,48,46,53,51,48,51,32,52,46,52,54,57,54,55,90,77,49,53,46,50,50,48,53,
+32,55,46,51,56,57,52,76,49,52,46,56,53,49,32,54,46,55,51,54,55,53,86,54,46,55,51,54,55,53,76,49,53,46,50,50,48,53,32,55,
+46,51,56,57,52,90,77,56,46,55,50,48,51,49,32,49,53,46,55,50,55,54,67,56,46,52,49,55,54,53,32,49,54,46,48,49,48,51,32,56,
+46,52,48,49,53,52,32,49,54,46,52,56,52,57,32,56,46,54,56,52,51,50,32,49,54,46,55,56,55,54,67,56,46,57,54,55,49,49,32,49,
+55,46,48,57,48,51,32,57,46,52,52,49,55,49,32,49,55,46,49,48,54,52,32,57,46,55,52,52,51,55,32,49,54,46,56,50,51,54,76,56,
+46,55,50,48,51,49,32,49,53,46,55,50,55,54,90,77,50,32,49,55,46,55,53,72,53,46,54,48,50,56,54,86,49,54,46,50,53,72,50,86,
+49,55,46,55,53,90,77,49,49,46,51,57,48,57,32,49,52,46,52,55,50,56,76,49,51,46,56,57,53,51,32,49,48,46,50,57,56,57,76,49,
+50,46,54,48,57,49,32,57,46,53,50,55,49,54,76,49,48,46,49,48,52,55,32,49,51,46,55,48,49,49,76,49,49,46,51,57,48,57,32,49,
+52,46,52,55,50,56,90,77,49,56,46,51,57,55,49,32,55,46,55,53,72,50,50,86,54,46,50,53,72,49,56,46,51,57,55,49,86,55,46,55,
+53,90,77,50,49,46,52,54,57,55,32,54,46,52,54,57,54,55,76,49,57,46,52,54,57,55,32,56,46,52,54,57,54,55,76,50,48,46,53,51,
+48,51,32,57,46,53,51,48,51,51,76,50,50,46,53,51,48,51,32,55,46,53,51,48,51,51,76,50,49,46,52,54,57,55,32,54,46,52,54,57,
+54,55,90,77,50,50,46,53,51,48,51,32,54,46,52,54,57,54,55,76,50,48,46,53,51,48,51,32,52,46,52,54,57,54,55,76,49,57,46,52,
+54,57,55,32,53,46,53,51,48,51,51,76,50,49,46,52,54,57,55,32,55,46,53,51,48,51,51,76,50,50,46,53,51,48,51,32,54,46,52,54,
+57,54,55,90,77,49,51,46,56,57,53,51,32,49,48,46,50,57,56,57,67,49,52,46,51,50,57,53,32,57,46,53,55,53,49,56,32,49,52,46,
+54,50,56,54,32,57,46,48,55,56,51,52,32,49,52,46,57,48,49,51,32,56,46,55,48,57,57,54,67,49,53,46,49,54,52,52,32,56,46,51,
+53,52,54,52,32,49,53,46,51,54,57,50,32,56,46,49,54,55,48,55,32,49,53,46,53,57,32,56,46,48,52,50,48,53,76,49,52,46,56,53,
+49,32,54,46,55,51,54,55,53,67,49,52,46,51,56,52,32,55,46,48,48,49,49,51,32,49,52,46,48,51,49,53,32,55,46,51,54,51,57,55,
+32,49,51,46,54,57,53,56,32,55,46,56,49,55,52,67,49,51,46,51,54,57,55,32,56,46,50,53,55,55,56,32,49,51,46,48,50,56,53,32,
+56,46,56,50,56,48,54,32,49,50,46,54,48,57,49,32,57,46,53,50,55,49,54,76,49,51,46,56,57,53,51,32,49,48,46,50,57,56,57,90,
+77,49,56,46,51,57,55,49,32,54,46,50,53,67,49,55,46,53,56,49,57,32,54,46,50,53,32,49,54,46,57,49,55,51,32,54,46,50,52,57,
+49,56,32,49,54,46,51,55,49,57,32,54,46,51,48,50,49,57,67,49,53,46,56,49,48,52,32,54,46,51,53,54,55,55,32,49,53,46,51,49,
+55,57,32,54,46,52,55,50,51,55,32,49,52,46,56,53,49,32,54,46,55,51,54,55,53,76,49,53,46,53,57,32,56,46,48,52,50,48,53,67,
+49,53,46,56,49,48,56,32,55,46,57,49,55,48,51,32,49,54,46,48,55,55,32,55,46,56,51,55,57,51,32,49,54,46,53,49,55,32,55,46,
+55,57,53,49,54,67,49,54,46,57,55,51,51,32,55,46,55,53,48,56,50,32,49,55,46,53,53,51,49,32,55,46,55,53,32,49,56,46,51,57,
+55,49,32,55,46,55,53,86,54,46,50,53,90,77,49,48,46,49,48,52,55,32,49,51,46,55,48,49,49,67,57,46,52,50,55,55,52,32,49,52,
+46,56,50,57,52,32,57,46,48,56,52,57,50,32,49,53,46,51,56,54,57,32,56,46,55,50,48,51,49,32,49,53,46,55,50,55,54,76,57,46,
+55,52,52,51,55,32,49,54,46,56,50,51,54,67,49,48,46,51,48,48,54,32,49,54,46,51,48,51,56,32,49,48,46,55,54,51,57,32,49,53,
+46,53,49,56,32,49,49,46,51,57,48,57,32,49,52,46,52,55,50,56,76,49,48,46,49,48,52,55,32,49,51,46,55,48,49,49,90,34,32,102,
+105,108,108,61,34,35,70,69,69,55,49,53,34,47,62,32,60,112,97,116,104,32,100,61,34,77,50,32,54,46,50,53,67,49,46,53,56,53,55,57,
+32,54,46,50,53,32,49,46,50,53,32,54,46,53,56,53,55,57,32,49,46,50,53,32,55,67,49,46,50,53,32,55,46,52,49,52,50,49,32,49,
+46,53,56,53,55,57,32,55,46,55,53,32,50,32,55,46,55,53,86,54,46,50,53,90,77,50,50,32,49,55,76,50,50,46,53,51,48,51,32,49,
+55,46,53,51,48,51,67,50,50,46,56,50,51,50,32,49,55,46,50,51,55,52,32,50,50,46,56,50,51,50,32,49,54,46,55,54,50,54,32,50,
+50,46,53,51,48,51,32,49,54,46,52,54,57,55,76,50,50,32,49,55,90,77,50,48,46,53,51,48,51,32,49,52,46,52,54,57,55,67,50,48,
+46,50,51,55,52,32,49,52,46,49,55,54,56,32,49,57,46,55,54,50,54,32,49,52,46,49,55,54,56,32,49,57,46,52,54,57,55,32,49,52,
+46,52,54,57,55,67,49,57,46,49,55,54,56,32,49,52,46,55,54,50,54,32,49,57,46,49,55,54,56,32,49,53,46,50,51,55,52,32,49,57,
+46,52,54,57,55,32,49,53,46,53,51,48,51,76,50,48,46,53,51,48,51,32,49,52,46,52,54,57,55,90,77,49,57,46,52,54,57,55,32,49,
+56,46,52,54,57,55,67,49,57,46,49,55,54,56,32,49,56,46,55,54,50,54,32,49,57,46,49,55,54,56,32,49,57,46,50,51,55,52,32,49,
+57,46,52,54,57,55,32,49,57,46,53,51,48,51,67,49,57,46,55,54,50,54,32,49,57,46,56,50,51,50,32,50,48,46,50,51,55,52,32,49,
+57,46,56,50,51,50,32,50,48,46,53,51,48,51,32,49,57,46,53,51,48,51,76,49,57,46,52,54,57,55,32,49,56,46,52,54,57,55,90,77,
+49,54,46,49,50,53,52,32,49,54,46,57,52,52,55,76,49,54,46,50,54,56,55,32,49,54,46,50,48,56,54,72,49,54,46,50,54,56,55,76,
+49,54,46,49,50,53,52,32,49,54,46,57,52,52,55,90,77,49,52,46,52,52,51,49,32,49,52,46,54,49,52,49,67,49,52,46,50,51,32,49,
+52,46,50,53,56,57,32,49,51,46,55,54,57,51,32,49,52,46,49,52,51,56,32,49,51,46,52,49,52,49,32,49,52,46,51,53,54,57,67,49,
+51,46,48,53,56,57,32,49,52,46,53,55,32,49,50,46,57,52,51,56,32,49,53,46,48,51,48,55,32,49,51,46,49,53,54,57,32,49,53,46,
+51,56,53,57,76,49,52,46,52,52,51,49,32,49,52,46,54,49,52,49,90,77,49,52,46,52,54,56,52,32,49,54,46,48,48,54,53,76,49,53,
+46,48,50,53,57,32,49,53,46,53,48,52,57,86,49,53,46,53,48,52,57,76,49,52,46,52,54,56,52,32,49,54,46,48,48,54,53,90,77,55,
+46,56,55,52,54,32,55,46,48,53,53,50,54,76,56,46,48,49,55,56,57,32,54,46,51,49,57,48,56,76,55,46,56,55,52,54,32,55,46,48,
+53,53,50,54,90,77,57,46,53,53,54,56,56,32,57,46,51,56,53,56,55,67,57,46,55,54,57,57,57,32,57,46,55,52,49,48,54,32,49,48,
+46,50,51,48,55,32,57,46,56,53,54,50,51,32,49,48,46,53,56,53,57,32,57,46,54,52,51,49,50,67,49,48,46,57,52,49,49,32,57,46,
+52,51,48,48,49,32,49,49,46,48,53,54,50,32,56,46,57,54,57,51,49,32,49,48,46,56,52,51,49,32,56,46,54,49,52,49,51,76,57,46,
+53,53,54,56,56,32,57,46,51,56,53,56,55,90,77,57,46,53,51,49,54,51,32,55,46,57,57,51,52,54,76,56,46,57,55,52,48,56,32,56,
+46,52,57,53,48,57,76,56,46,57,55,52,48,56,32,56,46,52,57,53,48,57,76,57,46,53,51,49,54,51,32,55,46,57,57,51,52,54,90,77,
+50,32,55,46,55,53,72,54,46,54,54,55,54,50,86,54,46,50,53,72,50,86,55,46,55,53,90,77,49,55,46,51,51,50,52,32,49,55,46,55,
+53,72,50,50,86,49,54,46,50,53,72,49,55,46,51,51,50,52,86,49,55,46,55,53,90,77,50,50,46,53,51,48,51,32,49,54,46,52,54,57,
+55,76,50,48,46,53,51,48,51,32,49,52,46,52,54,57,55,76,49,57,46,52,54,57,55,32,49,53,46,53,51,48,51,76,50,49,46,52,54,57,
+55,32,49,55,46,53,51,48,51,76,50,50,46,53,51,48,51,32,49,54,46,52,54,57,55,90,77,50,49,46,52,54,57,55,32,49,54,46,52,54,
+57,55,76,49,57,46,52,54,57,55,32,49,56,46,52,54,57,55,76,50,48,46,53,51,48,51,32,49,57,46,53,51,48,51,76,50,50,46,53,51,
+48,51,32,49,55,46,53,51,48,51,76,50,49,46,52,54,57,55,32,49,54,46,52,54,57,55,90,77,49,55,46,51,51,50,52,32,49,54,46,50,
+53,67,49,54,46,54,56,54,55,32,49,54,46,50,53,32,49,54,46,52,54,52,56,32,49,54,46,50,52,54,55,32,49,54,46,50,54,56,55,32,
+49,54,46,50,48,56,54,76,49,53,46,57,56,50,49,32,49,55,46,54,56,48,57,67,49,54,46,51,53,51,56,32,49,55,46,55,53,51,51,32,
+49,54,46,55,52,55,51,32,49,55,46,55,53,32,49,55,46,51,51,50,52,32,49,55,46,55,53,86,49,54,46,50,53,90,77,49,51,46,49,53,
+54,57,32,49,53,46,51,56,53,57,67,49,51,46,52,53,55,57,32,49,53,46,56,56,55,53,32,49,51,46,54,53,55,53,32,49,54,46,50,50,
+54,55,32,49,51,46,57,49,48,56,32,49,54,46,53,48,56,50,76,49,53,46,48,50,53,57,32,49,53,46,53,48,52,57,67,49,52,46,56,57,
+50,51,32,49,53,46,51,53,54,52,32,49,52,46,55,55,53,51,32,49,53,46,49,54,55,56,32,49,52,46,52,52,51,49,32,49,52,46,54,49,
+52,49,76,49,51,46,49,53,54,57,32,49,53,46,51,56,53,57,90,77,49,54,46,50,54,56,55,32,49,54,46,50,48,56,54,67,49,53,46,55,
+56,57,32,49,54,46,49,49,53,50,32,49,53,46,51,53,50,56,32,49,53,46,56,54,56,50,32,49,53,46,48,50,53,57,32,49,53,46,53,48,
+52,57,76,49,51,46,57,49,48,56,32,49,54,46,53,48,56,50,67,49,52,46,52,53,53,54,32,49,55,46,49,49,51,55,32,49,53,46,49,56,
+50,54,32,49,55,46,53,50,53,51,32,49,53,46,57,56,50,49,32,49,55,46,54,56,48,57,76,49,54,46,50,54,56,55,32,49,54,46,50,48,
+56,54,90,77,54,46,54,54,55,54,50,32,55,46,55,53,67,55,46,51,49,51,51,50,32,55,46,55,53,32,55,46,53,51,53,49,57,32,55,46,
+55,53,51,50,56,32,55,46,55,51,49,51,49,32,55,46,55,57,49,52,53,76,56,46,48,49,55,56,57,32,54,46,51,49,57,48,56,67,55,46,
+54,52,54,49,54,32,54,46,50,52,54,55,50,32,55,46,50,53,50,54,55,32,54,46,50,53,32,54,46,54,54,55,54,50,32,54,46,50,53,86,
+55,46,55,53,90,77,49,48,46,56,52,51,49,32,56,46,54,49,52,49,51,67,49,48,46,53,52,50,49,32,56,46,49,49,50,52,53,32,49,48,
+46,51,52,50,53,32,55,46,55,55,51,51,53,32,49,48,46,48,56,57,50,32,55,46,52,57,49,56,50,76,56,46,57,55,52,48,56,32,56,46,
+52,57,53,48,57,67,57,46,49,48,55,55,49,32,56,46,54,52,51,54,50,32,57,46,50,50,52,54,55,32,56,46,56,51,50,49,57,32,57,46,
+53,53,54,56,56,32,57,46,51,56,53,56,55,76,49,48,46,56,52,51,49,32,56,46,54,49,52,49,51,90,77,55,46,55,51,49,51,49,32,55,
+46,55,57,49,52,53,67,56,46,50,49,48,57,56,32,55,46,56,56,52,56,49,32,56,46,54,52,55,50,50,32,56,46,49,51,49,56,49,32,56,
+46,57,55,52,48,56,32,56,46,52,57,53,48,57,76,49,48,46,48,56,57,50,32,55,46,52,57,49,56,50,67,57,46,53,52,52,52,50,32,54,
+46,56,56,54,51,53,32,56,46,56,49,55,51,53,32,54,46,52,55,52,54,57,32,56,46,48,49,55,56,57,32,54,46,51,49,57,48,56,76,55,
+46,55,51,49,51,49,32,55,46,55,57,49,52,53,90,34,32,102,105,108,108,61,34,35,70,69,69,55,49,53,34,47,62,32,60,47,103,62,10,13,
+60,47,115,118,103,62,0 };
+
+const char* mixer_svg = (const char*) temp_binary_data_6;
+
+
+//================== mute.svg ==================
+static const unsigned char temp_binary_data_7[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,112,97,116,104,32,100,61,34,77,50,48,32,54,67,50,48,32,54,32,50,49,46,53,32,55,46,56,32,50,49,46,53,32,49,50,67,
+50,49,46,53,32,49,54,46,50,32,50,48,32,49,56,32,50,48,32,49,56,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,
+115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,
+34,47,62,32,60,112,97,116,104,32,100,61,34,77,49,56,32,57,67,49,56,32,57,32,49,56,46,53,32,57,46,57,32,49,56,46,53,32,49,50,
+67,49,56,46,53,32,49,52,46,49,32,49,56,32,49,53,32,49,56,32,49,53,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,
+32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,
+100,34,47,62,32,60,112,97,116,104,32,100,61,34,77,49,46,57,53,56,54,51,32,56,46,53,55,54,55,57,67,50,46,50,52,52,56,50,32,56,
+46,48,52,53,54,51,32,50,46,55,57,50,51,57,32,55,46,53,51,48,52,50,32,51,46,51,51,57,57,55,32,55,46,50,55,55,48,55,67,51,
+46,57,51,57,51,32,54,46,57,57,57,55,57,32,52,46,54,50,54,50,54,32,54,46,57,57,57,55,57,32,54,46,48,48,48,49,56,32,54,46,
+57,57,57,55,57,67,54,46,53,49,50,50,53,32,54,46,57,57,57,55,57,32,54,46,55,54,56,50,56,32,54,46,57,57,57,55,57,32,55,46,
+48,49,54,50,57,32,54,46,57,53,55,57,49,67,55,46,50,54,49,52,55,32,54,46,57,49,54,53,32,55,46,53,48,48,53,54,32,54,46,56,
+52,52,55,56,32,55,46,55,50,56,48,52,32,54,46,55,52,52,51,56,67,55,46,57,53,56,49,53,32,54,46,54,52,50,56,51,32,56,46,49,
+55,49,57,32,54,46,53,48,49,56,57,32,56,46,53,57,57,52,49,32,54,46,50,50,48,48,50,76,56,46,56,49,56,51,53,32,54,46,48,55,
+53,54,54,67,49,49,46,51,54,49,51,32,52,46,51,57,56,57,56,32,49,50,46,54,51,50,56,32,51,46,53,54,48,54,51,32,49,51,46,55,
+48,48,49,32,51,46,57,50,52,56,55,67,49,51,46,57,48,52,56,32,51,46,57,57,52,55,32,49,52,46,49,48,50,57,32,52,46,48,57,53,
+53,49,32,49,52,46,50,55,57,56,32,52,46,50,49,57,56,52,67,49,53,46,50,48,50,53,32,52,46,56,54,56,50,57,32,49,53,46,50,55,
+50,54,32,54,46,51,55,54,57,57,32,49,53,46,52,49,50,56,32,57,46,51,57,52,52,67,49,53,46,52,54,52,55,32,49,48,46,53,49,49,
+55,32,49,53,46,53,48,48,49,32,49,49,46,52,54,55,57,32,49,53,46,53,48,48,49,32,49,49,46,57,57,57,56,67,49,53,46,53,48,48,
+49,32,49,50,46,53,51,49,55,32,49,53,46,52,54,52,55,32,49,51,46,52,56,55,57,32,49,53,46,52,49,50,56,32,49,52,46,54,48,53,
+50,67,49,53,46,50,55,50,54,32,49,55,46,54,50,50,54,32,49,53,46,50,48,50,53,32,49,57,46,49,51,49,51,32,49,52,46,50,55,57,
+56,32,49,57,46,55,55,57,55,67,49,52,46,49,48,50,57,32,49,57,46,57,48,52,49,32,49,51,46,57,48,52,56,32,50,48,46,48,48,52,
+57,32,49,51,46,55,48,48,49,32,50,48,46,48,55,52,55,67,49,50,46,54,51,50,56,32,50,48,46,52,51,56,57,32,49,49,46,51,54,49,
+51,32,49,57,46,54,48,48,54,32,56,46,56,49,56,51,52,32,49,55,46,57,50,51,57,76,56,46,53,57,57,52,49,32,49,55,46,55,55,57,
+54,67,56,46,49,55,49,57,32,49,55,46,52,57,55,55,32,55,46,57,53,56,49,53,32,49,55,46,51,53,54,55,32,55,46,55,50,56,48,52,
+32,49,55,46,50,53,53,50,67,55,46,53,48,48,53,54,32,49,55,46,49,53,52,56,32,55,46,50,54,49,52,55,32,49,55,46,48,56,51,49,
+32,55,46,48,49,54,50,57,32,49,55,46,48,52,49,55,67,54,46,55,54,56,50,56,32,49,54,46,57,57,57,56,32,54,46,53,49,50,50,53,
+32,49,54,46,57,57,57,56,32,54,46,48,48,48,49,56,32,49,54,46,57,57,57,56,67,52,46,54,50,54,50,54,32,49,54,46,57,57,57,56,
+32,51,46,57,51,57,51,32,49,54,46,57,57,57,56,32,51,46,51,51,57,57,55,32,49,54,46,55,50,50,53,67,50,46,55,57,50,51,57,32,
+49,54,46,52,54,57,50,32,50,46,50,52,52,56,50,32,49,53,46,57,53,51,57,32,49,46,57,53,56,54,51,32,49,53,46,52,50,50,56,67,
+49,46,54,52,53,52,32,49,52,46,56,52,49,52,32,49,46,54,48,56,53,54,32,49,52,46,50,51,55,32,49,46,53,51,52,56,56,32,49,51,
+46,48,50,56,50,67,49,46,53,50,51,57,54,32,49,50,46,56,52,57,32,49,46,53,49,53,50,53,32,49,50,46,54,55,50,50,32,49,46,53,
+48,57,50,56,32,49,50,46,52,57,57,56,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,
+100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,32,60,47,103,62,10,
+13,60,47,115,118,103,62,0 };
+
+const char* mute_svg = (const char*) temp_binary_data_7;
+
+
+//================== pause.svg ==================
+static const unsigned char temp_binary_data_8[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,112,97,116,104,32,100,61,34,77,50,32,49,56,67,50,32,49,57,46,56,56,53,54,32,50,32,50,48,46,56,50,56,52,32,50,46,
+53,56,53,55,57,32,50,49,46,52,49,52,50,67,51,46,49,55,49,53,55,32,50,50,32,52,46,49,49,52,51,56,32,50,50,32,54,32,50,50,
+67,55,46,56,56,53,54,50,32,50,50,32,56,46,56,50,56,52,51,32,50,50,32,57,46,52,49,52,50,49,32,50,49,46,52,49,52,50,67,49,
+48,32,50,48,46,56,50,56,52,32,49,48,32,49,57,46,56,56,53,54,32,49,48,32,49,56,86,54,67,49,48,32,52,46,49,49,52,51,56,32,
+49,48,32,51,46,49,55,49,53,55,32,57,46,52,49,52,50,49,32,50,46,53,56,53,55,57,67,56,46,56,50,56,52,51,32,50,32,55,46,56,
+56,53,54,50,32,50,32,54,32,50,67,52,46,49,49,52,51,56,32,50,32,51,46,49,55,49,53,55,32,50,32,50,46,53,56,53,55,57,32,50,
+46,53,56,53,55,57,67,50,32,51,46,49,55,49,53,55,32,50,32,52,46,49,49,52,51,56,32,50,32,54,86,49,52,34,32,115,116,114,111,107,
+101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,
+110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,32,60,112,97,116,104,32,100,61,34,77,50,50,32,54,67,50,50,32,52,46,49,49,52,51,
+56,32,50,50,32,51,46,49,55,49,53,55,32,50,49,46,52,49,52,50,32,50,46,53,56,53,55,57,67,50,48,46,56,50,56,52,32,50,32,49,
+57,46,56,56,53,54,32,50,32,49,56,32,50,67,49,54,46,49,49,52,52,32,50,32,49,53,46,49,55,49,54,32,50,32,49,52,46,53,56,53,
+56,32,50,46,53,56,53,55,57,67,49,52,32,51,46,49,55,49,53,55,32,49,52,32,52,46,49,49,52,51,56,32,49,52,32,54,86,49,56,67,
+49,52,32,49,57,46,56,56,53,54,32,49,52,32,50,48,46,56,50,56,52,32,49,52,46,53,56,53,56,32,50,49,46,52,49,52,50,67,49,53,
+46,49,55,49,54,32,50,50,32,49,54,46,49,49,52,52,32,50,50,32,49,56,32,50,50,67,49,57,46,56,56,53,54,32,50,50,32,50,48,46,
+56,50,56,52,32,50,50,32,50,49,46,52,49,52,50,32,50,49,46,52,49,52,50,67,50,50,32,50,48,46,56,50,56,52,32,50,50,32,49,57,
+46,56,56,53,54,32,50,50,32,49,56,86,49,48,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,
+119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,32,60,47,103,
+62,10,13,60,47,115,118,103,62,0 };
+
+const char* pause_svg = (const char*) temp_binary_data_8;
+
+
+//================== playlist.svg ==================
+static const unsigned char temp_binary_data_9[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,112,97,116,104,32,100,61,34,77,49,50,46,53,54,48,54,32,49,50,46,54,57,57,53,76,49,50,46,50,48,55,54,32,49,51,46,
+51,54,49,50,76,49,50,46,50,48,55,54,32,49,51,46,51,54,49,50,76,49,50,46,53,54,48,54,32,49,50,46,54,57,57,53,90,77,49,51,
+46,52,52,50,57,32,49,51,46,49,55,76,49,51,46,55,57,53,56,32,49,50,46,53,48,56,51,86,49,50,46,53,48,56,51,76,49,51,46,52,
+52,50,57,32,49,51,46,49,55,90,77,49,52,46,52,51,57,52,32,49,49,46,51,48,49,53,76,49,52,46,55,57,50,52,32,49,48,46,54,51,
+57,56,76,49,52,46,55,57,50,52,32,49,48,46,54,51,57,56,76,49,52,46,52,51,57,52,32,49,49,46,51,48,49,53,90,77,49,51,46,53,
+53,55,49,32,49,48,46,56,51,48,57,76,49,51,46,57,49,32,49,48,46,49,54,57,50,76,49,51,46,57,49,32,49,48,46,49,54,57,50,76,
+49,51,46,53,53,55,49,32,49,48,46,56,51,48,57,90,77,49,50,46,48,48,49,56,32,49,49,46,54,48,54,54,76,49,50,46,55,53,48,53,
+32,49,49,46,54,53,50,86,49,49,46,54,53,50,76,49,50,46,48,48,49,56,32,49,49,46,54,48,54,54,90,77,49,51,46,52,49,54,51,32,
+49,48,46,55,53,55,57,76,49,51,46,49,48,52,49,32,49,49,46,52,51,57,56,76,49,51,46,49,48,52,49,32,49,49,46,52,51,57,56,76,
+49,51,46,52,49,54,51,32,49,48,46,55,53,55,57,90,77,49,52,46,57,57,57,53,32,49,50,46,49,54,56,55,76,49,53,46,55,52,57,49,
+32,49,50,46,49,52,52,57,86,49,50,46,49,52,52,57,76,49,52,46,57,57,57,53,32,49,50,46,49,54,56,55,90,77,49,52,46,52,57,56,
+52,32,49,49,46,51,51,51,53,76,49,52,46,56,55,50,50,32,49,48,46,54,56,51,51,76,49,52,46,56,55,50,50,32,49,48,46,54,56,51,
+51,76,49,52,46,52,57,56,52,32,49,49,46,51,51,51,53,90,77,49,51,46,53,56,51,55,32,49,51,46,50,52,51,49,76,49,51,46,56,57,
+53,57,32,49,50,46,53,54,49,49,76,49,51,46,56,57,53,57,32,49,50,46,53,54,49,49,76,49,51,46,53,56,51,55,32,49,51,46,50,52,
+51,49,90,77,49,52,46,57,57,56,50,32,49,50,46,51,57,52,52,76,49,52,46,50,52,57,53,32,49,50,46,51,52,57,86,49,50,46,51,52,
+57,76,49,52,46,57,57,56,50,32,49,50,46,51,57,52,52,90,77,49,50,46,53,48,49,54,32,49,50,46,54,54,55,52,76,49,50,46,49,50,
+55,56,32,49,51,46,51,49,55,55,76,49,50,46,49,50,55,56,32,49,51,46,51,49,55,55,76,49,50,46,53,48,49,54,32,49,50,46,54,54,
+55,52,90,77,49,50,46,48,48,48,53,32,49,49,46,56,51,50,51,76,49,49,46,50,53,48,57,32,49,49,46,56,53,54,49,86,49,49,46,56,
+53,54,49,76,49,50,46,48,48,48,53,32,49,49,46,56,51,50,51,90,77,49,49,46,50,53,32,49,54,46,53,48,48,53,67,49,49,46,50,53,
+32,49,54,46,57,49,52,55,32,49,48,46,57,49,52,50,32,49,55,46,50,53,48,53,32,49,48,46,53,32,49,55,46,50,53,48,53,86,49,56,
+46,55,53,48,53,67,49,49,46,55,52,50,54,32,49,56,46,55,53,48,53,32,49,50,46,55,53,32,49,55,46,55,52,51,49,32,49,50,46,55,
+53,32,49,54,46,53,48,48,53,72,49,49,46,50,53,90,77,49,48,46,53,32,49,55,46,50,53,48,53,67,49,48,46,48,56,53,56,32,49,55,
+46,50,53,48,53,32,57,46,55,53,32,49,54,46,57,49,52,55,32,57,46,55,53,32,49,54,46,53,48,48,53,72,56,46,50,53,67,56,46,50,
+53,32,49,55,46,55,52,51,49,32,57,46,50,53,55,51,54,32,49,56,46,55,53,48,53,32,49,48,46,53,32,49,56,46,55,53,48,53,86,49,
+55,46,50,53,48,53,90,77,57,46,55,53,32,49,54,46,53,48,48,53,67,57,46,55,53,32,49,54,46,48,56,54,51,32,49,48,46,48,56,53,
+56,32,49,53,46,55,53,48,53,32,49,48,46,53,32,49,53,46,55,53,48,53,86,49,52,46,50,53,48,53,67,57,46,50,53,55,51,54,32,49,
+52,46,50,53,48,53,32,56,46,50,53,32,49,53,46,50,53,55,56,32,56,46,50,53,32,49,54,46,53,48,48,53,72,57,46,55,53,90,77,49,
+48,46,53,32,49,53,46,55,53,48,53,67,49,48,46,57,49,52,50,32,49,53,46,55,53,48,53,32,49,49,46,50,53,32,49,54,46,48,56,54,
+51,32,49,49,46,50,53,32,49,54,46,53,48,48,53,72,49,50,46,55,53,67,49,50,46,55,53,32,49,53,46,50,53,55,56,32,49,49,46,55,
+52,50,54,32,49,52,46,50,53,48,53,32,49,48,46,53,32,49,52,46,50,53,48,53,86,49,53,46,55,53,48,53,90,77,49,50,46,55,53,32,
+49,54,46,53,48,48,53,86,49,50,46,48,48,48,53,72,49,49,46,50,53,86,49,54,46,53,48,48,53,72,49,50,46,55,53,90,77,49,50,46,
+50,48,55,54,32,49,51,46,51,54,49,50,76,49,51,46,48,57,32,49,51,46,56,51,49,56,76,49,51,46,55,57,53,56,32,49,50,46,53,48,
+56,51,76,49,50,46,57,49,51,53,32,49,50,46,48,51,55,55,76,49,50,46,50,48,55,54,32,49,51,46,51,54,49,50,90,77,49,52,46,55,
+57,50,52,32,49,48,46,54,51,57,56,76,49,51,46,57,49,32,49,48,46,49,54,57,50,76,49,51,46,50,48,52,50,32,49,49,46,52,57,50,
+55,76,49,52,46,48,56,54,53,32,49,49,46,57,54,51,51,76,49,52,46,55,57,50,52,32,49,48,46,54,51,57,56,90,77,49,50,46,55,53,
+32,49,49,46,55,54,53,50,67,49,50,46,55,53,32,49,49,46,55,50,49,32,49,50,46,55,53,32,49,49,46,54,57,50,57,32,49,50,46,55,
+53,48,50,32,49,49,46,54,55,50,67,49,50,46,55,53,48,52,32,49,49,46,54,53,48,53,32,49,50,46,55,53,48,55,32,49,49,46,54,52,
+55,54,32,49,50,46,55,53,48,53,32,49,49,46,54,53,50,76,49,49,46,50,53,51,50,32,49,49,46,53,54,49,50,67,49,49,46,50,52,57,
+54,32,49,49,46,54,50,48,51,32,49,49,46,50,53,32,49,49,46,54,57,51,49,32,49,49,46,50,53,32,49,49,46,55,54,53,50,72,49,50,
+46,55,53,90,77,49,51,46,57,49,32,49,48,46,49,54,57,50,67,49,51,46,56,52,54,52,32,49,48,46,49,51,53,50,32,49,51,46,55,56,
+50,52,32,49,48,46,49,48,48,55,32,49,51,46,55,50,56,53,32,49,48,46,48,55,54,76,49,51,46,49,48,52,49,32,49,49,46,52,51,57,
+56,67,49,51,46,49,32,49,49,46,52,51,56,32,49,51,46,49,48,50,55,32,49,49,46,52,51,57,49,32,49,51,46,49,50,49,56,32,49,49,
+46,52,52,57,67,49,51,46,49,52,48,52,32,49,49,46,52,53,56,55,32,49,51,46,49,54,53,50,32,49,49,46,52,55,49,57,32,49,51,46,
+50,48,52,50,32,49,49,46,52,57,50,55,76,49,51,46,57,49,32,49,48,46,49,54,57,50,90,77,49,50,46,55,53,48,53,32,49,49,46,54,
+53,50,67,49,50,46,55,54,49,49,32,49,49,46,52,55,54,55,32,49,50,46,57,52,52,52,32,49,49,46,51,54,54,55,32,49,51,46,49,48,
+52,49,32,49,49,46,52,51,57,56,76,49,51,46,55,50,56,53,32,49,48,46,48,55,54,67,49,50,46,54,49,48,56,32,57,46,53,54,52,50,
+55,32,49,49,46,51,50,55,55,32,49,48,46,51,51,52,49,32,49,49,46,50,53,51,50,32,49,49,46,53,54,49,50,76,49,50,46,55,53,48,
+53,32,49,49,46,54,53,50,90,77,49,53,46,55,53,32,49,50,46,50,51,53,56,67,49,53,46,55,53,32,49,50,46,50,48,54,55,32,49,53,
+46,55,53,48,49,32,49,50,46,49,55,53,53,32,49,53,46,55,52,57,49,32,49,50,46,49,52,52,57,76,49,52,46,50,52,57,57,32,49,50,
+46,49,57,50,53,67,49,52,46,50,52,57,56,32,49,50,46,49,57,49,55,32,49,52,46,50,52,57,57,32,49,50,46,49,57,50,57,32,49,52,
+46,50,53,32,49,50,46,49,57,57,57,67,49,52,46,50,53,32,49,50,46,50,48,55,55,32,49,52,46,50,53,32,49,50,46,50,49,55,57,32,
+49,52,46,50,53,32,49,50,46,50,51,53,56,72,49,53,46,55,53,90,77,49,52,46,48,56,54,53,32,49,49,46,57,54,51,51,67,49,52,46,
+49,48,50,51,32,49,49,46,57,55,49,55,32,49,52,46,49,49,49,51,32,49,49,46,57,55,54,53,32,49,52,46,49,49,56,49,32,49,49,46,
+57,56,48,50,67,49,52,46,49,50,52,51,32,49,49,46,57,56,51,53,32,49,52,46,49,50,53,51,32,49,49,46,57,56,52,50,32,49,52,46,
+49,50,52,54,32,49,49,46,57,56,51,56,76,49,52,46,56,55,50,50,32,49,48,46,54,56,51,51,67,49,52,46,56,52,53,54,32,49,48,46,
+54,54,56,32,49,52,46,56,49,56,49,32,49,48,46,54,53,51,53,32,49,52,46,55,57,50,52,32,49,48,46,54,51,57,56,76,49,52,46,48,
+56,54,53,32,49,49,46,57,54,51,51,90,77,49,53,46,55,52,57,49,32,49,50,46,49,52,52,57,67,49,53,46,55,50,57,56,32,49,49,46,
+53,51,56,54,32,49,53,46,51,57,56,32,49,48,46,57,56,53,54,32,49,52,46,56,55,50,50,32,49,48,46,54,56,51,51,76,49,52,46,49,
+50,52,54,32,49,49,46,57,56,51,56,67,49,52,46,49,57,57,55,32,49,50,46,48,50,54,57,32,49,52,46,50,52,55,49,32,49,50,46,49,
+48,53,57,32,49,52,46,50,52,57,57,32,49,50,46,49,57,50,53,76,49,53,46,55,52,57,49,32,49,50,46,49,52,52,57,90,77,49,51,46,
+48,57,32,49,51,46,56,51,49,56,67,49,51,46,49,53,51,54,32,49,51,46,56,54,53,55,32,49,51,46,50,49,55,54,32,49,51,46,57,48,
+48,51,32,49,51,46,50,55,49,53,32,49,51,46,57,50,53,76,49,51,46,56,57,53,57,32,49,50,46,53,54,49,49,67,49,51,46,57,32,49,
+50,46,53,54,51,32,49,51,46,56,57,55,51,32,49,50,46,53,54,49,57,32,49,51,46,56,55,56,50,32,49,50,46,53,53,50,67,49,51,46,
+56,53,57,54,32,49,50,46,53,52,50,51,32,49,51,46,56,51,52,56,32,49,50,46,53,50,57,49,32,49,51,46,55,57,53,56,32,49,50,46,
+53,48,56,51,76,49,51,46,48,57,32,49,51,46,56,51,49,56,90,77,49,52,46,50,53,32,49,50,46,50,51,53,56,67,49,52,46,50,53,32,
+49,50,46,50,56,32,49,52,46,50,53,32,49,50,46,51,48,56,32,49,52,46,50,52,57,56,32,49,50,46,51,50,57,67,49,52,46,50,52,57,
+54,32,49,50,46,51,53,48,53,32,49,52,46,50,52,57,51,32,49,50,46,51,53,51,52,32,49,52,46,50,52,57,53,32,49,50,46,51,52,57,
+76,49,53,46,55,52,54,56,32,49,50,46,52,51,57,56,67,49,53,46,55,53,48,52,32,49,50,46,51,56,48,55,32,49,53,46,55,53,32,49,
+50,46,51,48,55,57,32,49,53,46,55,53,32,49,50,46,50,51,53,56,72,49,52,46,50,53,90,77,49,51,46,50,55,49,53,32,49,51,46,57,
+50,53,67,49,52,46,51,56,57,50,32,49,52,46,52,51,54,55,32,49,53,46,54,55,50,51,32,49,51,46,54,54,54,56,32,49,53,46,55,52,
+54,56,32,49,50,46,52,51,57,56,76,49,52,46,50,52,57,53,32,49,50,46,51,52,57,67,49,52,46,50,51,56,57,32,49,50,46,53,50,52,
+51,32,49,52,46,48,53,53,54,32,49,50,46,54,51,52,50,32,49,51,46,56,57,53,57,32,49,50,46,53,54,49,49,76,49,51,46,50,55,49,
+53,32,49,51,46,57,50,53,90,77,49,50,46,57,49,51,53,32,49,50,46,48,51,55,55,67,49,50,46,56,57,55,55,32,49,50,46,48,50,57,
+51,32,49,50,46,56,56,56,55,32,49,50,46,48,50,52,53,32,49,50,46,56,56,49,57,32,49,50,46,48,50,48,56,67,49,50,46,56,55,53,
+55,32,49,50,46,48,49,55,52,32,49,50,46,56,55,52,54,32,49,50,46,48,49,54,56,32,49,50,46,56,55,53,52,32,49,50,46,48,49,55,
+50,76,49,50,46,49,50,55,56,32,49,51,46,51,49,55,55,67,49,50,46,49,53,52,52,32,49,51,46,51,51,50,57,32,49,50,46,49,56,49,
+57,32,49,51,46,51,52,55,53,32,49,50,46,50,48,55,54,32,49,51,46,51,54,49,50,76,49,50,46,57,49,51,53,32,49,50,46,48,51,55,
+55,90,77,49,49,46,50,53,32,49,49,46,55,54,53,50,67,49,49,46,50,53,32,49,49,46,55,57,52,51,32,49,49,46,50,52,57,57,32,49,
+49,46,56,50,53,53,32,49,49,46,50,53,48,57,32,49,49,46,56,53,54,49,76,49,50,46,55,53,48,49,32,49,49,46,56,48,56,52,67,49,
+50,46,55,53,48,50,32,49,49,46,56,48,57,51,32,49,50,46,55,53,48,49,32,49,49,46,56,48,56,32,49,50,46,55,53,32,49,49,46,56,
+48,49,49,67,49,50,46,55,53,32,49,49,46,55,57,51,51,32,49,50,46,55,53,32,49,49,46,55,56,51,49,32,49,50,46,55,53,32,49,49,
+46,55,54,53,50,72,49,49,46,50,53,90,77,49,50,46,56,55,53,52,32,49,50,46,48,49,55,50,67,49,50,46,56,48,48,51,32,49,49,46,
+57,55,52,32,49,50,46,55,53,50,57,32,49,49,46,56,57,53,32,49,50,46,55,53,48,49,32,49,49,46,56,48,56,52,76,49,49,46,50,53,
+48,57,32,49,49,46,56,53,54,49,67,49,49,46,50,55,48,50,32,49,50,46,52,54,50,51,32,49,49,46,54,48,50,32,49,51,46,48,49,53,
+52,32,49,50,46,49,50,55,56,32,49,51,46,51,49,55,55,76,49,50,46,56,55,53,52,32,49,50,46,48,49,55,50,90,34,32,102,105,108,108,
+61,34,35,70,69,69,55,49,53,34,47,62,32,60,112,97,116,104,32,100,61,34,77,49,57,46,53,54,49,55,32,55,67,49,57,46,55,57,48,52,
+32,53,46,54,57,53,50,51,32,49,56,46,55,56,54,51,32,52,46,53,32,49,55,46,52,54,49,55,32,52,46,53,72,54,46,53,51,55,56,56,
+67,53,46,50,49,51,50,51,32,52,46,53,32,52,46,50,48,57,50,50,32,53,46,54,57,53,50,51,32,52,46,52,51,55,56,52,32,55,34,32,
+115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,47,62,32,60,112,
+97,116,104,32,100,61,34,77,49,55,46,52,57,57,57,32,52,46,53,67,49,55,46,53,50,56,51,32,52,46,50,52,48,57,50,32,49,55,46,53,
+52,50,53,32,52,46,49,49,49,51,53,32,49,55,46,53,52,50,55,32,52,46,48,48,52,51,53,67,49,55,46,53,52,53,32,50,46,57,56,48,
+55,50,32,49,54,46,55,55,51,57,32,50,46,49,50,48,54,52,32,49,53,46,55,53,54,49,32,50,46,48,49,49,52,50,67,49,53,46,54,52,
+57,55,32,50,32,49,53,46,53,49,57,52,32,50,32,49,53,46,50,53,56,56,32,50,72,56,46,55,52,48,57,57,67,56,46,52,56,48,51,53,
+32,50,32,56,46,51,53,48,48,50,32,50,32,56,46,50,52,51,54,50,32,50,46,48,49,49,52,50,67,55,46,50,50,53,56,52,32,50,46,49,
+50,48,54,52,32,54,46,52,53,52,56,49,32,50,46,57,56,48,55,50,32,54,46,52,53,55,48,52,32,52,46,48,48,52,51,52,67,54,46,52,
+53,55,50,55,32,52,46,49,49,49,51,53,32,54,46,52,55,49,52,54,32,52,46,50,52,48,57,32,54,46,52,57,57,56,51,32,52,46,53,34,
+32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,47,62,32,60,
+112,97,116,104,32,100,61,34,77,50,49,46,49,57,51,53,32,49,54,46,55,57,51,67,50,48,46,56,52,51,55,32,49,57,46,50,55,51,57,32,
+50,48,46,54,54,56,57,32,50,48,46,53,49,52,51,32,49,57,46,55,55,49,55,32,50,49,46,50,53,55,50,67,49,56,46,56,55,52,53,32,
+50,50,32,49,55,46,53,53,49,50,32,50,50,32,49,52,46,57,48,52,54,32,50,50,72,57,46,48,57,53,51,54,67,54,46,52,52,56,56,49,
+32,50,50,32,53,46,49,50,53,53,51,32,50,50,32,52,46,50,50,56,51,52,32,50,49,46,50,53,55,50,67,51,46,51,51,49,49,53,32,50,
+48,46,53,49,52,51,32,51,46,49,53,54,50,54,32,49,57,46,50,55,51,57,32,50,46,56,48,54,52,56,32,49,54,46,55,57,51,76,50,46,
+51,56,51,53,49,32,49,51,46,55,57,51,67,49,46,57,51,55,52,56,32,49,48,46,54,50,57,52,32,49,46,55,49,52,52,55,32,57,46,48,
+52,55,54,53,32,50,46,54,54,50,51,50,32,56,46,48,50,51,56,51,67,51,46,54,49,48,49,55,32,55,32,53,46,50,57,55,53,56,32,55,
+32,56,46,54,55,50,51,57,32,55,72,49,53,46,51,50,55,54,67,49,56,46,55,48,50,52,32,55,32,50,48,46,51,56,57,56,32,55,32,50,
+49,46,51,51,55,55,32,56,46,48,50,51,56,51,67,50,50,46,48,56,54,53,32,56,46,56,51,50,54,56,32,50,50,46,49,48,52,53,32,57,
+46,57,56,57,55,57,32,50,49,46,56,53,57,50,32,49,50,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,
+107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,32,
+60,47,103,62,10,13,60,47,115,118,103,62,0 };
+
+const char* playlist_svg = (const char*) temp_binary_data_9;
+
+
+//================== restart.svg ==================
+static const unsigned char temp_binary_data_10[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,103,32,99,108,105,112,45,112,97,116,104,61,34,117,114,108,40,35,99,108,105,112,48,95,49,50,55,54,95,55,55,54,49,41,34,62,
+32,60,112,97,116,104,32,100,61,34,77,49,57,46,55,50,56,53,32,49,48,46,57,50,56,56,67,50,48,46,52,52,49,51,32,49,51,46,53,57,
+55,56,32,49,57,46,55,53,48,55,32,49,54,46,53,54,51,53,32,49,55,46,54,53,54,57,32,49,56,46,54,53,55,51,67,49,53,46,49,55,
+57,56,32,50,49,46,49,51,52,52,32,49,49,46,52,56,50,54,32,50,49,46,54,52,55,53,32,56,46,53,32,50,48,46,49,57,54,54,77,49,
+56,46,51,54,52,32,56,46,48,53,48,55,49,76,49,55,46,54,53,54,57,32,55,46,51,52,51,54,67,49,52,46,53,51,50,55,32,52,46,50,
+49,57,52,49,32,57,46,52,54,55,51,54,32,52,46,50,49,57,52,49,32,54,46,51,52,51,49,54,32,55,46,51,52,51,54,67,51,46,52,50,
+57,54,52,32,49,48,46,50,53,55,49,32,51,46,50,51,51,49,56,32,49,52,46,56,53,56,56,32,53,46,55,53,51,55,54,32,49,56,77,49,
+56,46,51,54,52,32,56,46,48,53,48,55,49,72,49,52,46,49,50,49,51,77,49,56,46,51,54,52,32,56,46,48,53,48,55,49,86,51,46,56,
+48,56,48,55,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,
+34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,
+61,34,114,111,117,110,100,34,47,62,32,60,47,103,62,32,60,100,101,102,115,62,32,60,99,108,105,112,80,97,116,104,32,105,100,61,34,99,108,105,
+112,48,95,49,50,55,54,95,55,55,54,49,34,62,32,60,114,101,99,116,32,119,105,100,116,104,61,34,50,52,34,32,104,101,105,103,104,116,61,34,
+50,52,34,32,102,105,108,108,61,34,119,104,105,116,101,34,47,62,32,60,47,99,108,105,112,80,97,116,104,62,32,60,47,100,101,102,115,62,32,60,
+47,103,62,10,13,60,47,115,118,103,62,0 };
+
+const char* restart_svg = (const char*) temp_binary_data_10;
+
+
+//================== save.svg ==================
+static const unsigned char temp_binary_data_11[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,112,97,116,104,32,100,61,34,77,50,50,32,49,50,67,50,50,32,49,53,46,55,55,49,50,32,50,50,32,49,55,46,54,53,54,57,
+32,50,48,46,56,50,56,52,32,49,56,46,56,50,56,52,67,49,57,46,54,53,54,57,32,50,48,32,49,55,46,55,55,49,50,32,50,48,32,49,
+52,32,50,48,72,49,48,67,54,46,50,50,56,55,54,32,50,48,32,52,46,51,52,51,49,53,32,50,48,32,51,46,49,55,49,53,55,32,49,56,
+46,56,50,56,52,67,50,32,49,55,46,54,53,54,57,32,50,32,49,53,46,55,55,49,50,32,50,32,49,50,67,50,32,56,46,50,50,56,55,54,
+32,50,32,54,46,51,52,51,49,53,32,51,46,49,55,49,53,55,32,53,46,49,55,49,53,55,67,52,46,51,52,51,49,53,32,52,32,54,46,50,
+50,56,55,54,32,52,32,49,48,32,52,72,49,52,67,49,55,46,55,55,49,50,32,52,32,49,57,46,54,53,54,57,32,52,32,50,48,46,56,50,
+56,52,32,53,46,49,55,49,53,55,67,50,49,46,52,56,49,54,32,53,46,56,50,52,55,53,32,50,49,46,55,55,48,54,32,54,46,54,57,57,
+56,57,32,50,49,46,56,57,56,53,32,56,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,
+100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,32,60,112,97,116,104,
+32,100,61,34,77,49,51,46,53,32,49,51,46,55,53,67,49,51,46,53,32,49,50,46,53,48,55,52,32,49,52,46,53,48,55,52,32,49,49,46,
+53,32,49,53,46,55,53,32,49,49,46,53,67,49,54,46,57,57,50,54,32,49,49,46,53,32,49,56,32,49,50,46,53,48,55,52,32,49,56,32,
+49,51,46,55,53,67,49,56,32,49,52,46,57,57,50,54,32,49,54,46,57,57,50,54,32,49,54,32,49,53,46,55,53,32,49,54,67,49,52,46,
+53,48,55,52,32,49,54,32,49,51,46,53,32,49,52,46,57,57,50,54,32,49,51,46,53,32,49,51,46,55,53,90,34,32,115,116,114,111,107,101,
+61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,47,62,32,60,112,97,116,104,32,100,61,
+34,77,54,32,49,51,46,55,53,67,54,32,49,50,46,53,48,55,52,32,55,46,48,48,55,51,54,32,49,49,46,53,32,56,46,50,53,32,49,49,
+46,53,67,57,46,52,57,50,54,52,32,49,49,46,53,32,49,48,46,53,32,49,50,46,53,48,55,52,32,49,48,46,53,32,49,51,46,55,53,67,
+49,48,46,53,32,49,52,46,57,57,50,54,32,57,46,52,57,50,54,52,32,49,54,32,56,46,50,53,32,49,54,67,55,46,48,48,55,51,54,32,
+49,54,32,54,32,49,52,46,57,57,50,54,32,54,32,49,51,46,55,53,90,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,
+115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,47,62,32,60,112,97,116,104,32,100,61,34,77,56,46,53,32,49,49,46,53,72,
+49,54,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,
+115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,32,60,112,97,116,104,32,100,61,34,77,56,46,53,32,49,
+54,72,49,54,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,
+34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,32,60,112,97,116,104,32,100,61,34,77,49,51,46,
+50,50,56,32,56,46,53,67,49,52,46,53,54,56,56,32,56,46,53,32,49,53,46,50,51,57,51,32,56,46,53,32,49,53,46,55,53,51,50,32,
+56,46,49,52,51,56,53,67,49,54,46,50,54,55,49,32,55,46,55,56,55,55,32,49,54,46,53,48,50,53,32,55,46,49,53,57,57,55,32,49,
+54,46,57,55,51,51,32,53,46,57,48,52,52,57,76,49,55,46,53,32,52,46,53,77,54,46,53,32,52,46,53,76,55,46,48,50,54,54,57,32,
+53,46,57,48,52,52,57,67,55,46,52,57,55,52,57,32,55,46,49,53,57,57,55,32,55,46,55,51,50,56,57,32,55,46,55,56,55,55,32,56,
+46,50,52,54,56,49,32,56,46,49,52,51,56,53,67,56,46,52,53,57,49,32,56,46,50,57,48,57,55,32,56,46,54,57,56,48,57,32,56,46,
+51,55,55,51,49,32,57,32,56,46,52,50,55,57,57,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,
+107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,47,62,32,60,47,103,62,10,13,60,47,115,118,103,62,0 };
+
+const char* save_svg = (const char*) temp_binary_data_11;
+
+
+//================== start.svg ==================
+static const unsigned char temp_binary_data_12[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,112,97,116,104,32,100,61,34,77,51,32,49,50,76,51,32,49,56,46,57,54,55,49,67,51,32,50,49,46,50,55,54,51,32,53,46,
+53,51,52,51,53,32,50,50,46,55,51,54,32,55,46,53,57,54,54,50,32,50,49,46,54,49,52,53,76,49,48,46,55,57,57,54,32,49,57,46,
+56,55,50,55,77,51,32,56,76,51,32,53,46,48,51,50,57,67,51,32,50,46,55,50,51,54,56,32,53,46,53,51,52,51,53,32,49,46,50,54,
+52,48,50,32,55,46,53,57,54,54,49,32,50,46,51,56,53,52,56,76,50,48,46,52,48,56,54,32,57,46,51,53,50,53,56,67,50,50,46,53,
+51,48,53,32,49,48,46,53,48,54,53,32,50,50,46,53,51,48,53,32,49,51,46,52,57,51,53,32,50,48,46,52,48,56,54,32,49,52,46,54,
+52,55,52,76,49,52,46,48,48,50,54,32,49,56,46,49,51,49,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,
+111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,
+32,60,47,103,62,10,13,60,47,115,118,103,62,0 };
+
+const char* start_svg = (const char*) temp_binary_data_12;
+
+
+//================== startsong.svg ==================
+static const unsigned char temp_binary_data_13[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,112,97,116,104,32,100,61,34,77,50,50,32,49,49,76,50,50,32,49,56,46,57,54,55,49,67,50,50,32,50,49,46,50,55,54,51,
+32,49,57,46,56,54,53,56,32,50,50,46,55,51,54,32,49,56,46,49,50,57,50,32,50,49,46,54,49,52,53,76,55,46,51,52,48,49,54,32,
+49,52,46,54,52,55,52,67,53,46,53,53,51,50,56,32,49,51,46,52,57,51,53,32,53,46,53,53,51,50,56,32,49,48,46,53,48,54,53,32,
+55,46,51,52,48,49,53,32,57,46,51,53,50,53,56,76,49,56,46,49,50,57,50,32,50,46,51,56,53,52,56,67,49,57,46,56,54,53,56,32,
+49,46,50,54,52,48,50,32,50,50,32,50,46,55,50,51,54,56,32,50,50,32,53,46,48,51,50,56,57,86,55,34,32,115,116,114,111,107,101,61,
+34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,
+99,97,112,61,34,114,111,117,110,100,34,47,62,32,60,112,97,116,104,32,100,61,34,77,50,32,53,86,49,50,77,50,32,49,57,86,49,54,34,32,
+115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,
+107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,32,60,47,103,62,10,13,60,47,115,118,103,62,0 };
+
+const char* startsong_svg = (const char*) temp_binary_data_13;
+
+
+//================== stop.svg ==================
+static const unsigned char temp_binary_data_14[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,112,97,116,104,32,100,61,34,77,49,52,46,53,32,57,46,53,48,48,48,50,76,57,46,53,32,49,52,46,53,77,57,46,52,57,57,
+57,56,32,57,46,53,76,49,52,46,53,32,49,52,46,53,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,
+101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,32,60,
+112,97,116,104,32,100,61,34,77,55,32,51,46,51,51,55,56,50,67,56,46,52,55,48,56,55,32,50,46,52,56,54,57,55,32,49,48,46,49,55,
+56,54,32,50,32,49,50,32,50,67,49,55,46,53,50,50,56,32,50,32,50,50,32,54,46,52,55,55,49,53,32,50,50,32,49,50,67,50,50,32,
+49,55,46,53,50,50,56,32,49,55,46,53,50,50,56,32,50,50,32,49,50,32,50,50,67,54,46,52,55,55,49,53,32,50,50,32,50,32,49,55,
+46,53,50,50,56,32,50,32,49,50,67,50,32,49,48,46,49,55,56,54,32,50,46,52,56,54,57,55,32,56,46,52,55,48,56,55,32,51,46,51,
+51,55,56,50,32,55,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,
+46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,32,60,47,103,62,10,13,60,47,115,118,103,
+62,0 };
+
+const char* stop_svg = (const char*) temp_binary_data_14;
+
+
+//================== unmute.svg ==================
+static const unsigned char temp_binary_data_15[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,112,97,116,104,32,100,61,34,77,49,46,57,53,56,54,51,32,56,46,53,55,54,55,57,67,50,46,50,52,52,56,50,32,56,46,48,
+52,53,54,51,32,50,46,55,57,50,51,57,32,55,46,53,51,48,52,50,32,51,46,51,51,57,57,55,32,55,46,50,55,55,48,55,67,51,46,57,
+51,57,51,32,54,46,57,57,57,55,57,32,52,46,54,50,54,50,54,32,54,46,57,57,57,55,57,32,54,46,48,48,48,49,56,32,54,46,57,57,
+57,55,57,67,54,46,53,49,50,50,53,32,54,46,57,57,57,55,57,32,54,46,55,54,56,50,56,32,54,46,57,57,57,55,57,32,55,46,48,49,
+54,50,57,32,54,46,57,53,55,57,49,67,55,46,50,54,49,52,55,32,54,46,57,49,54,53,32,55,46,53,48,48,53,54,32,54,46,56,52,52,
+55,56,32,55,46,55,50,56,48,52,32,54,46,55,52,52,51,56,67,55,46,57,53,56,49,53,32,54,46,54,52,50,56,51,32,56,46,49,55,49,
+57,32,54,46,53,48,49,56,57,32,56,46,53,57,57,52,49,32,54,46,50,50,48,48,50,76,56,46,56,49,56,51,53,32,54,46,48,55,53,54,
+54,67,49,49,46,51,54,49,51,32,52,46,51,57,56,57,56,32,49,50,46,54,51,50,56,32,51,46,53,54,48,54,51,32,49,51,46,55,48,48,
+49,32,51,46,57,50,52,56,55,67,49,51,46,57,48,52,56,32,51,46,57,57,52,55,32,49,52,46,49,48,50,57,32,52,46,48,57,53,53,49,
+32,49,52,46,50,55,57,56,32,52,46,50,49,57,56,52,67,49,53,46,50,48,50,53,32,52,46,56,54,56,50,57,32,49,53,46,50,55,50,54,
+32,54,46,51,55,54,57,57,32,49,53,46,52,49,50,56,32,57,46,51,57,52,52,67,49,53,46,52,54,52,55,32,49,48,46,53,49,49,55,32,
+49,53,46,53,48,48,49,32,49,49,46,52,54,55,57,32,49,53,46,53,48,48,49,32,49,49,46,57,57,57,56,67,49,53,46,53,48,48,49,32,
+49,50,46,53,51,49,55,32,49,53,46,52,54,52,55,32,49,51,46,52,56,55,57,32,49,53,46,52,49,50,56,32,49,52,46,54,48,53,50,67,
+49,53,46,50,55,50,54,32,49,55,46,54,50,50,54,32,49,53,46,50,48,50,53,32,49,57,46,49,51,49,51,32,49,52,46,50,55,57,56,32,
+49,57,46,55,55,57,55,67,49,52,46,49,48,50,57,32,49,57,46,57,48,52,49,32,49,51,46,57,48,52,56,32,50,48,46,48,48,52,57,32,
+49,51,46,55,48,48,49,32,50,48,46,48,55,52,55,67,49,50,46,54,51,50,56,32,50,48,46,52,51,56,57,32,49,49,46,51,54,49,51,32,
+49,57,46,54,48,48,54,32,56,46,56,49,56,51,52,32,49,55,46,57,50,51,57,76,56,46,53,57,57,52,49,32,49,55,46,55,55,57,54,67,
+56,46,49,55,49,57,32,49,55,46,52,57,55,55,32,55,46,57,53,56,49,53,32,49,55,46,51,53,54,55,32,55,46,55,50,56,48,52,32,49,
+55,46,50,53,53,50,67,55,46,53,48,48,53,54,32,49,55,46,49,53,52,56,32,55,46,50,54,49,52,55,32,49,55,46,48,56,51,49,32,55,
+46,48,49,54,50,57,32,49,55,46,48,52,49,55,67,54,46,55,54,56,50,56,32,49,54,46,57,57,57,56,32,54,46,53,49,50,50,53,32,49,
+54,46,57,57,57,56,32,54,46,48,48,48,49,56,32,49,54,46,57,57,57,56,67,52,46,54,50,54,50,54,32,49,54,46,57,57,57,56,32,51,
+46,57,51,57,51,32,49,54,46,57,57,57,56,32,51,46,51,51,57,57,55,32,49,54,46,55,50,50,53,67,50,46,55,57,50,51,57,32,49,54,
+46,52,54,57,50,32,50,46,50,52,52,56,50,32,49,53,46,57,53,51,57,32,49,46,57,53,56,54,51,32,49,53,46,52,50,50,56,67,49,46,
+54,52,53,52,32,49,52,46,56,52,49,52,32,49,46,54,48,56,53,54,32,49,52,46,50,51,55,32,49,46,53,51,52,56,56,32,49,51,46,48,
+50,56,50,67,49,46,53,50,51,57,54,32,49,50,46,56,52,57,32,49,46,53,49,53,50,53,32,49,50,46,54,55,50,50,32,49,46,53,48,57,
+50,56,32,49,50,46,52,57,57,56,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,
+104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,32,60,112,97,116,104,32,100,
+61,34,77,50,50,32,49,48,76,49,56,32,49,52,77,49,56,32,49,48,76,50,50,32,49,52,34,32,115,116,114,111,107,101,61,34,35,70,69,69,
+55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,
+114,111,117,110,100,34,47,62,32,60,47,103,62,10,13,60,47,115,118,103,62,0 };
+
+const char* unmute_svg = (const char*) temp_binary_data_15;
+
+
+//================== upload.svg ==================
+static const unsigned char temp_binary_data_16[] =
+{ 60,33,68,79,67,84,89,80,69,32,115,118,103,32,80,85,66,76,73,67,32,34,45,47,47,87,51,67,47,47,68,84,68,32,83,86,71,32,49,46,
+49,47,47,69,78,34,32,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,71,114,97,112,104,105,99,115,47,83,86,71,47,49,
+46,49,47,68,84,68,47,115,118,103,49,49,46,100,116,100,34,62,10,60,33,45,45,32,85,112,108,111,97,100,101,100,32,116,111,58,32,83,86,71,
+32,82,101,112,111,44,32,119,119,119,46,115,118,103,114,101,112,111,46,99,111,109,44,32,84,114,97,110,115,102,111,114,109,101,100,32,98,121,58,32,
+83,86,71,32,82,101,112,111,32,77,105,120,101,114,32,84,111,111,108,115,32,45,45,62,10,60,115,118,103,32,119,105,100,116,104,61,34,56,48,48,
+112,120,34,32,104,101,105,103,104,116,61,34,56,48,48,112,120,34,32,118,105,101,119,66,111,120,61,34,48,32,48,32,50,52,32,50,52,34,32,102,
+105,108,108,61,34,110,111,110,101,34,32,120,109,108,110,115,61,34,104,116,116,112,58,47,47,119,119,119,46,119,51,46,111,114,103,47,50,48,48,48,
+47,115,118,103,34,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,98,103,67,97,114,114,105,101,114,34,32,115,116,114,111,107,101,
+45,119,105,100,116,104,61,34,48,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,116,114,97,99,101,114,67,97,114,114,105,
+101,114,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,
+105,110,61,34,114,111,117,110,100,34,47,62,10,13,60,103,32,105,100,61,34,83,86,71,82,101,112,111,95,105,99,111,110,67,97,114,114,105,101,114,
+34,62,32,60,112,97,116,104,32,100,61,34,77,49,50,32,49,53,67,49,50,32,49,54,46,49,48,52,54,32,49,49,46,49,48,52,54,32,49,55,
+32,49,48,32,49,55,67,56,46,56,57,53,52,51,32,49,55,32,56,32,49,54,46,49,48,52,54,32,56,32,49,53,67,56,32,49,51,46,56,57,
+53,52,32,56,46,56,57,53,52,51,32,49,51,32,49,48,32,49,51,67,49,49,46,49,48,52,54,32,49,51,32,49,50,32,49,51,46,56,57,53,
+52,32,49,50,32,49,53,90,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,
+34,49,46,53,34,47,62,32,60,112,97,116,104,32,100,61,34,77,49,50,32,49,53,86,57,34,32,115,116,114,111,107,101,61,34,35,70,69,69,55,
+49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,47,62,32,60,112,97,116,104,32,100,61,34,77,49,52,46,48,53,
+56,52,32,49,49,46,48,50,57,52,76,49,50,46,55,52,49,54,32,49,48,46,51,55,49,67,49,50,46,53,53,57,50,32,49,48,46,50,55,57,
+56,32,49,50,46,52,54,56,32,49,48,46,50,51,52,50,32,49,50,46,51,57,50,54,32,49,48,46,49,55,54,53,67,49,50,46,49,57,55,52,
+32,49,48,46,48,50,55,51,32,49,50,46,48,54,52,32,57,46,56,49,49,52,53,32,49,50,46,48,49,55,56,32,57,46,53,55,48,49,52,67,
+49,50,32,57,46,52,55,54,57,57,32,49,50,32,57,46,51,55,52,57,57,32,49,50,32,57,46,49,55,49,67,49,50,32,56,46,54,56,53,52,
+53,32,49,50,32,56,46,52,52,50,54,56,32,49,50,46,48,53,57,56,32,56,46,50,55,55,54,52,67,49,50,46,50,49,55,56,32,55,46,56,
+52,49,52,52,32,49,50,46,54,53,53,49,32,55,46,53,55,49,49,57,32,49,51,46,49,49,53,57,32,55,46,54,50,52,57,53,67,49,51,46,
+50,57,48,50,32,55,46,54,52,53,50,56,32,49,51,46,53,48,55,52,32,55,46,55,53,51,56,53,32,49,51,46,57,52,49,54,32,55,46,57,
+55,49,76,49,53,46,50,53,56,52,32,56,46,54,50,57,51,54,67,49,53,46,52,52,48,56,32,56,46,55,50,48,53,56,32,49,53,46,53,51,
+50,32,56,46,55,54,54,50,32,49,53,46,54,48,55,52,32,56,46,56,50,51,56,49,67,49,53,46,56,48,50,54,32,56,46,57,55,51,48,52,
+32,49,53,46,57,51,54,32,57,46,49,56,56,57,32,49,53,46,57,56,50,50,32,57,46,52,51,48,50,49,67,49,54,32,57,46,53,50,51,51,
+55,32,49,54,32,57,46,54,50,53,51,54,32,49,54,32,57,46,56,50,57,51,54,67,49,54,32,49,48,46,51,49,52,57,32,49,54,32,49,48,
+46,53,53,55,55,32,49,53,46,57,52,48,50,32,49,48,46,55,50,50,55,67,49,53,46,55,56,50,50,32,49,49,46,49,53,56,57,32,49,53,
+46,51,52,52,57,32,49,49,46,52,50,57,50,32,49,52,46,56,56,52,49,32,49,49,46,51,55,53,52,67,49,52,46,55,48,57,56,32,49,49,
+46,51,53,53,49,32,49,52,46,52,57,50,54,32,49,49,46,50,52,54,53,32,49,52,46,48,53,56,52,32,49,49,46,48,50,57,52,90,34,32,
+115,116,114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,
+107,101,45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,32,60,112,97,116,104,32,100,61,34,77,49,52,32,50,49,46,56,67,49,
+51,46,51,53,51,56,32,50,49,46,57,51,49,49,32,49,50,46,54,56,52,57,32,50,50,32,49,50,32,50,50,67,54,46,52,55,55,49,53,32,
+50,50,32,50,32,49,55,46,53,50,50,56,32,50,32,49,50,67,50,32,49,48,46,49,55,56,54,32,50,46,52,56,54,57,55,32,56,46,52,55,
+48,56,55,32,51,46,51,51,55,56,50,32,55,77,50,49,46,56,32,49,52,67,50,49,46,57,51,49,49,32,49,51,46,51,53,51,56,32,50,50,
+32,49,50,46,54,56,52,57,32,50,50,32,49,50,67,50,50,32,54,46,52,55,55,49,53,32,49,55,46,53,50,50,56,32,50,32,49,50,32,50,
+67,49,48,46,49,55,56,54,32,50,32,56,46,52,55,48,56,55,32,50,46,52,56,54,57,55,32,55,32,51,46,51,51,55,56,50,34,32,115,116,
+114,111,107,101,61,34,35,70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,
+45,108,105,110,101,99,97,112,61,34,114,111,117,110,100,34,47,62,32,60,112,97,116,104,32,100,61,34,77,49,56,32,50,50,86,49,53,77,49,56,
+32,49,53,76,50,48,46,53,32,49,55,46,53,77,49,56,32,49,53,76,49,53,46,53,32,49,55,46,53,34,32,115,116,114,111,107,101,61,34,35,
+70,69,69,55,49,53,34,32,115,116,114,111,107,101,45,119,105,100,116,104,61,34,49,46,53,34,32,115,116,114,111,107,101,45,108,105,110,101,99,97,
+112,61,34,114,111,117,110,100,34,32,115,116,114,111,107,101,45,108,105,110,101,106,111,105,110,61,34,114,111,117,110,100,34,47,62,32,60,47,103,62,
+10,13,60,47,115,118,103,62,0 };
+
+const char* upload_svg = (const char*) temp_binary_data_16;
+
+
+const char* getNamedResource (const char* resourceNameUTF8, int& numBytes);
+const char* getNamedResource (const char* resourceNameUTF8, int& numBytes)
+{
+    unsigned int hash = 0;
+
+    if (resourceNameUTF8 != nullptr)
+        while (*resourceNameUTF8 != 0)
+            hash = 31 * hash + (unsigned int) *resourceNameUTF8++;
+
+    switch (hash)
+    {
+        case 0xd89a1d6a:  numBytes = 2216; return abloop_svg;
+        case 0xeac91008:  numBytes = 1123; return backward_svg;
+        case 0xfc0cce15:  numBytes = 790; return endsong_svg;
+        case 0x628f95ea:  numBytes = 1078; return forward_svg;
+        case 0x8693c249:  numBytes = 3244; return loop_svg;
+        case 0x4280d4df:  numBytes = 979; return marker_svg;
+        case 0x3b374d2e:  numBytes = 4166; return mixer_svg;
+        case 0x33c78b3e:  numBytes = 1767; return mute_svg;
+        case 0x3175289b:  numBytes = 1129; return pause_svg;
+        case 0x229a3677:  numBytes = 4772; return playlist_svg;
+        case 0x2febec34:  numBytes = 971; return restart_svg;
+        case 0x847ba8a2:  numBytes = 1674; return save_svg;
+        case 0x811ab107:  numBytes = 733; return start_svg;
+        case 0x5f41929c:  numBytes = 793; return startsong_svg;
+        case 0x663b24a7:  numBytes = 801; return stop_svg;
+        case 0x8ebff0d7:  numBytes = 1621; return unmute_svg;
+        case 0xf1881326:  numBytes = 1728; return upload_svg;
+        default: break;
+    }
+
+    numBytes = 0;
+    return nullptr;
+}
+
+const char* namedResourceList[] =
+{
+    "abloop_svg",
+    "backward_svg",
+    "endsong_svg",
+    "forward_svg",
+    "loop_svg",
+    "marker_svg",
+    "mixer_svg",
+    "mute_svg",
+    "pause_svg",
+    "playlist_svg",
+    "restart_svg",
+    "save_svg",
+    "start_svg",
+    "startsong_svg",
+    "stop_svg",
+    "unmute_svg",
+    "upload_svg",
+};
+
+const char* originalFilenames[] =
+{
+    "abloop.svg",
+    "backward.svg",
+    "endsong.svg",
+    "forward.svg",
+    "loop.svg",
+    "marker.svg",
+    "mixer.svg",
+    "mute.svg",
+    "pause.svg",
+    "playlist.svg",
+    "restart.svg",
+    "save.svg",
+    "start.svg",
+    "startsong.svg",
+    "stop.svg",
+    "unmute.svg",
+    "upload.svg",
+};
+
+const char* getNamedResourceOriginalFilename (const char* resourceNameUTF8);
+const char* getNamedResourceOriginalFilename (const char* resourceNameUTF8)
+{
+    for (unsigned int i = 0; i < (sizeof (namedResourceList) / sizeof (namedResourceList[0])); ++i)
+        if (strcmp (namedResourceList[i], resourceNameUTF8) == 0)
+            return originalFilenames[i];
+
+    return nullptr;
+}
+
+}
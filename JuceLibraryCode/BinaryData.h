@@ -0,0 +1,78 @@
+/* =========================================================================================
+
+   This is an auto-generated file: Any edits you make may be overwritten!
+
+*/
+
+#pragma once
+
+namespace BinaryData
+{
+    extern const char*   abloop_svg;
+    const int            abloop_svgSize = 2216;
+
+    extern const char*   backward_svg;
+    const int            backward_svgSize = 1123;
+
+    extern const char*   endsong_svg;
+    const int            endsong_svgSize = 790;
+
+    extern const char*   forward_svg;
+    const int            forward_svgSize = 1078;
+
+    extern const char*   loop_svg;
+    const int            loop_svgSize = 3244;
+
+    extern const char*   marker_svg;
+    const int            marker_svgSize = 979;
+
+    extern const char*   mixer_svg;
+    const int            mixer_svgSize = 4166;
+
+    extern const char*   mute_svg;
+    const int            mute_svgSize = 1767;
+
+    extern const char*   pause_svg;
+    const int            pause_svgSize = 1129;
+
+    extern const char*   playlist_svg;
+    const int            playlist_svgSize = 4772;
+
+    extern const char*   restart_svg;
+    const int            restart_svgSize = 971;
+
+    extern const char*   save_svg;
+    const int            save_svgSize = 1674;
+
+    extern const char*   start_svg;
+    const int            start_svgSize = 733;
+
+    extern const char*   startsong_svg;
+    const int            startsong_svgSize = 793;
+
+    extern const char*   stop_svg;
+    const int            stop_svgSize = 801;
+
+    extern const char*   unmute_svg;
+    const int            unmute_svgSize = 1621;
+
+    extern const char*   upload_svg;
+    const int            upload_svgSize = 1728;
+
+    // Number of elements in the namedResourceList and originalFileNames arrays.
+    const int namedResourceListSize = 17;
+
+    // Points to the start of a list of resource names.
+    extern const char* namedResourceList[];
+
+    // Points to the start of a list of resource filenames.
+    extern const char* originalFilenames[];
+
+    // If you provide the name of one of the binary resource variables above, this function will
+    // return the corresponding data and its size (or a null pointer if the name isn't found).
+    const char* getNamedResource (const char* resourceNameUTF8, int& dataSizeInBytes);
+
+    // If you provide the name of one of the binary resource variables above, this function will
+    // return the corresponding original, non-mangled filename (or a null pointer if the name isn't found).
+    const char* getNamedResourceOriginalFilename (const char* resourceNameUTF8);
+}
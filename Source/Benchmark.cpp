@@ -0,0 +1,457 @@
+// Console benchmark for the playback pipeline, built by "make benchmark" as a
+// separate executable. Prints one JSON document so results can be diffed
+// between releases.
+
+#include <JuceHeader.h>
+#include <iostream>
+#include "PlayerAudio.h"
+#include "TempoAnalyser.h"
+
+namespace
+{
+    constexpr double benchSampleRate = 44100.0;
+    constexpr int benchBlockSize = 512;
+
+    struct Options
+    {
+        juce::Array<juce::File> inputs;
+        juce::File outputFile;
+        double seconds = 20.0;
+        int seekCount = 50;
+        int loadCount = 5;
+    };
+
+    double secondsSince(juce::int64 startTicks)
+    {
+        return juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks);
+    }
+
+    juce::var makeResult(const juce::String& group, const juce::String& name)
+    {
+        auto* result = new juce::DynamicObject();
+        result->setProperty("group", group);
+        result->setProperty("name", name);
+        return juce::var(result);
+    }
+
+    void addTimingStats(juce::var& result, std::vector<double> timesMs)
+    {
+        if (timesMs.empty())
+            return;
+
+        std::sort(timesMs.begin(), timesMs.end());
+        double total = 0.0;
+        for (auto t : timesMs)
+            total += t;
+
+        auto* object = result.getDynamicObject();
+        object->setProperty("count", (int)timesMs.size());
+        object->setProperty("meanMs", total / (double)timesMs.size());
+        object->setProperty("p50Ms", timesMs[timesMs.size() / 2]);
+        object->setProperty("p95Ms", timesMs[juce::jmin(timesMs.size() - 1, (size_t)((double)timesMs.size() * 0.95))]);
+        object->setProperty("maxMs", timesMs.back());
+    }
+
+    juce::File createTestFile(juce::AudioFormat& format, const juce::File& directory, double seconds)
+    {
+        auto file = directory.getChildFile("bench" + format.getFileExtensions()[0]);
+        if (file.existsAsFile())
+            return file;
+
+        std::unique_ptr<juce::OutputStream> stream = file.createOutputStream();
+        if (stream == nullptr)
+            return {};
+
+        auto qualityIndex = format.getQualityOptions().isEmpty() ? 0 : format.getQualityOptions().size() / 2;
+        std::unique_ptr<juce::AudioFormatWriter> writer(format.createWriterFor(stream.get(), benchSampleRate, 2, 16, {}, qualityIndex));
+        if (writer == nullptr)
+        {
+            stream.reset();
+            file.deleteFile();
+            return {};
+        }
+        stream.release();
+
+        juce::Random random(1234);
+        juce::AudioBuffer<float> buffer(2, 4096);
+        auto total = (juce::int64)(seconds * benchSampleRate);
+        for (juce::int64 pos = 0; pos < total; pos += buffer.getNumSamples())
+        {
+            int numSamples = (int)juce::jmin((juce::int64)buffer.getNumSamples(), total - pos);
+            for (int ch = 0; ch < 2; ++ch)
+            {
+                auto* data = buffer.getWritePointer(ch);
+                for (int i = 0; i < numSamples; ++i)
+                {
+                    double t = (double)(pos + i) / benchSampleRate;
+                    data[i] = (float)(0.3 * std::sin(juce::MathConstants<double>::twoPi * (220.0 + 110.0 * ch) * t)
+                                      + 0.2 * std::sin(juce::MathConstants<double>::twoPi * 3520.0 * t)
+                                      + 0.05 * (random.nextFloat() * 2.0f - 1.0f));
+                }
+            }
+            writer->writeFromAudioSampleBuffer(buffer, 0, numSamples);
+        }
+        return file;
+    }
+
+    juce::Array<juce::File> createTestFiles(const juce::File& directory, double seconds)
+    {
+        directory.createDirectory();
+
+        juce::OwnedArray<juce::AudioFormat> writers;
+        writers.add(new juce::WavAudioFormat());
+        writers.add(new juce::AiffAudioFormat());
+        writers.add(new juce::FlacAudioFormat());
+        writers.add(new juce::OggVorbisAudioFormat());
+
+        juce::Array<juce::File> files;
+        for (auto* format : writers)
+        {
+            auto file = createTestFile(*format, directory, seconds);
+            if (file.existsAsFile())
+                files.add(file);
+        }
+        return files;
+    }
+
+    double pull(PlayerAudio& audio, double seconds)
+    {
+        juce::AudioBuffer<float> buffer(2, benchBlockSize);
+        auto total = (juce::int64)(seconds * benchSampleRate);
+        auto startTicks = juce::Time::getHighResolutionTicks();
+        for (juce::int64 done = 0; done < total; done += benchBlockSize)
+            audio.getNextAudioBlock(juce::AudioSourceChannelInfo(&buffer, 0, benchBlockSize));
+        return secondsSince(startTicks);
+    }
+
+    void resetDecks(PlayerAudio& audio)
+    {
+        audio.stop();
+        for (int i = 0; i < audio.getNumDecks(); ++i)
+        {
+            audio.getDeck(i).setSpeed(1.0);
+            audio.getDeck(i).setTimeStretchQuality(TimeStretchSource::Quality::off);
+            audio.getDeck(i).clearTrack();
+        }
+        pull(audio, 0.01);
+    }
+
+    juce::var benchmarkDecode(juce::AudioFormatManager& formats, const juce::File& file)
+    {
+        std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(file));
+        if (reader == nullptr)
+            return {};
+
+        auto result = makeResult("decode", reader->getFormatName());
+        juce::AudioBuffer<float> buffer((int)reader->numChannels, 8192);
+        auto startTicks = juce::Time::getHighResolutionTicks();
+        for (juce::int64 pos = 0; pos < reader->lengthInSamples; pos += buffer.getNumSamples())
+            reader->read(&buffer, 0, buffer.getNumSamples(), pos, true, true);
+        double elapsed = secondsSince(startTicks);
+
+        double audioSeconds = (double)reader->lengthInSamples / reader->sampleRate;
+        auto* object = result.getDynamicObject();
+        object->setProperty("file", file.getFileName());
+        object->setProperty("audioSeconds", audioSeconds);
+        object->setProperty("elapsedSeconds", elapsed);
+        object->setProperty("realtimeFactor", elapsed > 0.0 ? audioSeconds / elapsed : 0.0);
+        return result;
+    }
+
+    juce::var benchmarkTempo(juce::AudioFormatManager& formats, const juce::File& file)
+    {
+        std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(file));
+        if (reader == nullptr)
+            return {};
+
+        auto result = makeResult("tempo", file.getFileName());
+        TempoEstimate estimate;
+        auto startTicks = juce::Time::getHighResolutionTicks();
+        estimate.analyse(*reader, [] { return false; });
+        double elapsed = secondsSince(startTicks);
+
+        double audioSeconds = (double)reader->lengthInSamples / reader->sampleRate;
+        auto* object = result.getDynamicObject();
+        object->setProperty("audioSeconds", audioSeconds);
+        object->setProperty("elapsedSeconds", elapsed);
+        object->setProperty("realtimeFactor", elapsed > 0.0 ? audioSeconds / elapsed : 0.0);
+        object->setProperty("bpm", estimate.getInfo().bpm);
+        return result;
+    }
+
+    juce::var benchmarkLoudness(juce::AudioFormatManager& formats, const juce::File& file)
+    {
+        std::unique_ptr<juce::AudioFormatReader> reader(formats.createReaderFor(file));
+        if (reader == nullptr)
+            return {};
+
+        auto result = makeResult("loudness", file.getFileName());
+        TrackLoudness loudness;
+        auto startTicks = juce::Time::getHighResolutionTicks();
+        LoudnessScanner::analyse(*reader, [] { return false; }, loudness);
+        double elapsed = secondsSince(startTicks);
+
+        double audioSeconds = (double)reader->lengthInSamples / reader->sampleRate;
+        auto* object = result.getDynamicObject();
+        object->setProperty("audioSeconds", audioSeconds);
+        object->setProperty("elapsedSeconds", elapsed);
+        object->setProperty("realtimeFactor", elapsed > 0.0 ? audioSeconds / elapsed : 0.0);
+        object->setProperty("integratedLufs", loudness.integratedLufs);
+        object->setProperty("truePeakDb", loudness.truePeakDb);
+        return result;
+    }
+
+    juce::var benchmarkLoad(PlayerAudio& audio, const juce::File& file, int repetitions)
+    {
+        auto result = makeResult("load", audio.getFormatManager().findFormatForFileExtension(file.getFileExtension())->getFormatName());
+        result.getDynamicObject()->setProperty("file", file.getFileName());
+
+        std::vector<double> openMs, firstSampleMs;
+        juce::AudioBuffer<float> buffer(2, benchBlockSize);
+        for (int i = 0; i < repetitions; ++i)
+        {
+            resetDecks(audio);
+            auto startTicks = juce::Time::getHighResolutionTicks();
+            audio.loadFile(PlayerAudio::mainDeckIndex, file);
+            openMs.push_back(secondsSince(startTicks) * 1000.0);
+            audio.play();
+            audio.getNextAudioBlock(juce::AudioSourceChannelInfo(&buffer, 0, benchBlockSize));
+            firstSampleMs.push_back(secondsSince(startTicks) * 1000.0);
+        }
+
+        addTimingStats(result, firstSampleMs);
+        std::sort(openMs.begin(), openMs.end());
+        result.getDynamicObject()->setProperty("openP50Ms", openMs[openMs.size() / 2]);
+        return result;
+    }
+
+    juce::var benchmarkPlayback(PlayerAudio& audio, const juce::String& name, const juce::File& main, const juce::File& mixer,
+                                double speed, double seconds, TimeStretchSource::Quality stretch = TimeStretchSource::Quality::off)
+    {
+        resetDecks(audio);
+        audio.loadFile(PlayerAudio::mainDeckIndex, main);
+        audio.getDeck(PlayerAudio::mainDeckIndex).setSpeed(speed);
+        audio.getDeck(PlayerAudio::mainDeckIndex).setTimeStretchQuality(stretch);
+        if (mixer != juce::File())
+        {
+            audio.loadFile(PlayerAudio::mixerDeckIndex, mixer);
+            audio.getDeck(PlayerAudio::mixerDeckIndex).setSpeed(speed);
+            audio.getDeck(PlayerAudio::mixerDeckIndex).setTimeStretchQuality(stretch);
+        }
+        audio.setLooping(true);
+        audio.play();
+
+        double elapsed = pull(audio, seconds);
+        audio.setLooping(false);
+
+        auto result = makeResult(mixer != juce::File() ? "mix" : "playback", name);
+        auto* object = result.getDynamicObject();
+        object->setProperty("speed", speed);
+        object->setProperty("stretch", (int)stretch);
+        object->setProperty("audioSeconds", seconds);
+        object->setProperty("elapsedSeconds", elapsed);
+        object->setProperty("realtimeFactor", elapsed > 0.0 ? seconds / elapsed : 0.0);
+        object->setProperty("msPerBlock", elapsed * 1000.0 * benchBlockSize / (seconds * benchSampleRate));
+        return result;
+    }
+
+    juce::var benchmarkSeek(PlayerAudio& audio, const juce::File& file, int count)
+    {
+        resetDecks(audio);
+        audio.loadFile(PlayerAudio::mainDeckIndex, file);
+        audio.play();
+
+        auto& deck = audio.getDeck(PlayerAudio::mainDeckIndex);
+        double length = deck.getLengthInSeconds();
+        juce::Random random(42);
+        juce::AudioBuffer<float> buffer(2, benchBlockSize);
+        std::vector<double> timesMs;
+        for (int i = 0; i < count; ++i)
+        {
+            auto startTicks = juce::Time::getHighResolutionTicks();
+            deck.setPosition(random.nextDouble() * length * 0.9);
+            audio.getNextAudioBlock(juce::AudioSourceChannelInfo(&buffer, 0, benchBlockSize));
+            timesMs.push_back(secondsSince(startTicks) * 1000.0);
+        }
+
+        auto result = makeResult("seek", deck.getReader() != nullptr ? deck.getReader()->getFormatName() : juce::String());
+        result.getDynamicObject()->setProperty("file", file.getFileName());
+        addTimingStats(result, timesMs);
+        return result;
+    }
+
+    // Compares the old per-deck JUCE ramp calls with the fused MixKernels pair
+    // mix, both with gains ramping on every block.
+    juce::Array<juce::var> benchmarkMixKernels(int iterations)
+    {
+        juce::AudioBuffer<float> output(2, benchBlockSize), other(2, benchBlockSize);
+        juce::Random random(7);
+        for (int ch = 0; ch < 2; ++ch)
+            for (int i = 0; i < benchBlockSize; ++i)
+                other.setSample(ch, i, random.nextFloat() * 2.0f - 1.0f);
+
+        auto fill = [&output, &other]
+        {
+            for (int ch = 0; ch < 2; ++ch)
+                output.copyFrom(ch, 0, other, 1 - ch, 0, benchBlockSize);
+        };
+
+        auto startTicks = juce::Time::getHighResolutionTicks();
+        for (int i = 0; i < iterations; ++i)
+        {
+            fill();
+            float from = (i & 1) ? 0.2f : 0.8f;
+            output.applyGainRamp(0, benchBlockSize, from, 1.0f - from);
+            for (int ch = 0; ch < 2; ++ch)
+                output.addFromWithRamp(ch, 0, other.getReadPointer(ch), benchBlockSize, 1.0f - from, from);
+        }
+        double juceSeconds = secondsSince(startTicks);
+
+        MixKernels::GainRamp rampA, rampB;
+        rampA.prepare(benchSampleRate, (double)benchBlockSize / benchSampleRate);
+        rampB.prepare(benchSampleRate, (double)benchBlockSize / benchSampleRate);
+        startTicks = juce::Time::getHighResolutionTicks();
+        for (int i = 0; i < iterations; ++i)
+        {
+            fill();
+            float to = (i & 1) ? 0.8f : 0.2f;
+            rampA.setTarget(to);
+            rampB.setTarget(1.0f - to);
+            MixKernels::mixPair(output, 0, rampA, other, 0, rampB, benchBlockSize);
+        }
+        double kernelSeconds = secondsSince(startTicks);
+
+        startTicks = juce::Time::getHighResolutionTicks();
+        for (int i = 0; i < iterations; ++i)
+            fill();
+        double fillSeconds = secondsSince(startTicks);
+
+        auto makeKernelResult = [iterations, fillSeconds](const juce::String& name, double seconds)
+        {
+            auto result = makeResult("mix-kernel", name);
+            result.getDynamicObject()->setProperty("nsPerBlock", juce::jmax(0.0, seconds - fillSeconds) * 1.0e9 / iterations);
+            return result;
+        };
+
+        juce::Array<juce::var> results;
+        results.add(makeKernelResult("juce-ramps", juceSeconds));
+        auto fused = makeKernelResult(juce::String("fused-") + MixKernels::getInstructionSet(), kernelSeconds);
+        fused.getDynamicObject()->setProperty("speedup", kernelSeconds > fillSeconds ? (juceSeconds - fillSeconds) / (kernelSeconds - fillSeconds) : 0.0);
+        results.add(fused);
+        return results;
+    }
+
+    // A loud block takes the true-peak path, a quiet one skips it.
+    juce::Array<juce::var> benchmarkLevelMeter(int iterations)
+    {
+        juce::AudioBuffer<float> buffer(2, benchBlockSize);
+        juce::Random random(11);
+        for (int ch = 0; ch < 2; ++ch)
+            for (int i = 0; i < benchBlockSize; ++i)
+                buffer.setSample(ch, i, random.nextFloat() * 2.0f - 1.0f);
+
+        juce::Array<juce::var> results;
+        for (auto gain : { 1.0f, 0.1f })
+        {
+            LevelMeter meter;
+            meter.prepare(benchSampleRate);
+            auto startTicks = juce::Time::getHighResolutionTicks();
+            for (int i = 0; i < iterations; ++i)
+                meter.process(buffer, 0, benchBlockSize, gain);
+            double seconds = secondsSince(startTicks);
+
+            auto result = makeResult("level-meter", gain >= 1.0f ? "loud" : "quiet");
+            double nsPerBlock = seconds * 1.0e9 / iterations;
+            result.getDynamicObject()->setProperty("nsPerBlock", nsPerBlock);
+            result.getDynamicObject()->setProperty("budgetPercent", nsPerBlock / (benchBlockSize / benchSampleRate * 1.0e9) * 100.0);
+            results.add(result);
+        }
+        return results;
+    }
+
+    Options parseOptions(const juce::ArgumentList& args)
+    {
+        Options options;
+        for (const auto& arg : args.arguments)
+            if (!arg.isOption())
+                options.inputs.add(juce::File::getCurrentWorkingDirectory().getChildFile(arg.text.unquoted()));
+
+        auto out = args.getValueForOption("--out");
+        if (out.isNotEmpty())
+            options.outputFile = juce::File::getCurrentWorkingDirectory().getChildFile(out.unquoted());
+        if (args.containsOption("--seconds"))
+            options.seconds = juce::jmax(1.0, args.getValueForOption("--seconds").getDoubleValue());
+        if (args.containsOption("--seeks"))
+            options.seekCount = juce::jmax(1, args.getValueForOption("--seeks").getIntValue());
+        if (args.containsOption("--loads"))
+            options.loadCount = juce::jmax(1, args.getValueForOption("--loads").getIntValue());
+        return options;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    juce::ArgumentList args(argc, argv);
+    auto options = parseOptions(args);
+
+    auto testDirectory = juce::File::getSpecialLocation(juce::File::tempDirectory).getChildFile("audioPlayerBenchmark");
+    auto files = createTestFiles(testDirectory, options.seconds);
+    files.addArray(options.inputs);
+
+    PlayerAudio audio;
+    audio.setOfflineRendering(true);
+    audio.setNormalisation(false);
+    audio.prepareToPlay(benchBlockSize, benchSampleRate);
+
+    juce::Array<juce::var> results;
+    for (const auto& file : files)
+    {
+        auto* format = audio.getFormatManager().findFormatForFileExtension(file.getFileExtension());
+        if (!file.existsAsFile() || format == nullptr)
+        {
+            std::cerr << "Skipping " << file.getFullPathName() << "\n";
+            continue;
+        }
+
+        results.add(benchmarkDecode(audio.getFormatManager(), file));
+        results.add(benchmarkTempo(audio.getFormatManager(), file));
+        results.add(benchmarkLoudness(audio.getFormatManager(), file));
+        results.add(benchmarkLoad(audio, file, options.loadCount));
+        results.add(benchmarkSeek(audio, file, options.seekCount));
+    }
+
+    if (!files.isEmpty())
+    {
+        auto wav = files.getFirst();
+        for (double speed : { 0.5, 0.75, 1.0, 1.25, 1.5, 2.0 })
+            results.add(benchmarkPlayback(audio, "resample", wav, {}, speed, options.seconds));
+
+        auto mixer = files.size() > 1 ? files[1] : wav;
+        results.add(benchmarkPlayback(audio, "two-deck", wav, mixer, 1.0, options.seconds));
+
+        for (auto quality : { TimeStretchSource::Quality::fast, TimeStretchSource::Quality::normal, TimeStretchSource::Quality::high })
+            for (double speed : { 0.75, 1.25 })
+                results.add(benchmarkPlayback(audio, "two-deck-stretch", wav, mixer, speed, options.seconds, quality));
+    }
+
+    results.addArray(benchmarkMixKernels(200000));
+    results.addArray(benchmarkLevelMeter(20000));
+
+    resetDecks(audio);
+    audio.releaseResources();
+
+    auto* root = new juce::DynamicObject();
+    root->setProperty("version", 1);
+    root->setProperty("time", juce::Time::getCurrentTime().toISO8601(true));
+    root->setProperty("sampleRate", benchSampleRate);
+    root->setProperty("blockSize", benchBlockSize);
+    root->setProperty("perf", juce::JSON::parse(audio.getPerfSnapshot().toJson()));
+    root->setProperty("results", results);
+
+    auto json = juce::JSON::toString(juce::var(root));
+    if (options.outputFile != juce::File())
+        options.outputFile.replaceWithText(json);
+    std::cout << json << std::endl;
+    return 0;
+}
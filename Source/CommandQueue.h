@@ -0,0 +1,106 @@
+#pragma once
+#include <JuceHeader.h>
+
+struct ControlCommand
+{
+    enum class Type
+    {
+        start,
+        stop,
+        setPosition,
+        jump,
+        setGain,
+        setTrackGain,
+        setSpeed,
+        setMuted,
+        setTimeStretch,
+        setMasterMuted
+    };
+
+    // Target of transport commands that every deck applies in the same block.
+    static constexpr int allDecks = -2;
+
+    Type type = Type::stop;
+    int target = -1;
+    double value = 0.0;
+    // Output sample at which to apply the command; anything already due is
+    // applied at the start of the next block.
+    juce::int64 time = -1;
+};
+
+// Single-producer/single-consumer queue: the message thread pushes, the audio
+// thread drains. Neither side ever blocks. Commands pushed between beginBatch()
+// and endBatch() are staged and published together, so the audio thread never
+// sees only part of a batch; a batch that does not fit is dropped whole.
+template <typename Command, int capacity = 512, int maxBatchSize = 64>
+class CommandQueue
+{
+public:
+    bool push(const Command& command)
+    {
+        if (batching)
+        {
+            if (numStaged == maxBatchSize)
+            {
+                overflowed = true;
+                return false;
+            }
+            staged[(size_t)numStaged++] = command;
+            return true;
+        }
+
+        const auto scope = fifo.write(1);
+        if (scope.blockSize1 > 0)
+            commands[(size_t)scope.startIndex1] = command;
+        else if (scope.blockSize2 > 0)
+            commands[(size_t)scope.startIndex2] = command;
+        else
+            return false;
+        return true;
+    }
+
+    void beginBatch()
+    {
+        jassert(!batching);
+        batching = true;
+        overflowed = false;
+        numStaged = 0;
+    }
+
+    bool endBatch(juce::int64 time = -1)
+    {
+        jassert(batching);
+        batching = false;
+        if (overflowed || fifo.getFreeSpace() < numStaged)
+            return false;
+
+        const auto scope = fifo.write(numStaged);
+        for (int i = 0; i < numStaged; ++i)
+        {
+            int index = i < scope.blockSize1 ? scope.startIndex1 + i : scope.startIndex2 + (i - scope.blockSize1);
+            commands[(size_t)index] = staged[(size_t)i];
+            commands[(size_t)index].time = time;
+        }
+        return true;
+    }
+
+    template <typename Handler>
+    void drain(Handler&& handler)
+    {
+        const auto scope = fifo.read(fifo.getNumReady());
+        for (int i = 0; i < scope.blockSize1; ++i)
+            handler(commands[(size_t)(scope.startIndex1 + i)]);
+        for (int i = 0; i < scope.blockSize2; ++i)
+            handler(commands[(size_t)(scope.startIndex2 + i)]);
+    }
+
+private:
+    juce::AbstractFifo fifo { capacity };
+    std::array<Command, (size_t)capacity> commands {};
+    std::array<Command, (size_t)maxBatchSize> staged {};
+    int numStaged = 0;
+    bool batching = false;
+    bool overflowed = false;
+};
+
+using ControlQueue = CommandQueue<ControlCommand>;
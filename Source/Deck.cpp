@@ -0,0 +1,423 @@
+#include "Deck.h"
+
+Deck::Deck(ControlQueue& commandQueue, int deckId) : commands(commandQueue), id(deckId)
+{
+}
+
+Deck::~Deck()
+{
+    clearTrack();
+}
+
+void Deck::prepareToPlay(int samplesPerBlockExpected, double sampleRate)
+{
+    const juce::ScopedLock sl(lock);
+    blockSize = samplesPerBlockExpected;
+    outputSampleRate = sampleRate;
+    gainRamp.prepare(sampleRate, 0.015);
+    meter.prepare(sampleRate);
+    prepareResampler();
+}
+
+void Deck::releaseResources()
+{
+    const juce::ScopedLock sl(lock);
+    resampler.releaseResources();
+}
+
+double Deck::getBaseRatio() const
+{
+    double source = sourceSampleRate.load();
+    double output = outputSampleRate.load();
+    return source > 0.0 && output > 0.0 ? source / output : 1.0;
+}
+
+double Deck::getPlaybackRatio() const
+{
+    // With pitch-preserving stretch on, tempo is handled before the resampler,
+    // which then only converts the sample rate.
+    return stretcher.isActive() ? getBaseRatio() : getBaseRatio() * speed.load();
+}
+
+void Deck::prepareResampler()
+{
+    if (blockSize <= 0 || outputSampleRate.load() <= 0.0)
+        return;
+
+    // Prepare at the plain rate-conversion ratio so the read-ahead sees the same
+    // block size and rate the loader pre-buffered with, then apply the speed.
+    resampler.setResamplingRatio(getBaseRatio());
+    resampler.prepareToPlay(blockSize, outputSampleRate.load());
+    resampler.setResamplingRatio(getPlaybackRatio());
+}
+
+float Deck::getTargetGain() const
+{
+    return playing.load() && !muted ? gain * trackGain : 0.0f;
+}
+
+void Deck::checkForEnd()
+{
+    if (playing.load() && !gaplessSource.isLooping()
+        && gaplessSource.getNextReadPosition() > gaplessSource.getTotalLength() + 1)
+        playing = false;
+}
+
+void Deck::render(juce::AudioBuffer<float>& buffer, int startSample, int numSamples)
+{
+    // A track is being swapped in on the message thread; drop this block rather
+    // than wait for it.
+    const juce::ScopedTryLock sl(lock);
+    if (!sl.isLocked())
+    {
+        buffer.clear(startSample, numSamples);
+        return;
+    }
+
+    if (gainResetPending.exchange(false))
+        gainRamp.setCurrentAndTarget(0.0f);
+    gainRamp.setTarget(getTargetGain());
+
+    stretcher.setQuality(stretchQuality.load());
+    stretcher.setTempo(speed.load());
+    resampler.setResamplingRatio(getPlaybackRatio());
+    resampler.getNextAudioBlock(juce::AudioSourceChannelInfo(&buffer, startSample, numSamples));
+    checkForEnd();
+}
+
+void Deck::setTrack(std::unique_ptr<PreparedTrack> track)
+{
+    clearQueue();
+    trackAdvanced = false;
+
+    auto oldSources = takeSources();
+
+    {
+        const juce::ScopedLock sl(lock);
+        playing = false;
+        gainResetPending = true;
+        readerSource = std::move(track->readerSource);
+        readAheadSource = std::move(track->readAheadSource);
+        sourceSampleRate = track->sampleRate;
+        gaplessSource.setSources(readAheadSource.get(), nullptr);
+        prepareResampler();
+        resampler.flushBuffers();
+        stretcher.reset();
+        hasSource = true;
+    }
+
+    reportedPosition = 0.0;
+    reportedLength = readLength();
+
+    copyTrackInfo(*track);
+    setTrackGain(file, track->trackGain);
+    readAheadSource->setLooping(looping);
+    applyLoopRegion();
+    updateCrossfadeLength();
+}
+
+void Deck::clearTrack()
+{
+    clearQueue();
+    trackAdvanced = false;
+
+    auto oldSources = takeSources();
+
+    {
+        const juce::ScopedLock sl(lock);
+        playing = false;
+        gainResetPending = true;
+        hasSource = false;
+        gaplessSource.setSources(nullptr, nullptr);
+    }
+
+    reportedPosition = 0.0;
+    reportedLength = 0.0;
+
+    reader = nullptr;
+    file = juce::File();
+    title = "";
+    artist = "";
+    album = "";
+    duration = 0.0;
+    setTrackGain(file, 1.0f);
+}
+
+// Moves the current sources out so they are freed once the caller has
+// swapped in the new ones. PreparedTrack declares the read-ahead after the
+// reader source, so it is destroyed first and its time-slice client is gone
+// before the reader it decodes from.
+PreparedTrack Deck::takeSources()
+{
+    PreparedTrack old;
+    old.readerSource = std::move(readerSource);
+    old.readAheadSource = std::move(readAheadSource);
+    return old;
+}
+
+void Deck::copyTrackInfo(const PreparedTrack& track)
+{
+    reader = track.reader;
+    file = track.file;
+    title = track.title;
+    artist = track.artist;
+    album = track.album;
+    duration = track.duration;
+}
+
+int Deck::beginQueue(const juce::File& fileToQueue)
+{
+    clearQueue();
+    queuedFile = fileToQueue;
+    return queueGeneration;
+}
+
+bool Deck::queueNext(std::unique_ptr<PreparedTrack> track)
+{
+    // The resampler runs at one ratio per block, so only tracks at the current
+    // rate can follow on sample-accurately.
+    if (track == nullptr || !hasTrack() || loopRegionEnabled || track->sampleRate != sourceSampleRate.load())
+        return false;
+
+    queuedTrack = std::move(track);
+    gaplessSource.setNextSource(queuedTrack->readAheadSource.get());
+    return true;
+}
+
+void Deck::clearQueue()
+{
+    ++queueGeneration;
+    gaplessSource.setNextSource(nullptr);
+    syncAdvance();
+    queuedTrack.reset();
+    queuedFile = juce::File();
+}
+
+bool Deck::pollAdvance()
+{
+    syncAdvance();
+    return std::exchange(trackAdvanced, false);
+}
+
+void Deck::syncAdvance()
+{
+    int advances = gaplessSource.getAdvanceCount();
+    if (advances == handledAdvanceCount)
+        return;
+
+    handledAdvanceCount = advances;
+    if (queuedTrack != nullptr)
+    {
+        adoptQueuedTrack();
+        trackAdvanced = true;
+    }
+}
+
+void Deck::adoptQueuedTrack()
+{
+    auto track = std::move(queuedTrack);
+    auto oldSources = takeSources();
+    queuedFile = juce::File();
+    ++queueGeneration;
+
+    readerSource = std::move(track->readerSource);
+    readAheadSource = std::move(track->readAheadSource);
+    copyTrackInfo(*track);
+    setTrackGain(file, track->trackGain);
+    applyLoopRegion();
+}
+
+void Deck::post(ControlCommand::Type type, double value)
+{
+    bool queued = commands.push({ type, id, value });
+    jassertquiet(queued);
+}
+
+void Deck::start()
+{
+    if (hasTrack())
+        post(ControlCommand::Type::start);
+}
+
+void Deck::stop()
+{
+    post(ControlCommand::Type::stop);
+}
+
+void Deck::setPosition(double seconds)
+{
+    if (!hasTrack())
+        return;
+
+    reportedPosition = juce::jmax(0.0, seconds);
+    post(ControlCommand::Type::setPosition, seconds);
+}
+
+void Deck::jump(double seconds)
+{
+    post(ControlCommand::Type::jump, seconds);
+}
+
+void Deck::setGain(float newGain)
+{
+    requestedGain = newGain;
+    post(ControlCommand::Type::setGain, newGain);
+}
+
+void Deck::setTrackGain(const juce::File& trackFile, float newTrackGain)
+{
+    if (queuedTrack != nullptr && queuedTrack->file == trackFile)
+        queuedTrack->trackGain = newTrackGain;
+
+    if (trackFile != file)
+        return;
+
+    requestedTrackGain = newTrackGain;
+    post(ControlCommand::Type::setTrackGain, newTrackGain);
+}
+
+void Deck::setMuted(bool shouldBeMuted)
+{
+    requestedMuted = shouldBeMuted;
+    post(ControlCommand::Type::setMuted, shouldBeMuted ? 1.0 : 0.0);
+}
+
+void Deck::setSpeed(double newSpeed)
+{
+    requestedSpeed = juce::jlimit(0.5, 2.0, newSpeed);
+    post(ControlCommand::Type::setSpeed, requestedSpeed);
+}
+
+void Deck::setTimeStretchQuality(TimeStretchSource::Quality newQuality)
+{
+    requestedStretch = newQuality;
+    post(ControlCommand::Type::setTimeStretch, (double)newQuality);
+}
+
+void Deck::handleCommand(const ControlCommand& command)
+{
+    switch (command.type)
+    {
+        case ControlCommand::Type::start:
+            playing = hasSource.load();
+            break;
+        case ControlCommand::Type::stop:
+            playing = false;
+            break;
+        case ControlCommand::Type::setPosition:
+            seek(command.value);
+            break;
+        case ControlCommand::Type::jump:
+        {
+            double newPosition = readPosition() + command.value;
+            if (newPosition < readLength())
+                seek(juce::jmax(0.0, newPosition));
+            break;
+        }
+        case ControlCommand::Type::setGain:
+            gain = (float)command.value;
+            break;
+        case ControlCommand::Type::setTrackGain:
+            trackGain = (float)command.value;
+            break;
+        case ControlCommand::Type::setSpeed:
+            speed = command.value;
+            break;
+        case ControlCommand::Type::setMuted:
+            muted = command.value != 0.0;
+            break;
+        case ControlCommand::Type::setTimeStretch:
+            stretchQuality = (TimeStretchSource::Quality)juce::roundToInt(command.value);
+            break;
+        case ControlCommand::Type::setMasterMuted:
+            break;
+    }
+}
+
+void Deck::publishState()
+{
+    if (!hasSource.load())
+        return;
+
+    reportedPosition = readPosition();
+    reportedLength = readLength();
+}
+
+void Deck::seek(double seconds)
+{
+    double rate = sourceSampleRate.load();
+    if (!hasSource.load() || rate <= 0.0)
+        return;
+
+    gaplessSource.setNextReadPosition((juce::int64)(juce::jmax(0.0, seconds) * rate));
+    resampler.flushBuffers();
+    stretcher.reset();
+}
+
+double Deck::readPosition() const
+{
+    double rate = sourceSampleRate.load();
+    return rate > 0.0 ? (double)gaplessSource.getNextReadPosition() / rate : 0.0;
+}
+
+double Deck::readLength() const
+{
+    double rate = sourceSampleRate.load();
+    return rate > 0.0 ? (double)gaplessSource.getTotalLength() / rate : 0.0;
+}
+
+void Deck::setLooping(bool shouldLoop)
+{
+    looping = shouldLoop;
+    if (readAheadSource != nullptr)
+        readAheadSource->setLooping(looping);
+    if (queuedTrack != nullptr)
+        queuedTrack->readAheadSource->setLooping(looping);
+}
+
+void Deck::setLoopRegion(bool enabled, double startSeconds, double endSeconds)
+{
+    loopRegionEnabled = enabled && endSeconds > startSeconds;
+    loopStart = startSeconds;
+    loopEnd = endSeconds;
+    if (loopRegionEnabled)
+        clearQueue();
+    applyLoopRegion();
+}
+
+void Deck::applyLoopRegion()
+{
+    if (readAheadSource == nullptr || reader == nullptr)
+        return;
+
+    if (loopRegionEnabled)
+    {
+        auto start = (juce::int64)(loopStart * reader->sampleRate);
+        auto end = juce::jmin(reader->lengthInSamples, (juce::int64)(loopEnd * reader->sampleRate));
+        readAheadSource->setLoopRegion(start, end, juce::roundToInt(loopCrossfadeSeconds * reader->sampleRate));
+    }
+    else
+    {
+        readAheadSource->clearLoopRegion();
+    }
+}
+
+void Deck::setCrossfadeSeconds(double seconds)
+{
+    crossfadeSeconds = juce::jlimit(0.0, 10.0, seconds);
+    updateCrossfadeLength();
+}
+
+double Deck::getDecodeSpeed() const
+{
+    double seconds = getDecodeSeconds();
+    double rate = sourceSampleRate.load();
+    if (readAheadSource == nullptr || seconds <= 0.0 || rate <= 0.0)
+        return 0.0;
+    return (double)readAheadSource->getDecodedSamples() / rate / seconds;
+}
+
+void Deck::updateCrossfadeLength()
+{
+    gaplessSource.setCrossfadeLength(juce::roundToInt(crossfadeSeconds * sourceSampleRate.load()));
+}
@@ -0,0 +1,158 @@
+#pragma once
+#include <JuceHeader.h>
+#include "TrackLoader.h"
+#include "GaplessSource.h"
+#include "CommandQueue.h"
+#include "TimeStretch.h"
+#include "MixKernels.h"
+#include "LevelMeter.h"
+
+class Deck
+{
+public:
+    Deck(ControlQueue& commandQueue, int deckId);
+    ~Deck();
+
+    int getId() const { return id; }
+
+    void prepareToPlay(int samplesPerBlockExpected, double sampleRate);
+    void releaseResources();
+
+    // Audio thread: render() writes the deck's audio without gain, and the
+    // mixer then applies getGainRamp() while summing.
+    bool isAudible() const { return hasSource.load() && (playing.load() || !gainRamp.isSilent()); }
+    void render(juce::AudioBuffer<float>& buffer, int startSample, int numSamples);
+    MixKernels::GainRamp& getGainRamp() { return gainRamp; }
+    LevelMeter& getMeter() { return meter; }
+    const LevelMeter& getMeter() const { return meter; }
+    void handleCommand(const ControlCommand& command);
+    void publishState();
+
+    void setTrack(std::unique_ptr<PreparedTrack> track);
+    void clearTrack();
+    bool hasTrack() const { return readAheadSource != nullptr; }
+
+    int beginLoad() { return ++loadGeneration; }
+    bool isLoadCurrent(int generation) const { return generation == loadGeneration; }
+    // A superseded load never finishes, so this is true until the newest one
+    // has, whether or not it succeeded.
+    void endLoad(int generation) { if (isLoadCurrent(generation)) finishedLoadGeneration = generation; }
+    bool isLoading() const { return finishedLoadGeneration != loadGeneration; }
+
+    int beginQueue(const juce::File& file);
+    bool isQueueCurrent(int generation) const { return generation == queueGeneration; }
+    bool queueNext(std::unique_ptr<PreparedTrack> track);
+    void clearQueue();
+    bool pollAdvance();
+    bool isNextTrackReady() const { return queuedTrack != nullptr; }
+    juce::File getQueuedFile() const { return queuedFile; }
+
+    void start();
+    void stop();
+    bool isPlaying() const { return playing.load(); }
+    void setPosition(double seconds);
+    // The message-thread half of a setPosition sent to all decks at once.
+    void expectPosition(double seconds) { if (hasTrack()) reportedPosition = juce::jmax(0.0, seconds); }
+    double getPosition() const { return reportedPosition.load(); }
+    double getLengthInSeconds() const { return reportedLength.load(); }
+    void jump(double seconds);
+
+    void setGain(float newGain);
+    float getGain() const { return requestedGain; }
+    // Loudness normalisation gain of the track now playing, applied on top of
+    // setGain(). A queued track with the same file takes it when it plays.
+    void setTrackGain(const juce::File& trackFile, float newTrackGain);
+    float getTrackGain() const { return requestedTrackGain; }
+    void setMuted(bool shouldBeMuted);
+    bool isMuted() const { return requestedMuted; }
+    void setSpeed(double newSpeed);
+    double getSpeed() const { return requestedSpeed; }
+    void setTimeStretchQuality(TimeStretchSource::Quality newQuality);
+    TimeStretchSource::Quality getTimeStretchQuality() const { return requestedStretch; }
+
+    void setLooping(bool shouldLoop);
+    void setLoopRegion(bool enabled, double startSeconds, double endSeconds);
+    void setCrossfadeSeconds(double seconds);
+
+    juce::String getTitle() const { return title; }
+    juce::String getArtist() const { return artist; }
+    juce::String getAlbum() const { return album; }
+    double getDuration() const { return duration; }
+    juce::File getFile() const { return file; }
+    juce::AudioFormatReader* getReader() const { return reader; }
+    int getUnderrunCount() const { return readAheadSource != nullptr ? readAheadSource->getUnderrunCount() : 0; }
+    double getDecodeSeconds() const { return readAheadSource != nullptr ? readAheadSource->getDecodeSeconds() : 0.0; }
+    double getDecodeSpeed() const;
+
+private:
+    void prepareResampler();
+    double getBaseRatio() const;
+    double getPlaybackRatio() const;
+    float getTargetGain() const;
+    void checkForEnd();
+    void post(ControlCommand::Type type, double value = 0.0);
+    void seek(double seconds);
+    double readPosition() const;
+    double readLength() const;
+    void syncAdvance();
+    void adoptQueuedTrack();
+    PreparedTrack takeSources();
+    void copyTrackInfo(const PreparedTrack& track);
+    void applyLoopRegion();
+    void updateCrossfadeLength();
+
+    ControlQueue& commands;
+    const int id;
+    juce::CriticalSection lock;
+    GaplessSource gaplessSource;
+    TimeStretchSource stretcher { &gaplessSource };
+    juce::ResamplingAudioSource resampler { &stretcher, false, 2 };
+
+    std::unique_ptr<juce::AudioFormatReaderSource> readerSource;
+    std::unique_ptr<ReadAheadSource> readAheadSource;
+    std::unique_ptr<PreparedTrack> queuedTrack;
+    juce::File queuedFile;
+    int loadGeneration = 0;
+    int finishedLoadGeneration = 0;
+    int queueGeneration = 0;
+    int handledAdvanceCount = 0;
+    bool trackAdvanced = false;
+
+    std::atomic<bool> hasSource { false };
+    std::atomic<bool> playing { false };
+    bool muted = false;
+    float gain = 1.0f;
+    float trackGain = 1.0f;
+    MixKernels::GainRamp gainRamp;
+    LevelMeter meter;
+    std::atomic<bool> gainResetPending { false };
+    std::atomic<double> speed { 1.0 };
+    std::atomic<TimeStretchSource::Quality> stretchQuality { TimeStretchSource::Quality::off };
+    int blockSize = 0;
+    std::atomic<double> outputSampleRate { 0.0 };
+    std::atomic<double> sourceSampleRate { 0.0 };
+    std::atomic<double> reportedPosition { 0.0 };
+    std::atomic<double> reportedLength { 0.0 };
+
+    bool requestedMuted = false;
+    float requestedGain = 1.0f;
+    float requestedTrackGain = 1.0f;
+    double requestedSpeed = 1.0;
+    TimeStretchSource::Quality requestedStretch = TimeStretchSource::Quality::off;
+
+    bool looping = false;
+    bool loopRegionEnabled = false;
+    double loopStart = 0.0;
+    double loopEnd = 0.0;
+    double loopCrossfadeSeconds = 0.005;
+    double crossfadeSeconds = 0.0;
+
+    juce::String title;
+    juce::String artist;
+    juce::String album;
+    double duration = 0.0;
+    juce::File file;
+    juce::AudioFormatReader* reader = nullptr;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Deck)
+};
@@ -0,0 +1,185 @@
+#include "GaplessSource.h"
+
+void GaplessSource::prepareToPlay(int samplesPerBlockExpected, double sampleRate)
+{
+    const juce::ScopedLock sl(lock);
+    preparedBlockSize = samplesPerBlockExpected;
+    preparedSampleRate = sampleRate;
+    nextBuffer.setSize(maxChannels, samplesPerBlockExpected * 2 + 32);
+
+    if (auto* source = current.load())
+        source->prepareToPlay(samplesPerBlockExpected, sampleRate);
+    if (auto* source = next.load())
+        source->prepareToPlay(samplesPerBlockExpected, sampleRate);
+}
+
+void GaplessSource::releaseResources()
+{
+    // The tracks are owned and released by PlayerAudio; releasing them here
+    // would throw away the read-ahead of a track that is about to play.
+    const juce::ScopedLock sl(lock);
+    nextBuffer.setSize(0, 0);
+}
+
+void GaplessSource::getNextAudioBlock(const juce::AudioSourceChannelInfo& bufferToFill)
+{
+    // The sources are being swapped on the message thread; drop this block
+    // rather than wait for it.
+    const juce::ScopedTryLock sl(lock);
+    auto* source = current.load();
+    if (!sl.isLocked() || source == nullptr)
+    {
+        bufferToFill.clearActiveBufferRegion();
+        return;
+    }
+
+    auto* following = next.load();
+    if (following == nullptr || source->isLooping())
+    {
+        transitionLength = -1;
+        source->getNextAudioBlock(bufferToFill);
+        return;
+    }
+
+    auto remaining = source->getTotalLength() - source->getNextReadPosition();
+    if (remaining >= bufferToFill.numSamples + crossfadeLength.load())
+    {
+        transitionLength = -1;
+        source->getNextAudioBlock(bufferToFill);
+        return;
+    }
+
+    // A track queued with less than a crossfade left fades over what remains,
+    // still starting from full gain.
+    if (transitionLength < 0)
+        transitionLength = (int)juce::jlimit((juce::int64)0, (juce::int64)crossfadeLength.load(), remaining);
+
+    renderTransition(bufferToFill, remaining);
+
+    if (remaining <= bufferToFill.numSamples)
+    {
+        current = following;
+        next = nullptr;
+        transitionLength = -1;
+        ++advanceCount;
+    }
+}
+
+void GaplessSource::renderTransition(const juce::AudioSourceChannelInfo& bufferToFill, juce::int64 remaining)
+{
+    auto& buffer = *bufferToFill.buffer;
+    auto* source = current.load();
+    auto* following = next.load();
+    int fadeLength = transitionLength;
+    int numSamples = bufferToFill.numSamples;
+    int currentEnd = (int)juce::jlimit((juce::int64)0, (juce::int64)numSamples, remaining);
+    int nextStart = (int)juce::jlimit((juce::int64)0, (juce::int64)numSamples, remaining - fadeLength);
+
+    if (currentEnd > 0)
+        source->getNextAudioBlock(juce::AudioSourceChannelInfo(&buffer, bufferToFill.startSample, currentEnd));
+    if (currentEnd < numSamples)
+        buffer.clear(bufferToFill.startSample + currentEnd, numSamples - currentEnd);
+
+    if (fadeLength == 0)
+    {
+        if (nextStart < numSamples)
+            following->getNextAudioBlock(juce::AudioSourceChannelInfo(&buffer, bufferToFill.startSample + nextStart, numSamples - nextStart));
+        return;
+    }
+
+    int numNext = numSamples - nextStart;
+    if (numNext <= 0 || nextBuffer.getNumSamples() == 0)
+        return;
+
+    // The incoming track is pulled through the buffer sized in prepareToPlay,
+    // a piece at a time when the resampler asks for more than that.
+    int numChannels = juce::jmin(buffer.getNumChannels(), nextBuffer.getNumChannels());
+    for (int done = 0; done < numNext;)
+    {
+        int length = juce::jmin(numNext - done, nextBuffer.getNumSamples());
+        juce::AudioBuffer<float> chunk(nextBuffer.getArrayOfWritePointers(), numChannels, length);
+        following->getNextAudioBlock(juce::AudioSourceChannelInfo(&chunk, 0, length));
+
+        int position = nextStart + done;
+        int overlap = juce::jlimit(0, length, currentEnd - position);
+        float fadeStart = (float)(remaining - position) / (float)fadeLength;
+        float fadeEnd = (float)(remaining - position - overlap) / (float)fadeLength;
+        int start = bufferToFill.startSample + position;
+
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        {
+            if (overlap > 0)
+                buffer.applyGainRamp(ch, start, overlap, fadeStart, fadeEnd);
+            if (ch >= numChannels)
+                continue;
+            if (overlap > 0)
+                buffer.addFromWithRamp(ch, start, chunk.getReadPointer(ch), overlap, 1.0f - fadeStart, 1.0f - fadeEnd);
+            if (overlap < length)
+                buffer.addFrom(ch, start + overlap, chunk, ch, overlap, length - overlap);
+        }
+        done += length;
+    }
+}
+
+// The sources are owned by the Deck, which never frees one while the audio
+// thread can still reach it, so reading the current pointer needs no lock.
+void GaplessSource::setNextReadPosition(juce::int64 newPosition)
+{
+    if (auto* source = current.load())
+        source->setNextReadPosition(newPosition);
+}
+
+juce::int64 GaplessSource::getNextReadPosition() const
+{
+    auto* source = current.load();
+    return source != nullptr ? source->getNextReadPosition() : 0;
+}
+
+juce::int64 GaplessSource::getTotalLength() const
+{
+    auto* source = current.load();
+    return source != nullptr ? source->getTotalLength() : 0;
+}
+
+bool GaplessSource::isLooping() const
+{
+    auto* source = current.load();
+    return source != nullptr && source->isLooping();
+}
+
+void GaplessSource::setLooping(bool shouldLoop)
+{
+    if (auto* source = current.load())
+        source->setLooping(shouldLoop);
+}
+
+void GaplessSource::setSources(juce::PositionableAudioSource* currentSource, juce::PositionableAudioSource* nextSource)
+{
+    const juce::ScopedLock sl(lock);
+    current = currentSource;
+    next = nextSource;
+    transitionLength = -1;
+}
+
+void GaplessSource::setNextSource(juce::PositionableAudioSource* nextSource)
+{
+    int blockSize;
+    double sampleRate;
+    {
+        const juce::ScopedLock sl(lock);
+        blockSize = preparedBlockSize;
+        sampleRate = preparedSampleRate;
+    }
+
+    if (nextSource != nullptr && blockSize > 0 && sampleRate > 0.0)
+        nextSource->prepareToPlay(blockSize, sampleRate);
+
+    const juce::ScopedLock sl(lock);
+    next = nextSource;
+    transitionLength = -1;
+}
+
+void GaplessSource::setCrossfadeLength(int numSamples)
+{
+    crossfadeLength = juce::jmax(0, numSamples);
+}
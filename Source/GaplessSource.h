@@ -0,0 +1,45 @@
+#pragma once
+#include <JuceHeader.h>
+
+class GaplessSource : public juce::PositionableAudioSource
+{
+public:
+    GaplessSource() = default;
+
+    void prepareToPlay(int samplesPerBlockExpected, double sampleRate) override;
+    void releaseResources() override;
+    void getNextAudioBlock(const juce::AudioSourceChannelInfo& bufferToFill) override;
+
+    void setNextReadPosition(juce::int64 newPosition) override;
+    juce::int64 getNextReadPosition() const override;
+    juce::int64 getTotalLength() const override;
+    bool isLooping() const override;
+    void setLooping(bool shouldLoop) override;
+
+    void setSources(juce::PositionableAudioSource* currentSource, juce::PositionableAudioSource* nextSource);
+    void setNextSource(juce::PositionableAudioSource* nextSource);
+    void setCrossfadeLength(int numSamples);
+    int getAdvanceCount() const { return advanceCount.load(); }
+
+private:
+    static constexpr int maxChannels = 8;
+
+    void renderTransition(const juce::AudioSourceChannelInfo& bufferToFill, juce::int64 remaining);
+
+    // Only held while the pair of sources changes: the message thread swaps
+    // them in, the audio thread advances from one to the other and gives up
+    // the block if it cannot get the lock. Everything else reads the atomics.
+    juce::CriticalSection lock;
+    std::atomic<juce::PositionableAudioSource*> current { nullptr };
+    std::atomic<juce::PositionableAudioSource*> next { nullptr };
+    std::atomic<int> crossfadeLength { 0 };
+    // Fade length of the transition under way, or -1. Audio thread only,
+    // except that swapping the sources under the lock resets it.
+    int transitionLength = -1;
+    int preparedBlockSize = 0;
+    double preparedSampleRate = 0.0;
+    juce::AudioBuffer<float> nextBuffer;
+    std::atomic<int> advanceCount { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(GaplessSource)
+};
@@ -0,0 +1,362 @@
+#include "LevelMeter.h"
+#include "MixKernels.h"
+
+#if JUCE_USE_SSE_INTRINSICS
+ #include <immintrin.h>
+#elif JUCE_USE_ARM_NEON
+ #include <arm_neon.h>
+#endif
+
+#if JUCE_USE_ARM_NEON && JUCE_64BIT
+ #define KWEIGHTING_HAS_NEON 1
+#else
+ #define KWEIGHTING_HAS_NEON 0
+#endif
+
+void KWeighting::prepare(double sampleRate)
+{
+    // The analogue prototypes are re-derived for any sample rate.
+    {
+        const double f0 = 1681.974450955533;
+        const double gainDb = 3.999843853973347;
+        const double q = 0.7071752369554196;
+        double k = std::tan(juce::MathConstants<double>::pi * f0 / sampleRate);
+        double vh = std::pow(10.0, gainDb / 20.0);
+        double vb = std::pow(vh, 0.4996667741545416);
+        double a0 = 1.0 + k / q + k * k;
+        shelf[0] = (vh + vb * k / q + k * k) / a0;
+        shelf[1] = 2.0 * (k * k - vh) / a0;
+        shelf[2] = (vh - vb * k / q + k * k) / a0;
+        shelf[3] = 2.0 * (k * k - 1.0) / a0;
+        shelf[4] = (1.0 - k / q + k * k) / a0;
+    }
+    {
+        const double f0 = 38.13547087602444;
+        const double q = 0.5003270373238773;
+        double k = std::tan(juce::MathConstants<double>::pi * f0 / sampleRate);
+        double a0 = 1.0 + k / q + k * k;
+        highPass[0] = 1.0;
+        highPass[1] = -2.0;
+        highPass[2] = 1.0;
+        highPass[3] = 2.0 * (k * k - 1.0) / a0;
+        highPass[4] = (1.0 - k / q + k * k) / a0;
+    }
+    reset();
+}
+
+void KWeighting::reset()
+{
+    for (auto& lanes : state)
+        lanes[0] = lanes[1] = 0.0;
+}
+
+double KWeighting::process(const float* left, const float* right, int numSamples)
+{
+    double sum = 0.0;
+    
+   #if JUCE_USE_SSE_INTRINSICS
+    // One lane per channel; a mono right lane just stays at zero.
+    const __m128d sb0 = _mm_set1_pd(shelf[0]), sb1 = _mm_set1_pd(shelf[1]), sb2 = _mm_set1_pd(shelf[2]);
+    const __m128d sa1 = _mm_set1_pd(shelf[3]), sa2 = _mm_set1_pd(shelf[4]);
+    const __m128d hb0 = _mm_set1_pd(highPass[0]), hb1 = _mm_set1_pd(highPass[1]), hb2 = _mm_set1_pd(highPass[2]);
+    const __m128d ha1 = _mm_set1_pd(highPass[3]), ha2 = _mm_set1_pd(highPass[4]);
+    __m128d s1 = _mm_load_pd(state[0]), s2 = _mm_load_pd(state[1]);
+    __m128d h1 = _mm_load_pd(state[2]), h2 = _mm_load_pd(state[3]);
+    __m128d total = _mm_setzero_pd();
+    for (int i = 0; i < numSamples; ++i)
+    {
+        __m128d x = right != nullptr ? _mm_set_pd(right[i], left[i]) : _mm_set_sd(left[i]);
+        __m128d y = _mm_add_pd(_mm_mul_pd(sb0, x), s1);
+        s1 = _mm_add_pd(_mm_sub_pd(_mm_mul_pd(sb1, x), _mm_mul_pd(sa1, y)), s2);
+        s2 = _mm_sub_pd(_mm_mul_pd(sb2, x), _mm_mul_pd(sa2, y));
+        __m128d z = _mm_add_pd(_mm_mul_pd(hb0, y), h1);
+        h1 = _mm_add_pd(_mm_sub_pd(_mm_mul_pd(hb1, y), _mm_mul_pd(ha1, z)), h2);
+        h2 = _mm_sub_pd(_mm_mul_pd(hb2, y), _mm_mul_pd(ha2, z));
+        total = _mm_add_pd(total, _mm_mul_pd(z, z));
+    }
+    _mm_store_pd(state[0], s1);
+    _mm_store_pd(state[1], s2);
+    _mm_store_pd(state[2], h1);
+    _mm_store_pd(state[3], h2);
+    alignas(16) double lanes[2];
+    _mm_store_pd(lanes, total);
+    sum = lanes[0] + lanes[1];
+   #elif KWEIGHTING_HAS_NEON
+    const float64x2_t sb0 = vdupq_n_f64(shelf[0]), sb1 = vdupq_n_f64(shelf[1]), sb2 = vdupq_n_f64(shelf[2]);
+    const float64x2_t sa1 = vdupq_n_f64(shelf[3]), sa2 = vdupq_n_f64(shelf[4]);
+    const float64x2_t hb0 = vdupq_n_f64(highPass[0]), hb1 = vdupq_n_f64(highPass[1]), hb2 = vdupq_n_f64(highPass[2]);
+    const float64x2_t ha1 = vdupq_n_f64(highPass[3]), ha2 = vdupq_n_f64(highPass[4]);
+    float64x2_t s1 = vld1q_f64(state[0]), s2 = vld1q_f64(state[1]);
+    float64x2_t h1 = vld1q_f64(state[2]), h2 = vld1q_f64(state[3]);
+    float64x2_t total = vdupq_n_f64(0.0);
+    for (int i = 0; i < numSamples; ++i)
+    {
+        double pair[2] = { left[i], right != nullptr ? right[i] : 0.0 };
+        float64x2_t x = vld1q_f64(pair);
+        float64x2_t y = vfmaq_f64(s1, sb0, x);
+        s1 = vfmsq_f64(vfmaq_f64(s2, sb1, x), sa1, y);
+        s2 = vfmsq_f64(vmulq_f64(sb2, x), sa2, y);
+        float64x2_t z = vfmaq_f64(h1, hb0, y);
+        h1 = vfmsq_f64(vfmaq_f64(h2, hb1, y), ha1, z);
+        h2 = vfmsq_f64(vmulq_f64(hb2, y), ha2, z);
+        total = vfmaq_f64(total, z, z);
+    }
+    vst1q_f64(state[0], s1);
+    vst1q_f64(state[1], s2);
+    vst1q_f64(state[2], h1);
+    vst1q_f64(state[3], h2);
+    sum = vaddvq_f64(total);
+   #else
+    for (int ch = 0; ch < (right != nullptr ? 2 : 1); ++ch)
+    {
+        auto* samples = ch == 0 ? left : right;
+        double s1 = state[0][ch], s2 = state[1][ch], h1 = state[2][ch], h2 = state[3][ch];
+        for (int i = 0; i < numSamples; ++i)
+        {
+            double x = samples[i];
+            double y = shelf[0] * x + s1;
+            s1 = shelf[1] * x - shelf[3] * y + s2;
+            s2 = shelf[2] * x - shelf[4] * y;
+            double z = highPass[0] * y + h1;
+            h1 = highPass[1] * y - highPass[3] * z + h2;
+            h2 = highPass[2] * y - highPass[4] * z;
+            sum += z * z;
+        }
+        state[0][ch] = s1;
+        state[1][ch] = s2;
+        state[2][ch] = h1;
+        state[3][ch] = h2;
+    }
+   #endif
+    
+    // Keeps the recursion out of the denormal range during fade-outs.
+    for (auto& lanes : state)
+        for (auto& value : lanes)
+            if (std::abs(value) < 1.0e-15)
+                value = 0.0;
+    return sum;
+}
+
+TruePeakDetector::TruePeakDetector()
+{
+    // 48-tap windowed-sinc interpolator split into four phases, stored
+    // oldest-sample-first so each phase is a straight dot product.
+    const int numTaps = oversampling * tapsPerPhase;
+    const double centre = (numTaps - 1) * 0.5;
+    for (int phase = 0; phase < oversampling; ++phase)
+    {
+        double sum = 0.0;
+        double taps[tapsPerPhase];
+        for (int j = 0; j < tapsPerPhase; ++j)
+        {
+            int k = phase + oversampling * j;
+            double t = (k - centre) / oversampling;
+            double sinc = std::sin(juce::MathConstants<double>::pi * t) / (juce::MathConstants<double>::pi * t);
+            double window = 0.5 - 0.5 * std::cos(juce::MathConstants<double>::twoPi * (k + 0.5) / numTaps);
+            taps[j] = sinc * window;
+            sum += taps[j];
+        }
+        for (int j = 0; j < tapsPerPhase; ++j)
+            phaseTaps[phase][tapsPerPhase - 1 - j] = (float)(taps[j] / sum);
+    }
+}
+
+void TruePeakDetector::reset()
+{
+    for (int ch = 0; ch < maxChannels; ++ch)
+    {
+        std::fill(std::begin(history[ch]), std::end(history[ch]), 0.0f);
+        historyPos[ch] = 0;
+    }
+}
+
+float TruePeakDetector::process(const float* samples, int channel, int numSamples)
+{
+    auto* ring = history[channel];
+    int& pos = historyPos[channel];
+    float maxLevel = 0.0f;
+    
+    for (int i = 0; i < numSamples; ++i)
+    {
+        ring[pos] = ring[pos + tapsPerPhase] = samples[i];
+        pos = (pos + 1) % tapsPerPhase;
+        
+        // The newest twelve samples are contiguous, oldest first, at ring + pos.
+        const float* window = ring + pos;
+        for (int phase = 0; phase < oversampling; ++phase)
+        {
+            const float* taps = phaseTaps[phase];
+            float sum = 0.0f;
+            for (int j = 0; j < tapsPerPhase; ++j)
+                sum += taps[j] * window[j];
+            maxLevel = juce::jmax(maxLevel, std::abs(sum));
+        }
+    }
+    return maxLevel;
+}
+
+void TruePeakDetector::skip(const float* samples, int channel, int numSamples)
+{
+    auto* ring = history[channel];
+    int& pos = historyPos[channel];
+    for (int i = juce::jmax(0, numSamples - tapsPerPhase); i < numSamples; ++i)
+    {
+        ring[pos] = ring[pos + tapsPerPhase] = samples[i];
+        pos = (pos + 1) % tapsPerPhase;
+    }
+}
+
+LevelMeter::LevelMeter()
+{
+    prepare(sampleRate);
+}
+
+void LevelMeter::prepare(double newSampleRate)
+{
+    sampleRate = newSampleRate;
+    kWeighting.prepare(sampleRate);
+    loudnessBlockLength = juce::jmax(1, juce::roundToInt(sampleRate * 0.1));
+    reset();
+}
+
+void LevelMeter::reset()
+{
+    kWeighting.reset();
+    truePeakDetector.reset();
+    
+    std::fill(std::begin(loudnessBlocks), std::end(loudnessBlocks), 0.0);
+    loudnessIndex = 0;
+    loudnessBlockDone = 0;
+    loudnessEnergy = 0.0;
+    peak = 0.0f;
+    truePeakHold = 0.0f;
+    meanSquare = 0.0;
+    
+    publishedPeak = 0.0f;
+    publishedRms = 0.0f;
+    publishedTruePeak = 0.0f;
+    publishedMomentary = 0.0f;
+    publishedShortTerm = 0.0f;
+}
+
+void LevelMeter::process(const juce::AudioBuffer<float>& buffer, int startSample, int numSamples, float gain)
+{
+    int numChannels = juce::jmin(buffer.getNumChannels(), maxChannels);
+    if (numChannels == 0 || numSamples <= 0)
+    {
+        processSilence(numSamples);
+        return;
+    }
+    
+    gain = std::abs(gain);
+    float blockPeak = 0.0f;
+    double sumSquares = 0.0;
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        auto* samples = buffer.getReadPointer(ch, startSample);
+        auto range = juce::FloatVectorOperations::findMinAndMax(samples, numSamples);
+        blockPeak = juce::jmax(blockPeak, -range.getStart(), range.getEnd());
+        sumSquares += MixKernels::sumOfSquares(samples, numSamples);
+    }
+    
+    // Inter-sample overs only matter close to full scale, so quieter blocks
+    // just keep the interpolator history current and report the sample peak.
+    float blockTruePeak = 0.0f;
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        auto* samples = buffer.getReadPointer(ch, startSample);
+        if (blockPeak * gain > 0.25f)
+            blockTruePeak = juce::jmax(blockTruePeak, truePeakDetector.process(samples, ch, numSamples));
+        else
+            truePeakDetector.skip(samples, ch, numSamples);
+    }
+    blockTruePeak = juce::jmax(blockTruePeak, blockPeak);
+    
+    double gainSquared = (double)gain * gain;
+    for (int done = 0; done < numSamples;)
+    {
+        int length = juce::jmin(numSamples - done, loudnessBlockLength - loudnessBlockDone);
+        double energy = kWeighting.process(buffer.getReadPointer(0, startSample + done),
+                                           numChannels > 1 ? buffer.getReadPointer(1, startSample + done) : nullptr, length);
+        addLoudness(energy * gainSquared, length);
+        done += length;
+    }
+    
+    decay(numSamples, blockPeak * gain, blockTruePeak * gain, sumSquares * gainSquared / (numSamples * numChannels));
+}
+
+void LevelMeter::processSilence(int numSamples)
+{
+    if (numSamples <= 0)
+        return;
+    
+    kWeighting.reset();
+    truePeakDetector.reset();
+    
+    for (int done = 0; done < numSamples;)
+    {
+        int length = juce::jmin(numSamples - done, loudnessBlockLength - loudnessBlockDone);
+        addLoudness(0.0, length);
+        done += length;
+    }
+    
+    decay(numSamples, 0.0f, 0.0f, 0.0);
+}
+
+void LevelMeter::addLoudness(double energy, int numSamples)
+{
+    loudnessEnergy += energy;
+    loudnessBlockDone += numSamples;
+    if (loudnessBlockDone < loudnessBlockLength)
+        return;
+    
+    loudnessBlocks[loudnessIndex] = loudnessEnergy / loudnessBlockLength;
+    loudnessIndex = (loudnessIndex + 1) % numLoudnessBlocks;
+    loudnessBlockDone = 0;
+    loudnessEnergy = 0.0;
+    
+    // Momentary is the last four 100 ms blocks, short-term all thirty.
+    double momentary = 0.0;
+    double shortTerm = 0.0;
+    for (int i = 0; i < numLoudnessBlocks; ++i)
+    {
+        double block = loudnessBlocks[(loudnessIndex + numLoudnessBlocks - 1 - i) % numLoudnessBlocks];
+        if (i < 4)
+            momentary += block;
+        shortTerm += block;
+    }
+    publishedMomentary.store((float)(momentary / 4.0), std::memory_order_relaxed);
+    publishedShortTerm.store((float)(shortTerm / numLoudnessBlocks), std::memory_order_relaxed);
+}
+
+void LevelMeter::decay(int numSamples, float blockPeak, float blockTruePeak, double blockMeanSquare)
+{
+    // Peaks fall back at 20 dB/s; RMS is an exponential ~300 ms average.
+    double seconds = numSamples / sampleRate;
+    auto release = (float)std::pow(10.0, -seconds);
+    peak = juce::jmax(blockPeak, peak * release);
+    truePeakHold = juce::jmax(blockTruePeak, truePeakHold * release);
+    meanSquare += (1.0 - std::exp(-seconds / 0.3)) * (blockMeanSquare - meanSquare);
+    if (meanSquare < 1.0e-12)
+        meanSquare = 0.0;
+    
+    publishedPeak.store(peak, std::memory_order_relaxed);
+    publishedTruePeak.store(truePeakHold, std::memory_order_relaxed);
+    publishedRms.store((float)std::sqrt(meanSquare), std::memory_order_relaxed);
+}
+
+MeterReading LevelMeter::getReading() const
+{
+    auto toLufs = [](float energy)
+    {
+        return energy > 0.0f ? juce::jmax(-100.0f, -0.691f + 10.0f * std::log10(energy)) : -100.0f;
+    };
+    
+    MeterReading reading;
+    reading.peakDb = juce::Decibels::gainToDecibels(publishedPeak.load(std::memory_order_relaxed));
+    reading.rmsDb = juce::Decibels::gainToDecibels(publishedRms.load(std::memory_order_relaxed));
+    reading.truePeakDb = juce::Decibels::gainToDecibels(publishedTruePeak.load(std::memory_order_relaxed));
+    reading.momentaryLufs = toLufs(publishedMomentary.load(std::memory_order_relaxed));
+    reading.shortTermLufs = toLufs(publishedShortTerm.load(std::memory_order_relaxed));
+    return reading;
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include <JuceHeader.h>
+
+struct MeterReading
+{
+    float peakDb = -100.0f;
+    float rmsDb = -100.0f;
+    float truePeakDb = -100.0f;
+    float momentaryLufs = -100.0f;
+    float shortTermLufs = -100.0f;
+
+    bool operator==(const MeterReading& other) const
+    {
+        return peakDb == other.peakDb && rmsDb == other.rmsDb && truePeakDb == other.truePeakDb
+            && momentaryLufs == other.momentaryLufs && shortTermLufs == other.shortTermLufs;
+    }
+    bool operator!=(const MeterReading& other) const { return !operator==(other); }
+};
+
+// BS.1770 K-weighting (head shelf, then RLB high-pass) for one or two
+// channels. Both channels run through the filters together in one pass.
+class KWeighting
+{
+public:
+    void prepare(double sampleRate);
+    void reset();
+
+    // Sum of the squared weighted samples over both channels; right is null
+    // for mono.
+    double process(const float* left, const float* right, int numSamples);
+
+private:
+    // b0 b1 b2 a1 a2 of each stage, normalised so a0 = 1.
+    double shelf[5] { 1.0, 0.0, 0.0, 0.0, 0.0 };
+    double highPass[5] { 1.0, 0.0, 0.0, 0.0, 0.0 };
+    // Transposed direct form II state: shelf z1, z2, high-pass z1, z2, each
+    // as { left, right }.
+    alignas(16) double state[4][2] {};
+};
+
+// 4x oversampled inter-sample peak detector for up to two channels.
+class TruePeakDetector
+{
+public:
+    static constexpr int maxChannels = 2;
+
+    TruePeakDetector();
+    void reset();
+
+    float process(const float* samples, int channel, int numSamples);
+    // Keeps the interpolator history current without measuring anything.
+    void skip(const float* samples, int channel, int numSamples);
+
+private:
+    static constexpr int oversampling = 4;
+    static constexpr int tapsPerPhase = 12;
+
+    float phaseTaps[oversampling][tapsPerPhase] {};
+    float history[maxChannels][tapsPerPhase * 2] {};
+    int historyPos[maxChannels] {};
+};
+
+// Peak, RMS, 4x oversampled true-peak and BS.1770 momentary (400 ms) and
+// short-term (3 s) loudness for the first two channels of a stream.
+// process() runs on the audio thread without locks or allocation; the GUI
+// reads the latest values through getReading().
+class LevelMeter
+{
+public:
+    LevelMeter();
+
+    void prepare(double sampleRate);
+    void reset();
+
+    // gain is applied to the measurement as if it had been applied to the
+    // samples, so a deck can be metered before its gain ramp is mixed in.
+    void process(const juce::AudioBuffer<float>& buffer, int startSample, int numSamples, float gain = 1.0f);
+    void processSilence(int numSamples);
+
+    MeterReading getReading() const;
+
+private:
+    static constexpr int maxChannels = 2;
+    static constexpr int numLoudnessBlocks = 30;
+
+    void addLoudness(double energy, int numSamples);
+    void decay(int numSamples, float blockPeak, float blockTruePeak, double blockMeanSquare);
+
+    double sampleRate = 44100.0;
+    KWeighting kWeighting;
+    TruePeakDetector truePeakDetector;
+
+    double loudnessBlocks[numLoudnessBlocks] {};
+    int loudnessIndex = 0;
+    int loudnessBlockLength = 4410;
+    int loudnessBlockDone = 0;
+    double loudnessEnergy = 0.0;
+
+    float peak = 0.0f;
+    float truePeakHold = 0.0f;
+    double meanSquare = 0.0;
+
+    std::atomic<float> publishedPeak { 0.0f };
+    std::atomic<float> publishedRms { 0.0f };
+    std::atomic<float> publishedTruePeak { 0.0f };
+    std::atomic<float> publishedMomentary { 0.0f };
+    std::atomic<float> publishedShortTerm { 0.0f };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LevelMeter)
+};
@@ -0,0 +1,374 @@
+#include "Library.h"
+#include "TagReader.h"
+#include "TrackCache.h"
+#include "MappedReader.h"
+#include "LoudnessScanner.h"
+
+namespace
+{
+    const juce::int32 libraryFileMagic = 0x424c5041;
+    const juce::int32 libraryFileVersion = 2;
+    const int filesPerJob = 32;
+}
+
+class Library::AnalyseJob : public juce::ThreadPoolJob
+{
+public:
+    AnalyseJob(Library& owner, juce::Array<juce::File> filesToAnalyse)
+        : juce::ThreadPoolJob("Library Analyse"), library(owner), files(std::move(filesToAnalyse))
+    {
+        ++library.scanJobs;
+    }
+
+    ~AnalyseJob() override
+    {
+        --library.scanJobs;
+        library.triggerAsyncUpdate();
+    }
+
+    JobStatus runJob() override
+    {
+        ScanResults results;
+        for (auto& file : files)
+        {
+            if (shouldExit())
+                break;
+
+            LibraryTrack track;
+            if (Library::analyse(library.formatManager, file, track, [this] { return shouldExit(); }))
+                results.added.push_back(std::move(track));
+            ++library.scannedFiles;
+        }
+
+        library.addResults(std::move(results));
+        return jobHasFinished;
+    }
+
+private:
+    Library& library;
+    juce::Array<juce::File> files;
+};
+
+class Library::WalkJob : public juce::ThreadPoolJob
+{
+public:
+    WalkJob(Library& owner, const juce::File& folderToScan)
+        : juce::ThreadPoolJob("Library Walk"), library(owner), folder(folderToScan)
+    {
+        ++library.scanJobs;
+
+        // The walk only needs to know what is already indexed, so it works
+        // from a snapshot instead of touching the live track list.
+        auto prefix = folder.getFullPathName() + juce::File::getSeparatorString();
+        for (auto& track : library.tracks)
+            if (track.path.startsWith(prefix))
+                known[track.path] = { track.fileSize, track.modificationTime };
+    }
+
+    ~WalkJob() override
+    {
+        --library.scanJobs;
+        library.triggerAsyncUpdate();
+    }
+
+    JobStatus runJob() override
+    {
+        auto wildcard = library.formatManager.getWildcardForAllFormats();
+        juce::Array<juce::File> batch;
+        ScanResults results;
+
+        for (const auto& entry : juce::RangedDirectoryIterator(folder, true, wildcard, juce::File::findFiles))
+        {
+            if (shouldExit())
+                return jobHasFinished;
+
+            auto file = entry.getFile();
+            auto found = known.find(file.getFullPathName());
+            if (found != known.end())
+            {
+                bool unchanged = found->second.first == entry.getFileSize()
+                    && found->second.second == entry.getModificationTime().toMilliseconds();
+                known.erase(found);
+                if (unchanged)
+                    continue;
+            }
+
+            batch.add(file);
+            if (batch.size() == filesPerJob)
+                queue(batch);
+        }
+
+        queue(batch);
+        for (auto& missing : known)
+            results.removed.add(missing.first);
+        library.addResults(std::move(results));
+        return jobHasFinished;
+    }
+
+private:
+    void queue(juce::Array<juce::File>& batch)
+    {
+        if (batch.isEmpty())
+            return;
+        library.filesToScan += batch.size();
+        library.workers.addJob(new AnalyseJob(library, std::move(batch)), true);
+        batch.clear();
+    }
+
+    Library& library;
+    juce::File folder;
+    std::map<juce::String, std::pair<juce::int64, juce::int64>> known;
+};
+
+Library::Library(juce::AudioFormatManager& formats, const juce::File& file)
+    : formatManager(formats), indexFile(file)
+{
+}
+
+Library::~Library()
+{
+    cancelPendingUpdate();
+    workers.removeAllJobs(true, 5000);
+    if (unsavedChanges)
+        save();
+}
+
+juce::File Library::getDefaultIndexFile()
+{
+    return TrackCache::getAppDataDirectory().getChildFile("library.idx");
+}
+
+bool Library::analyse(juce::AudioFormatManager& formats, const juce::File& file, LibraryTrack& track,
+                      const std::function<bool()>& shouldStop)
+{
+    auto reader = MappedReader::create(formats, file);
+    if (reader == nullptr)
+        reader.reset(formats.createReaderFor(file));
+    if (reader == nullptr || reader->sampleRate <= 0.0)
+        return false;
+
+    track.path = file.getFullPathName();
+    track.fileSize = file.getSize();
+    track.modificationTime = file.getLastModificationTime().toMilliseconds();
+    track.formatName = reader->getFormatName();
+    track.sampleRate = reader->sampleRate;
+    track.duration = (double)reader->lengthInSamples / reader->sampleRate;
+
+    TrackTags tags;
+    TagReader::read(file, tags);
+    track.title = tags.title.isNotEmpty() ? tags.title : reader->metadataValues.getValue("title", file.getFileNameWithoutExtension());
+    track.artist = tags.artist.isNotEmpty() ? tags.artist : reader->metadataValues.getValue("artist", "");
+    track.album = tags.album.isNotEmpty() ? tags.album : reader->metadataValues.getValue("album", "");
+
+    // Integrated loudness, shared with the playlist's loudness scan through
+    // the same cache file.
+    TrackLoudness loudness;
+    auto cacheFile = TrackCache::getCacheFile(file, "loudness");
+    if (reader->lengthInSamples > 0 && !LoudnessScanner::readFrom(cacheFile, loudness))
+    {
+        if (!LoudnessScanner::analyse(*reader, shouldStop, loudness))
+            return false;
+        LoudnessScanner::writeTo(cacheFile, loudness);
+    }
+
+    track.loudnessLufs = loudness.integratedLufs;
+    return true;
+}
+
+bool Library::load()
+{
+    juce::MemoryBlock data;
+    if (!indexFile.loadFileAsData(data))
+        return false;
+
+    juce::MemoryInputStream in(data, false);
+    if (in.readInt() != libraryFileMagic || in.readInt() != libraryFileVersion)
+        return false;
+
+    int count = in.readInt();
+    if (count < 0)
+        return false;
+
+    tracks.clear();
+    searchText.clear();
+    pathIndex.clear();
+    tracks.reserve((size_t)count);
+    searchText.reserve((size_t)count);
+
+    for (int i = 0; i < count && !in.isExhausted(); ++i)
+    {
+        LibraryTrack track;
+        track.path = in.readString();
+        track.title = in.readString();
+        track.artist = in.readString();
+        track.album = in.readString();
+        track.formatName = in.readString();
+        track.duration = in.readDouble();
+        track.sampleRate = in.readDouble();
+        track.loudnessLufs = in.readFloat();
+        track.fileSize = in.readInt64();
+        track.modificationTime = in.readInt64();
+        put(std::move(track));
+    }
+
+    sendChangeMessage();
+    return true;
+}
+
+bool Library::save() const
+{
+    indexFile.getParentDirectory().createDirectory();
+    juce::TemporaryFile temp(indexFile);
+    {
+        juce::FileOutputStream out(temp.getFile());
+        if (!out.openedOk())
+            return false;
+
+        out.writeInt(libraryFileMagic);
+        out.writeInt(libraryFileVersion);
+        out.writeInt((int)tracks.size());
+        for (auto& track : tracks)
+        {
+            out.writeString(track.path);
+            out.writeString(track.title);
+            out.writeString(track.artist);
+            out.writeString(track.album);
+            out.writeString(track.formatName);
+            out.writeDouble(track.duration);
+            out.writeDouble(track.sampleRate);
+            out.writeFloat(track.loudnessLufs);
+            out.writeInt64(track.fileSize);
+            out.writeInt64(track.modificationTime);
+        }
+
+        out.flush();
+        if (out.getStatus().failed())
+            return false;
+    }
+    return temp.overwriteTargetFileWithTemporary();
+}
+
+void Library::scan(const juce::File& folder)
+{
+    if (!folder.isDirectory())
+        return;
+
+    if (!isScanning())
+    {
+        scannedFiles = 0;
+        filesToScan = 0;
+    }
+    workers.addJob(new WalkJob(*this, folder), true);
+}
+
+void Library::cancelScan()
+{
+    workers.removeAllJobs(true, 5000);
+    handleAsyncUpdate();
+}
+
+void Library::addResults(ScanResults results)
+{
+    {
+        const juce::ScopedLock sl(resultLock);
+        pending.push_back(std::move(results));
+    }
+    triggerAsyncUpdate();
+}
+
+void Library::handleAsyncUpdate()
+{
+    std::vector<ScanResults> ready;
+    {
+        const juce::ScopedLock sl(resultLock);
+        ready.swap(pending);
+    }
+
+    bool changed = false;
+    for (auto& results : ready)
+    {
+        for (auto& path : results.removed)
+            remove(path);
+        for (auto& track : results.added)
+            put(std::move(track));
+        changed = changed || !results.removed.isEmpty() || !results.added.empty();
+    }
+
+    if (changed)
+    {
+        unsavedChanges = true;
+        sendChangeMessage();
+    }
+
+    // Writing 50k records takes a moment, so only do it once the scan is done.
+    if (unsavedChanges && !isScanning())
+        unsavedChanges = !save();
+}
+
+void Library::put(LibraryTrack track)
+{
+    auto found = pathIndex.find(track.path);
+    if (found != pathIndex.end())
+    {
+        searchText[(size_t)found->second] = makeSearchText(track);
+        tracks[(size_t)found->second] = std::move(track);
+        return;
+    }
+
+    pathIndex[track.path] = (int)tracks.size();
+    searchText.push_back(makeSearchText(track));
+    tracks.push_back(std::move(track));
+}
+
+void Library::remove(const juce::String& path)
+{
+    auto found = pathIndex.find(path);
+    if (found == pathIndex.end())
+        return;
+
+    // Move the last track into the gap so removal stays O(1).
+    auto index = (size_t)found->second;
+    pathIndex.erase(found);
+    if (index + 1 < tracks.size())
+    {
+        tracks[index] = std::move(tracks.back());
+        searchText[index] = std::move(searchText.back());
+        pathIndex[tracks[index].path] = (int)index;
+    }
+    tracks.pop_back();
+    searchText.pop_back();
+}
+
+int Library::indexOf(const juce::File& file) const
+{
+    auto found = pathIndex.find(file.getFullPathName());
+    return found != pathIndex.end() ? found->second : -1;
+}
+
+juce::String Library::makeSearchText(const LibraryTrack& track)
+{
+    return (track.title + " " + track.artist + " " + track.album + " " + track.getFile().getFileName()).toLowerCase();
+}
+
+juce::Array<int> Library::search(const juce::String& query, int maxResults) const
+{
+    auto words = juce::StringArray::fromTokens(query.toLowerCase(), true);
+    words.removeEmptyStrings();
+
+    juce::Array<int> results;
+    for (size_t i = 0; i < searchText.size() && results.size() < maxResults; ++i)
+    {
+        bool matches = true;
+        for (auto& word : words)
+        {
+            if (!searchText[i].contains(word))
+            {
+                matches = false;
+                break;
+            }
+        }
+        if (matches)
+            results.add((int)i);
+    }
+    return results;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <JuceHeader.h>
+
+struct LibraryTrack
+{
+    juce::String path;
+    juce::String title;
+    juce::String artist;
+    juce::String album;
+    juce::String formatName;
+    double duration = 0.0;
+    double sampleRate = 0.0;
+    float loudnessLufs = -100.0f;
+    juce::int64 fileSize = 0;
+    juce::int64 modificationTime = 0;
+
+    juce::File getFile() const { return juce::File(path); }
+    bool isUpToDate(const juce::File& file) const
+    {
+        return file.getSize() == fileSize && file.getLastModificationTime().toMilliseconds() == modificationTime;
+    }
+};
+
+// The track database: scans folders on a pool of worker threads, keeps one
+// record per file in a binary index on disk and answers filtered searches.
+// Everything except the scan jobs runs on the message thread; listeners are
+// told about new results with a change message.
+class Library : public juce::ChangeBroadcaster,
+                private juce::AsyncUpdater
+{
+public:
+    Library(juce::AudioFormatManager& formats, const juce::File& indexFile);
+    ~Library() override;
+
+    bool load();
+    bool save() const;
+
+    void scan(const juce::File& folder);
+    void cancelScan();
+    bool isScanning() const { return scanJobs.load() > 0; }
+    int getNumScanned() const { return scannedFiles.load(); }
+    int getNumToScan() const { return filesToScan.load(); }
+
+    int getNumTracks() const { return (int)tracks.size(); }
+    const LibraryTrack& getTrack(int index) const { return tracks[(size_t)index]; }
+    int indexOf(const juce::File& file) const;
+
+    // Every whitespace-separated word of the query has to appear somewhere in
+    // the title, artist, album or file name; case is ignored.
+    juce::Array<int> search(const juce::String& query, int maxResults = 1000) const;
+
+    static juce::File getDefaultIndexFile();
+    static bool analyse(juce::AudioFormatManager& formats, const juce::File& file, LibraryTrack& track,
+                        const std::function<bool()>& shouldStop);
+
+private:
+    class WalkJob;
+    class AnalyseJob;
+
+    struct ScanResults
+    {
+        std::vector<LibraryTrack> added;
+        juce::StringArray removed;
+    };
+
+    void handleAsyncUpdate() override;
+    void addResults(ScanResults results);
+    void put(LibraryTrack track);
+    void remove(const juce::String& path);
+    static juce::String makeSearchText(const LibraryTrack& track);
+
+    juce::AudioFormatManager& formatManager;
+    juce::File indexFile;
+    std::vector<LibraryTrack> tracks;
+    std::vector<juce::String> searchText;
+    std::map<juce::String, int> pathIndex;
+    bool unsavedChanges = false;
+
+    juce::ThreadPool workers { juce::jmax(1, juce::SystemStats::getNumCpus() - 1) };
+    juce::CriticalSection resultLock;
+    std::vector<ScanResults> pending;
+    std::atomic<int> scanJobs { 0 };
+    std::atomic<int> scannedFiles { 0 };
+    std::atomic<int> filesToScan { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Library)
+};
@@ -0,0 +1,264 @@
+#include "LoudnessScanner.h"
+#include "LevelMeter.h"
+#include "MappedReader.h"
+#include "TrackCache.h"
+
+namespace
+{
+    const juce::int32 loudnessFileMagic = 0x4c505041;
+    const juce::int32 loudnessFileVersion = 1;
+
+    double energyToLufs(double energy)
+    {
+        return energy > 0.0 ? -0.691 + 10.0 * std::log10(energy) : -100.0;
+    }
+}
+
+float TrackLoudness::getNormalisationGain(float targetLufs, float ceilingDb) const
+{
+    if (!isValid())
+        return 1.0f;
+
+    float gainDb = juce::jmin(targetLufs - integratedLufs, ceilingDb - truePeakDb);
+    return juce::Decibels::decibelsToGain(juce::jlimit(-24.0f, 12.0f, gainDb));
+}
+
+class LoudnessScanner::ScanJob : public juce::ThreadPoolJob
+{
+public:
+    ScanJob(LoudnessScanner& owner, const juce::File& fileToScan)
+        : juce::ThreadPoolJob("Loudness Scan"), scanner(owner), file(fileToScan)
+    {
+    }
+
+    JobStatus runJob() override
+    {
+        TrackLoudness loudness;
+        auto cacheFile = TrackCache::getCacheFile(file, "loudness");
+        if (!readFrom(cacheFile, loudness))
+        {
+            auto reader = MappedReader::create(scanner.formatManager, file);
+            if (reader == nullptr)
+                reader.reset(scanner.formatManager.createReaderFor(file));
+            if (reader == nullptr || !analyse(*reader, [this] { return shouldExit(); }, loudness))
+            {
+                scanner.abandoned(file);
+                return jobHasFinished;
+            }
+            writeTo(cacheFile, loudness);
+        }
+
+        scanner.finished(file, loudness);
+        return jobHasFinished;
+    }
+
+private:
+    LoudnessScanner& scanner;
+    juce::File file;
+};
+
+LoudnessScanner::LoudnessScanner(juce::AudioFormatManager& formats) : formatManager(formats)
+{
+}
+
+LoudnessScanner::~LoudnessScanner()
+{
+    workers.removeAllJobs(true, 5000);
+    cancelPendingUpdate();
+}
+
+bool LoudnessScanner::getLoudness(const juce::File& file, TrackLoudness& result)
+{
+    {
+        const juce::ScopedLock sl(lock);
+        auto found = measured.find(file.getFullPathName());
+        if (found != measured.end())
+        {
+            result = found->second;
+            return true;
+        }
+    }
+    scan(file);
+    return false;
+}
+
+void LoudnessScanner::scan(const juce::File& file)
+{
+    if (!file.existsAsFile())
+        return;
+
+    {
+        const juce::ScopedLock sl(lock);
+        auto key = file.getFullPathName();
+        if (measured.count(key) > 0 || !queued.insert(key).second)
+            return;
+    }
+    workers.addJob(new ScanJob(*this, file), true);
+}
+
+void LoudnessScanner::scan(const juce::Array<juce::File>& files)
+{
+    for (auto& file : files)
+        scan(file);
+}
+
+void LoudnessScanner::finished(const juce::File& file, const TrackLoudness& loudness)
+{
+    {
+        const juce::ScopedLock sl(lock);
+        auto key = file.getFullPathName();
+        measured[key] = loudness;
+        queued.erase(key);
+        toNotify.add(file);
+    }
+    triggerAsyncUpdate();
+}
+
+void LoudnessScanner::abandoned(const juce::File& file)
+{
+    // Lets a later request try the file again.
+    const juce::ScopedLock sl(lock);
+    queued.erase(file.getFullPathName());
+}
+
+void LoudnessScanner::handleAsyncUpdate()
+{
+    juce::Array<juce::File> files;
+    std::vector<TrackLoudness> results;
+    {
+        const juce::ScopedLock sl(lock);
+        files.swapWith(toNotify);
+        for (auto& file : files)
+            results.push_back(measured[file.getFullPathName()]);
+    }
+
+    if (onScanned)
+        for (int i = 0; i < files.size(); ++i)
+            onScanned(files[i], results[(size_t)i]);
+}
+
+bool LoudnessScanner::analyse(juce::AudioFormatReader& reader, const std::function<bool()>& shouldStop, TrackLoudness& result)
+{
+    if (reader.sampleRate <= 0.0 || reader.lengthInSamples <= 0 || reader.numChannels == 0)
+        return false;
+
+    KWeighting kWeighting;
+    kWeighting.prepare(reader.sampleRate);
+    TruePeakDetector truePeakDetector;
+
+    // BS.1770 gating blocks are 400 ms long and start every 100 ms, so each is
+    // built from four consecutive 100 ms sub-blocks.
+    const int subBlockLength = juce::jmax(1, juce::roundToInt(reader.sampleRate * 0.1));
+    std::vector<double> subBlocks;
+    subBlocks.reserve((size_t)(reader.lengthInSamples / subBlockLength) + 1);
+    double subBlockEnergy = 0.0;
+    int subBlockDone = 0;
+    float truePeak = 0.0f;
+
+    const int numChannels = juce::jmin((int)reader.numChannels, TruePeakDetector::maxChannels);
+    juce::AudioBuffer<float> chunk(numChannels, 65536);
+    for (juce::int64 position = 0; position < reader.lengthInSamples; position += chunk.getNumSamples())
+    {
+        if (shouldStop())
+            return false;
+
+        int numSamples = (int)juce::jmin((juce::int64)chunk.getNumSamples(), reader.lengthInSamples - position);
+        if (!reader.read(&chunk, 0, numSamples, position, true, numChannels > 1))
+            return false;
+
+        // The interpolated peak can only exceed the sample peak by a few dB,
+        // so quieter chunks skip it.
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto* samples = chunk.getReadPointer(ch);
+            auto range = juce::FloatVectorOperations::findMinAndMax(samples, numSamples);
+            float samplePeak = juce::jmax(-range.getStart(), range.getEnd());
+            if (samplePeak > 0.25f)
+                truePeak = juce::jmax(truePeak, samplePeak, truePeakDetector.process(samples, ch, numSamples));
+            else
+            {
+                truePeak = juce::jmax(truePeak, samplePeak);
+                truePeakDetector.skip(samples, ch, numSamples);
+            }
+        }
+
+        for (int done = 0; done < numSamples;)
+        {
+            int length = juce::jmin(numSamples - done, subBlockLength - subBlockDone);
+            subBlockEnergy += kWeighting.process(chunk.getReadPointer(0, done),
+                                                 numChannels > 1 ? chunk.getReadPointer(1, done) : nullptr, length);
+            subBlockDone += length;
+            done += length;
+            if (subBlockDone == subBlockLength)
+            {
+                subBlocks.push_back(subBlockEnergy / subBlockLength);
+                subBlockEnergy = 0.0;
+                subBlockDone = 0;
+            }
+        }
+    }
+
+    std::vector<double> blocks;
+    for (size_t i = 3; i < subBlocks.size(); ++i)
+        blocks.push_back((subBlocks[i - 3] + subBlocks[i - 2] + subBlocks[i - 1] + subBlocks[i]) * 0.25);
+
+    // Absolute gate at -70 LUFS, then a relative gate 10 LU below the loudness
+    // of what is left.
+    auto gatedMean = [&blocks](double threshold)
+    {
+        double sum = 0.0;
+        int count = 0;
+        for (auto energy : blocks)
+        {
+            if (energy > threshold)
+            {
+                sum += energy;
+                ++count;
+            }
+        }
+        return count > 0 ? sum / count : 0.0;
+    };
+
+    const double absoluteGate = std::pow(10.0, (-70.0 + 0.691) / 10.0);
+    double ungated = gatedMean(absoluteGate);
+    double integrated = ungated > 0.0 ? gatedMean(juce::jmax(absoluteGate, ungated * 0.1)) : 0.0;
+
+    result.integratedLufs = (float)juce::jmax(-100.0, energyToLufs(integrated));
+    result.truePeakDb = juce::Decibels::gainToDecibels(truePeak);
+    return true;
+}
+
+bool LoudnessScanner::writeTo(const juce::File& file, const TrackLoudness& loudness)
+{
+    file.getParentDirectory().createDirectory();
+    juce::TemporaryFile temp(file);
+    {
+        juce::FileOutputStream out(temp.getFile());
+        if (!out.openedOk())
+            return false;
+
+        out.writeInt(loudnessFileMagic);
+        out.writeInt(loudnessFileVersion);
+        out.writeFloat(loudness.integratedLufs);
+        out.writeFloat(loudness.truePeakDb);
+
+        out.flush();
+        if (out.getStatus().failed())
+            return false;
+    }
+    return temp.overwriteTargetFileWithTemporary();
+}
+
+bool LoudnessScanner::readFrom(const juce::File& file, TrackLoudness& loudness)
+{
+    juce::FileInputStream in(file);
+    if (!in.openedOk())
+        return false;
+
+    if (in.getTotalLength() < 16 || in.readInt() != loudnessFileMagic || in.readInt() != loudnessFileVersion)
+        return false;
+
+    loudness.integratedLufs = in.readFloat();
+    loudness.truePeakDb = in.readFloat();
+    return true;
+}
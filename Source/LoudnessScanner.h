@@ -0,0 +1,56 @@
+#pragma once
+#include <JuceHeader.h>
+
+struct TrackLoudness
+{
+    float integratedLufs = -100.0f;
+    float truePeakDb = -100.0f;
+
+    // Tracks that never get above the BS.1770 absolute gate have no usable
+    // integrated loudness and are left alone.
+    bool isValid() const { return integratedLufs > -70.0f; }
+
+    // Linear gain that brings the track to targetLufs without pushing its true
+    // peak over ceilingDb.
+    float getNormalisationGain(float targetLufs, float ceilingDb = -1.0f) const;
+};
+
+// Integrated loudness and true peak of whole files, measured on a pool of
+// background threads so a playlist is scanned several files at a time.
+// Results are cached on disk next to the peaks and kept in memory for the
+// rest of the session.
+class LoudnessScanner : private juce::AsyncUpdater
+{
+public:
+    explicit LoudnessScanner(juce::AudioFormatManager& formats);
+    ~LoudnessScanner() override;
+
+    // Never touches the disk: returns false and queues a scan if the file has
+    // not been measured yet.
+    bool getLoudness(const juce::File& file, TrackLoudness& result);
+    void scan(const juce::File& file);
+    void scan(const juce::Array<juce::File>& files);
+
+    // Called on the message thread as each file finishes.
+    std::function<void(const juce::File&, const TrackLoudness&)> onScanned;
+
+    static bool analyse(juce::AudioFormatReader& reader, const std::function<bool()>& shouldStop, TrackLoudness& result);
+    static bool writeTo(const juce::File& file, const TrackLoudness& loudness);
+    static bool readFrom(const juce::File& file, TrackLoudness& loudness);
+
+private:
+    class ScanJob;
+
+    void finished(const juce::File& file, const TrackLoudness& loudness);
+    void abandoned(const juce::File& file);
+    void handleAsyncUpdate() override;
+
+    juce::AudioFormatManager& formatManager;
+    juce::CriticalSection lock;
+    std::map<juce::String, TrackLoudness> measured;
+    std::set<juce::String> queued;
+    juce::Array<juce::File> toNotify;
+    juce::ThreadPool workers { juce::jlimit(1, 4, juce::SystemStats::getNumCpus() - 1) };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LoudnessScanner)
+};
@@ -1,5 +1,7 @@
 #include <JuceHeader.h>
 #include "MainComponent.h"
+#include "OfflineRenderer.h"
+#include "PerfMonitor.h"
 
 class SimpleAudioPlayer : public juce::JUCEApplication
 {
@@ -14,9 +16,18 @@ public:
         return "1.0"; 
     }
     
-    void initialise(const juce::String&) override 
+    void initialise(const juce::String& commandLine) override 
     { 
+        if (OfflineRenderer::isRenderCommandLine(commandLine))
+        {
+            setApplicationReturnValue(OfflineRenderer::runFromCommandLine(commandLine));
+            quit();
+            return;
+        }
+        
+        StartupTrace::begin();
         mainWindow = std::make_unique<MainWindow>(getApplicationName()); 
+        StartupTrace::mark("window shown");
     }
     
     void shutdown() override 
@@ -5,6 +5,13 @@ MainComponent::MainComponent() : gui(audio)
     addAndMakeVisible(gui);
     setSize(1920, 1080);
     setAudioChannels(0, 2);
+    StartupTrace::mark("audio device opened");
+    
+    audio.setXRunCounter([this]
+    {
+        auto* device = deviceManager.getCurrentAudioDevice();
+        return device != nullptr ? device->getXRunCount() : -1;
+    });
 }
 
 MainComponent::~MainComponent()
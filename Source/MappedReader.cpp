@@ -0,0 +1,54 @@
+#include "MappedReader.h"
+
+std::unique_ptr<juce::AudioFormatReader> MappedReader::create(juce::AudioFormatManager& formats, const juce::File& file,
+                                                              double prefetchSeconds)
+{
+    auto* format = formats.findFormatForFileExtension(file.getFileExtension());
+    if (dynamic_cast<juce::WavAudioFormat*>(format) == nullptr && dynamic_cast<juce::AiffAudioFormat*>(format) == nullptr)
+        return nullptr;
+
+    std::unique_ptr<juce::MemoryMappedAudioFormatReader> mapped(format->createMemoryMappedReader(file));
+    if (mapped == nullptr || mapped->lengthInSamples <= 0 || !mapped->mapEntireFile())
+        return nullptr;
+
+    return std::unique_ptr<juce::AudioFormatReader>(new MappedReader(std::move(mapped), prefetchSeconds));
+}
+
+MappedReader::MappedReader(std::unique_ptr<juce::MemoryMappedAudioFormatReader> mappedReader, double prefetchSeconds)
+    : juce::AudioFormatReader(nullptr, mappedReader->getFormatName()), source(std::move(mappedReader))
+{
+    sampleRate = source->sampleRate;
+    bitsPerSample = source->bitsPerSample;
+    lengthInSamples = source->lengthInSamples;
+    numChannels = source->numChannels;
+    usesFloatingPointData = source->usesFloatingPointData;
+    metadataValues = source->metadataValues;
+
+    int frameBytes = juce::jmax(1, (int)(numChannels * bitsPerSample / 8));
+    samplesPerPage = juce::jmax(1, 4096 / frameBytes);
+    prefetchLength = (juce::int64)(prefetchSeconds * sampleRate);
+}
+
+bool MappedReader::readSamples(int* const* destChannels, int numDestChannels, int startOffsetInDestBuffer,
+                               juce::int64 startSampleInFile, int numSamples)
+{
+    juce::int64 end = startSampleInFile + numSamples;
+
+    // A read outside the prefetched window is a seek; start the window again there.
+    if (startSampleInFile < prefetchedUpTo - prefetchLength - numSamples || startSampleInFile > prefetchedUpTo)
+        prefetchedUpTo = startSampleInFile;
+
+    prefetch(prefetchedUpTo, end + prefetchLength);
+    return source->readSamples(destChannels, numDestChannels, startOffsetInDestBuffer, startSampleInFile, numSamples);
+}
+
+void MappedReader::prefetch(juce::int64 fromSample, juce::int64 toSample)
+{
+    fromSample = juce::jmax((juce::int64)0, fromSample);
+    toSample = juce::jmin(toSample, lengthInSamples);
+
+    for (auto sample = fromSample; sample < toSample; sample += samplesPerPage)
+        source->touchSample(sample);
+
+    prefetchedUpTo = juce::jmax(prefetchedUpTo, toSample);
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Reads uncompressed WAV/AIFF straight out of a memory-mapped file. Each read
+// touches the pages a few seconds ahead of it, so the read-ahead thread finds
+// the next blocks already in the page cache instead of faulting on them.
+class MappedReader : public juce::AudioFormatReader
+{
+public:
+    // Returns nullptr for anything that is not a mappable PCM WAV/AIFF file, in
+    // which case the caller should fall back to formatManager.createReaderFor().
+    static std::unique_ptr<juce::AudioFormatReader> create(juce::AudioFormatManager& formats, const juce::File& file,
+                                                           double prefetchSeconds = 4.0);
+
+    bool readSamples(int* const* destChannels, int numDestChannels, int startOffsetInDestBuffer,
+                     juce::int64 startSampleInFile, int numSamples) override;
+
+private:
+    MappedReader(std::unique_ptr<juce::MemoryMappedAudioFormatReader> mappedReader, double prefetchSeconds);
+    void prefetch(juce::int64 fromSample, juce::int64 toSample);
+
+    std::unique_ptr<juce::MemoryMappedAudioFormatReader> source;
+    juce::int64 prefetchLength = 0;
+    juce::int64 prefetchedUpTo = 0;
+    int samplesPerPage = 1;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MappedReader)
+};
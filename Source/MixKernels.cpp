@@ -0,0 +1,419 @@
+#include "MixKernels.h"
+
+#if JUCE_USE_SSE_INTRINSICS
+ #include <immintrin.h>
+#elif JUCE_USE_ARM_NEON
+ #include <arm_neon.h>
+#endif
+
+#if JUCE_USE_SSE_INTRINSICS && (JUCE_GCC || JUCE_CLANG)
+ #define MIXKERNELS_HAS_AVX2 1
+#else
+ #define MIXKERNELS_HAS_AVX2 0
+#endif
+
+namespace MixKernels
+{
+    void GainRamp::setTarget(float newTarget)
+    {
+        if (newTarget == target)
+            return;
+
+        target = newTarget;
+        remaining = rampLength;
+        step = (target - current) / (float)rampLength;
+    }
+
+    void GainRamp::setCurrentAndTarget(float value)
+    {
+        current = target = value;
+        remaining = 0;
+        step = 0.0f;
+    }
+
+    void GainRamp::advance(int numSamples)
+    {
+        if (!isRamping())
+            return;
+
+        if (numSamples >= remaining)
+        {
+            current = target;
+            remaining = 0;
+        }
+        else
+        {
+            current += step * (float)numSamples;
+            remaining -= numSamples;
+        }
+    }
+
+    namespace
+    {
+        // The scalar loops also finish off the samples left over by the vector
+        // loops, so they take the index to begin at.
+        void applyRampScalar(float* dest, int begin, int numSamples, float start, float step)
+        {
+            for (int i = begin; i < numSamples; ++i)
+                dest[i] *= start + step * (float)i;
+        }
+
+        void addWithRampScalar(float* dest, const float* src, int begin, int numSamples, float start, float step)
+        {
+            for (int i = begin; i < numSamples; ++i)
+                dest[i] += src[i] * (start + step * (float)i);
+        }
+
+        void mixPairScalar(float* dest, const float* other, int begin, int numSamples, float startA, float stepA, float startB, float stepB)
+        {
+            for (int i = begin; i < numSamples; ++i)
+                dest[i] = dest[i] * (startA + stepA * (float)i) + other[i] * (startB + stepB * (float)i);
+        }
+
+        float sumOfSquaresScalar(const float* src, int begin, int numSamples)
+        {
+            float sum = 0.0f;
+            for (int i = begin; i < numSamples; ++i)
+                sum += src[i] * src[i];
+            return sum;
+        }
+
+       #if !JUCE_USE_SSE_INTRINSICS && !JUCE_USE_ARM_NEON
+        void applyRampPlain(float* dest, int numSamples, float start, float step) { applyRampScalar(dest, 0, numSamples, start, step); }
+        void addWithRampPlain(float* dest, const float* src, int numSamples, float start, float step) { addWithRampScalar(dest, src, 0, numSamples, start, step); }
+        void mixPairPlain(float* dest, const float* other, int numSamples, float startA, float stepA, float startB, float stepB)
+        {
+            mixPairScalar(dest, other, 0, numSamples, startA, stepA, startB, stepB);
+        }
+        float sumOfSquaresPlain(const float* src, int numSamples) { return sumOfSquaresScalar(src, 0, numSamples); }
+       #endif
+
+       #if JUCE_USE_SSE_INTRINSICS
+        __m128 rampVector4(float start, float step)
+        {
+            return _mm_setr_ps(start, start + step, start + 2.0f * step, start + 3.0f * step);
+        }
+
+        void applyRampSSE(float* dest, int numSamples, float start, float step)
+        {
+            auto gain = rampVector4(start, step);
+            auto increment = _mm_set1_ps(4.0f * step);
+            int i = 0;
+            for (; i + 4 <= numSamples; i += 4)
+            {
+                _mm_storeu_ps(dest + i, _mm_mul_ps(_mm_loadu_ps(dest + i), gain));
+                gain = _mm_add_ps(gain, increment);
+            }
+            applyRampScalar(dest, i, numSamples, start, step);
+        }
+
+        void addWithRampSSE(float* dest, const float* src, int numSamples, float start, float step)
+        {
+            auto gain = rampVector4(start, step);
+            auto increment = _mm_set1_ps(4.0f * step);
+            int i = 0;
+            for (; i + 4 <= numSamples; i += 4)
+            {
+                _mm_storeu_ps(dest + i, _mm_add_ps(_mm_loadu_ps(dest + i), _mm_mul_ps(_mm_loadu_ps(src + i), gain)));
+                gain = _mm_add_ps(gain, increment);
+            }
+            addWithRampScalar(dest, src, i, numSamples, start, step);
+        }
+
+        void mixPairSSE(float* dest, const float* other, int numSamples, float startA, float stepA, float startB, float stepB)
+        {
+            auto gainA = rampVector4(startA, stepA);
+            auto gainB = rampVector4(startB, stepB);
+            auto incrementA = _mm_set1_ps(4.0f * stepA);
+            auto incrementB = _mm_set1_ps(4.0f * stepB);
+            int i = 0;
+            for (; i + 4 <= numSamples; i += 4)
+            {
+                auto mixed = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(dest + i), gainA), _mm_mul_ps(_mm_loadu_ps(other + i), gainB));
+                _mm_storeu_ps(dest + i, mixed);
+                gainA = _mm_add_ps(gainA, incrementA);
+                gainB = _mm_add_ps(gainB, incrementB);
+            }
+            mixPairScalar(dest, other, i, numSamples, startA, stepA, startB, stepB);
+        }
+
+        float sumOfSquaresSSE(const float* src, int numSamples)
+        {
+            auto sum = _mm_setzero_ps();
+            int i = 0;
+            for (; i + 4 <= numSamples; i += 4)
+            {
+                auto x = _mm_loadu_ps(src + i);
+                sum = _mm_add_ps(sum, _mm_mul_ps(x, x));
+            }
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, sum);
+            return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sumOfSquaresScalar(src, i, numSamples);
+        }
+       #endif
+
+       #if MIXKERNELS_HAS_AVX2
+        __attribute__((target("avx2,fma"))) __m256 rampVector8(float start, float step)
+        {
+            return _mm256_fmadd_ps(_mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f), _mm256_set1_ps(step), _mm256_set1_ps(start));
+        }
+
+        __attribute__((target("avx2,fma"))) void applyRampAVX(float* dest, int numSamples, float start, float step)
+        {
+            auto gain = rampVector8(start, step);
+            auto increment = _mm256_set1_ps(8.0f * step);
+            int i = 0;
+            for (; i + 8 <= numSamples; i += 8)
+            {
+                _mm256_storeu_ps(dest + i, _mm256_mul_ps(_mm256_loadu_ps(dest + i), gain));
+                gain = _mm256_add_ps(gain, increment);
+            }
+            applyRampScalar(dest, i, numSamples, start, step);
+        }
+
+        __attribute__((target("avx2,fma"))) void addWithRampAVX(float* dest, const float* src, int numSamples, float start, float step)
+        {
+            auto gain = rampVector8(start, step);
+            auto increment = _mm256_set1_ps(8.0f * step);
+            int i = 0;
+            for (; i + 8 <= numSamples; i += 8)
+            {
+                _mm256_storeu_ps(dest + i, _mm256_fmadd_ps(_mm256_loadu_ps(src + i), gain, _mm256_loadu_ps(dest + i)));
+                gain = _mm256_add_ps(gain, increment);
+            }
+            addWithRampScalar(dest, src, i, numSamples, start, step);
+        }
+
+        __attribute__((target("avx2,fma"))) void mixPairAVX(float* dest, const float* other, int numSamples,
+                                                              float startA, float stepA, float startB, float stepB)
+        {
+            auto gainA = rampVector8(startA, stepA);
+            auto gainB = rampVector8(startB, stepB);
+            auto incrementA = _mm256_set1_ps(8.0f * stepA);
+            auto incrementB = _mm256_set1_ps(8.0f * stepB);
+            int i = 0;
+            for (; i + 8 <= numSamples; i += 8)
+            {
+                auto scaled = _mm256_mul_ps(_mm256_loadu_ps(dest + i), gainA);
+                _mm256_storeu_ps(dest + i, _mm256_fmadd_ps(_mm256_loadu_ps(other + i), gainB, scaled));
+                gainA = _mm256_add_ps(gainA, incrementA);
+                gainB = _mm256_add_ps(gainB, incrementB);
+            }
+            mixPairScalar(dest, other, i, numSamples, startA, stepA, startB, stepB);
+        }
+
+        __attribute__((target("avx2,fma"))) float sumOfSquaresAVX(const float* src, int numSamples)
+        {
+            auto sum = _mm256_setzero_ps();
+            int i = 0;
+            for (; i + 8 <= numSamples; i += 8)
+            {
+                auto x = _mm256_loadu_ps(src + i);
+                sum = _mm256_fmadd_ps(x, x, sum);
+            }
+            alignas(32) float lanes[8];
+            _mm256_store_ps(lanes, sum);
+            float total = sumOfSquaresScalar(src, i, numSamples);
+            for (auto lane : lanes)
+                total += lane;
+            return total;
+        }
+       #endif
+
+       #if JUCE_USE_ARM_NEON
+        float32x4_t rampVectorNeon(float start, float step)
+        {
+            const float lanes[4] = { start, start + step, start + 2.0f * step, start + 3.0f * step };
+            return vld1q_f32(lanes);
+        }
+
+        void applyRampNeon(float* dest, int numSamples, float start, float step)
+        {
+            auto gain = rampVectorNeon(start, step);
+            auto increment = vdupq_n_f32(4.0f * step);
+            int i = 0;
+            for (; i + 4 <= numSamples; i += 4)
+            {
+                vst1q_f32(dest + i, vmulq_f32(vld1q_f32(dest + i), gain));
+                gain = vaddq_f32(gain, increment);
+            }
+            applyRampScalar(dest, i, numSamples, start, step);
+        }
+
+        void addWithRampNeon(float* dest, const float* src, int numSamples, float start, float step)
+        {
+            auto gain = rampVectorNeon(start, step);
+            auto increment = vdupq_n_f32(4.0f * step);
+            int i = 0;
+            for (; i + 4 <= numSamples; i += 4)
+            {
+                vst1q_f32(dest + i, vmlaq_f32(vld1q_f32(dest + i), vld1q_f32(src + i), gain));
+                gain = vaddq_f32(gain, increment);
+            }
+            addWithRampScalar(dest, src, i, numSamples, start, step);
+        }
+
+        void mixPairNeon(float* dest, const float* other, int numSamples, float startA, float stepA, float startB, float stepB)
+        {
+            auto gainA = rampVectorNeon(startA, stepA);
+            auto gainB = rampVectorNeon(startB, stepB);
+            auto incrementA = vdupq_n_f32(4.0f * stepA);
+            auto incrementB = vdupq_n_f32(4.0f * stepB);
+            int i = 0;
+            for (; i + 4 <= numSamples; i += 4)
+            {
+                vst1q_f32(dest + i, vmlaq_f32(vmulq_f32(vld1q_f32(dest + i), gainA), vld1q_f32(other + i), gainB));
+                gainA = vaddq_f32(gainA, incrementA);
+                gainB = vaddq_f32(gainB, incrementB);
+            }
+            mixPairScalar(dest, other, i, numSamples, startA, stepA, startB, stepB);
+        }
+
+        float sumOfSquaresNeon(const float* src, int numSamples)
+        {
+            auto sum = vdupq_n_f32(0.0f);
+            int i = 0;
+            for (; i + 4 <= numSamples; i += 4)
+            {
+                auto x = vld1q_f32(src + i);
+                sum = vmlaq_f32(sum, x, x);
+            }
+            float lanes[4];
+            vst1q_f32(lanes, sum);
+            return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sumOfSquaresScalar(src, i, numSamples);
+        }
+       #endif
+
+        struct KernelSet
+        {
+            const char* name;
+            void (*applyRamp)(float*, int, float, float);
+            void (*addWithRamp)(float*, const float*, int, float, float);
+            void (*mixPair)(float*, const float*, int, float, float, float, float);
+            float (*sumOfSquares)(const float*, int);
+        };
+
+        KernelSet selectKernels()
+        {
+           #if MIXKERNELS_HAS_AVX2
+            if (juce::SystemStats::hasAVX2() && juce::SystemStats::hasFMA3())
+                return { "AVX2+FMA", applyRampAVX, addWithRampAVX, mixPairAVX, sumOfSquaresAVX };
+           #endif
+           #if JUCE_USE_SSE_INTRINSICS
+            return { "SSE", applyRampSSE, addWithRampSSE, mixPairSSE, sumOfSquaresSSE };
+           #elif JUCE_USE_ARM_NEON
+            return { "NEON", applyRampNeon, addWithRampNeon, mixPairNeon, sumOfSquaresNeon };
+           #else
+            return { "scalar", applyRampPlain, addWithRampPlain, mixPairPlain, sumOfSquaresPlain };
+           #endif
+        }
+
+        const KernelSet& getKernels()
+        {
+            static const KernelSet kernels = selectKernels();
+            return kernels;
+        }
+    }
+
+    void applyRamp(float* dest, int numSamples, float start, float step)
+    {
+        getKernels().applyRamp(dest, numSamples, start, step);
+    }
+
+    void addWithRamp(float* dest, const float* src, int numSamples, float start, float step)
+    {
+        getKernels().addWithRamp(dest, src, numSamples, start, step);
+    }
+
+    void mixPair(float* dest, const float* other, int numSamples, float startA, float stepA, float startB, float stepB)
+    {
+        getKernels().mixPair(dest, other, numSamples, startA, stepA, startB, stepB);
+    }
+
+    float sumOfSquares(const float* src, int numSamples)
+    {
+        return getKernels().sumOfSquares(src, numSamples);
+    }
+
+    void applyGain(juce::AudioBuffer<float>& buffer, int startSample, int numSamples, GainRamp& ramp)
+    {
+        while (numSamples > 0)
+        {
+            int segment = ramp.getSegmentLength(numSamples);
+            float gain = ramp.getCurrent();
+            float step = ramp.getStep();
+
+            for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            {
+                auto* data = buffer.getWritePointer(ch, startSample);
+                if (step != 0.0f)
+                    applyRamp(data, segment, gain, step);
+                else if (gain == 0.0f)
+                    juce::FloatVectorOperations::clear(data, segment);
+                else if (gain != 1.0f)
+                    juce::FloatVectorOperations::multiply(data, gain, segment);
+            }
+
+            ramp.advance(segment);
+            startSample += segment;
+            numSamples -= segment;
+        }
+    }
+
+    void addWithGain(juce::AudioBuffer<float>& dest, int destStart, const juce::AudioBuffer<float>& src, int srcStart,
+                     int numSamples, GainRamp& ramp)
+    {
+        int numChannels = juce::jmin(dest.getNumChannels(), src.getNumChannels());
+        while (numSamples > 0)
+        {
+            int segment = ramp.getSegmentLength(numSamples);
+            float gain = ramp.getCurrent();
+            float step = ramp.getStep();
+
+            for (int ch = 0; ch < numChannels && (step != 0.0f || gain != 0.0f); ++ch)
+            {
+                auto* out = dest.getWritePointer(ch, destStart);
+                auto* in = src.getReadPointer(ch, srcStart);
+                if (step != 0.0f)
+                    addWithRamp(out, in, segment, gain, step);
+                else
+                    juce::FloatVectorOperations::addWithMultiply(out, in, gain, segment);
+            }
+
+            ramp.advance(segment);
+            destStart += segment;
+            srcStart += segment;
+            numSamples -= segment;
+        }
+    }
+
+    void mixPair(juce::AudioBuffer<float>& dest, int destStart, GainRamp& destRamp,
+                 const juce::AudioBuffer<float>& other, int otherStart, GainRamp& otherRamp, int numSamples)
+    {
+        int numChannels = juce::jmin(dest.getNumChannels(), other.getNumChannels());
+        while (numSamples > 0)
+        {
+            int segment = otherRamp.getSegmentLength(destRamp.getSegmentLength(numSamples));
+            float gainA = destRamp.getCurrent();
+            float gainB = otherRamp.getCurrent();
+            float stepA = destRamp.getStep();
+            float stepB = otherRamp.getStep();
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                mixPair(dest.getWritePointer(ch, destStart), other.getReadPointer(ch, otherStart), segment, gainA, stepA, gainB, stepB);
+            for (int ch = numChannels; ch < dest.getNumChannels(); ++ch)
+                applyRamp(dest.getWritePointer(ch, destStart), segment, gainA, stepA);
+
+            destRamp.advance(segment);
+            otherRamp.advance(segment);
+            destStart += segment;
+            otherStart += segment;
+            numSamples -= segment;
+        }
+    }
+
+    const char* getInstructionSet()
+    {
+        return getKernels().name;
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <JuceHeader.h>
+
+namespace MixKernels
+{
+    // Linear per-sample ramp towards a target gain over a fixed time, so gain,
+    // mute and start/stop changes fade the same way whatever the block size.
+    class GainRamp
+    {
+    public:
+        void prepare(double sampleRate, double rampSeconds) { rampLength = juce::jmax(1, juce::roundToInt(sampleRate * rampSeconds)); }
+        void setTarget(float newTarget);
+        void setCurrentAndTarget(float value);
+
+        float getCurrent() const { return current; }
+        float getTarget() const { return target; }
+        bool isRamping() const { return remaining > 0; }
+        bool isSilent() const { return current == 0.0f && target == 0.0f; }
+
+        int getSegmentLength(int numSamples) const { return isRamping() ? juce::jmin(remaining, numSamples) : numSamples; }
+        float getStep() const { return isRamping() ? step : 0.0f; }
+        void advance(int numSamples);
+
+    private:
+        float current = 0.0f;
+        float target = 0.0f;
+        float step = 0.0f;
+        int remaining = 0;
+        int rampLength = 512;
+    };
+
+    // dest[i] *= start + step * i
+    void applyRamp(float* dest, int numSamples, float start, float step);
+    // dest[i] += src[i] * (start + step * i)
+    void addWithRamp(float* dest, const float* src, int numSamples, float start, float step);
+    // dest[i] = dest[i] * (startA + stepA * i) + other[i] * (startB + stepB * i)
+    void mixPair(float* dest, const float* other, int numSamples, float startA, float stepA, float startB, float stepB);
+    // sum of src[i] * src[i]
+    float sumOfSquares(const float* src, int numSamples);
+
+    void applyGain(juce::AudioBuffer<float>& buffer, int startSample, int numSamples, GainRamp& ramp);
+    void addWithGain(juce::AudioBuffer<float>& dest, int destStart, const juce::AudioBuffer<float>& src, int srcStart,
+                     int numSamples, GainRamp& ramp);
+    void mixPair(juce::AudioBuffer<float>& dest, int destStart, GainRamp& destRamp,
+                 const juce::AudioBuffer<float>& other, int otherStart, GainRamp& otherRamp, int numSamples);
+
+    // Name of the kernel set picked for this CPU. Calling it once off the audio
+    // thread also does the one-time CPU detection there.
+    const char* getInstructionSet();
+}
@@ -0,0 +1,209 @@
+#include "OfflineRenderer.h"
+#include <iostream>
+
+juce::Result RenderSettings::parse(const juce::ArgumentList& args, RenderSettings& settings)
+{
+    auto getFile = [&args](const char* option)
+    {
+        auto value = args.getValueForOption(option);
+        return value.isEmpty() ? juce::File() : juce::File::getCurrentWorkingDirectory().getChildFile(value.unquoted());
+    };
+
+    auto getNumber = [&args](const char* option, double defaultValue)
+    {
+        auto value = args.getValueForOption(option);
+        return value.isEmpty() ? defaultValue : value.getDoubleValue();
+    };
+
+    settings.outputFile = getFile("--render");
+    settings.mainFile = getFile("--main");
+    settings.mixerFile = getFile("--mixer");
+    settings.mainGain = (float)getNumber("--main-gain", settings.mainGain);
+    settings.mixerGain = (float)getNumber("--mixer-gain", settings.mixerGain);
+    settings.mainSpeed = getNumber("--main-speed", settings.mainSpeed);
+    settings.mixerSpeed = getNumber("--mixer-speed", settings.mixerSpeed);
+    settings.loopStart = getNumber("--loop-start", settings.loopStart);
+    settings.loopEnd = getNumber("--loop-end", settings.loopEnd);
+    settings.lengthSeconds = getNumber("--length", settings.lengthSeconds);
+    settings.sampleRate = getNumber("--rate", settings.sampleRate);
+    settings.blockSize = (int)getNumber("--block", settings.blockSize);
+    settings.bitsPerSample = (int)getNumber("--bits", settings.bitsPerSample);
+    settings.inMemory = args.containsOption("--in-memory");
+
+    auto stretch = args.getValueForOption("--stretch");
+    if (stretch.isNotEmpty())
+    {
+        juce::StringArray names { "off", "fast", "normal", "high" };
+        if (!names.contains(stretch))
+            return juce::Result::fail("--stretch must be one of off, fast, normal or high");
+        settings.stretch = (TimeStretchSource::Quality)names.indexOf(stretch);
+    }
+
+    if (settings.outputFile == juce::File())
+        return juce::Result::fail("Missing --render=<output.wav|output.flac>");
+    if (!settings.outputFile.hasFileExtension("wav;flac"))
+        return juce::Result::fail("Output must be a .wav or .flac file");
+    if (!settings.mainFile.existsAsFile())
+        return juce::Result::fail("Missing or unreadable --main=<file>");
+    if (settings.mixerFile != juce::File() && !settings.mixerFile.existsAsFile())
+        return juce::Result::fail("Cannot find " + settings.mixerFile.getFullPathName());
+    if (settings.sampleRate < 8000.0 || settings.sampleRate > 384000.0)
+        return juce::Result::fail("--rate must be between 8000 and 384000");
+    if (settings.blockSize < 16 || settings.blockSize > 65536)
+        return juce::Result::fail("--block must be between 16 and 65536");
+    if (settings.hasLoop() && settings.lengthSeconds <= 0.0)
+        return juce::Result::fail("--length is required when rendering an A-B loop");
+    return juce::Result::ok();
+}
+
+OfflineRenderer::OfflineRenderer()
+{
+    audio.setOfflineRendering(true);
+    // Renders use the gains given on the command line, not whatever the
+    // loudness scans have finished by the time each deck loads.
+    audio.setNormalisation(false);
+}
+
+juce::Result OfflineRenderer::loadDeck(int deckIndex, const juce::File& file, float gain, double speed, TimeStretchSource::Quality stretch)
+{
+    audio.loadFile(deckIndex, file);
+    auto& deck = audio.getDeck(deckIndex);
+    if (!deck.hasTrack())
+        return juce::Result::fail("Could not open " + file.getFullPathName());
+
+    deck.setGain(gain);
+    deck.setSpeed(speed);
+    deck.setTimeStretchQuality(stretch);
+    return juce::Result::ok();
+}
+
+std::unique_ptr<juce::AudioFormatWriter> OfflineRenderer::createWriter(const RenderSettings& settings, juce::String& error)
+{
+    std::unique_ptr<juce::AudioFormat> format;
+    if (settings.outputFile.hasFileExtension("flac"))
+        format = std::make_unique<juce::FlacAudioFormat>();
+    else
+        format = std::make_unique<juce::WavAudioFormat>();
+
+    if (!format->getPossibleBitDepths().contains(settings.bitsPerSample))
+    {
+        error = format->getFormatName() + " cannot be written at " + juce::String(settings.bitsPerSample) + " bits";
+        return nullptr;
+    }
+
+    settings.outputFile.deleteFile();
+    std::unique_ptr<juce::OutputStream> stream = settings.outputFile.createOutputStream();
+    if (stream == nullptr)
+    {
+        error = "Cannot write " + settings.outputFile.getFullPathName();
+        return nullptr;
+    }
+
+    std::unique_ptr<juce::AudioFormatWriter> writer(format->createWriterFor(stream.get(), settings.sampleRate, 2,
+                                                                            settings.bitsPerSample, {}, 0));
+    if (writer == nullptr)
+    {
+        error = "Cannot create a " + format->getFormatName() + " writer";
+        return nullptr;
+    }
+
+    stream.release();
+    return writer;
+}
+
+juce::Result OfflineRenderer::render(const RenderSettings& settings, RenderStats& stats)
+{
+    audio.prepareToPlay(settings.blockSize, settings.sampleRate);
+    audio.setInMemoryMode(settings.inMemory);
+
+    auto result = loadDeck(PlayerAudio::mainDeckIndex, settings.mainFile, settings.mainGain, settings.mainSpeed, settings.stretch);
+    if (result.wasOk() && settings.mixerFile != juce::File())
+        result = loadDeck(PlayerAudio::mixerDeckIndex, settings.mixerFile, settings.mixerGain, settings.mixerSpeed, settings.stretch);
+    if (result.failed())
+        return result;
+
+    if (settings.hasLoop())
+        audio.setABLooping(true, settings.loopStart, settings.loopEnd);
+
+    double lengthSeconds = settings.lengthSeconds;
+    if (lengthSeconds <= 0.0)
+    {
+        for (int i = 0; i < audio.getNumDecks(); ++i)
+        {
+            auto& deck = audio.getDeck(i);
+            if (deck.hasTrack())
+                lengthSeconds = juce::jmax(lengthSeconds, deck.getLengthInSeconds() / deck.getSpeed());
+        }
+    }
+
+    juce::String error;
+    auto writer = createWriter(settings, error);
+    if (writer == nullptr)
+        return juce::Result::fail(error);
+
+    juce::AudioBuffer<float> buffer(2, settings.blockSize);
+    auto totalSamples = (juce::int64)(lengthSeconds * settings.sampleRate);
+    auto startTicks = juce::Time::getHighResolutionTicks();
+
+    audio.play();
+    for (juce::int64 done = 0; done < totalSamples;)
+    {
+        int numSamples = (int)juce::jmin((juce::int64)settings.blockSize, totalSamples - done);
+        audio.getNextAudioBlock(juce::AudioSourceChannelInfo(&buffer, 0, numSamples));
+        if (!writer->writeFromAudioSampleBuffer(buffer, 0, numSamples))
+            return juce::Result::fail("Write failed: " + settings.outputFile.getFullPathName());
+        done += numSamples;
+    }
+
+    writer.reset();
+    stats.elapsedSeconds = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks);
+    stats.renderedSeconds = (double)totalSamples / settings.sampleRate;
+    stats.underruns = 0;
+    for (int i = 0; i < audio.getNumDecks(); ++i)
+        stats.underruns += audio.getDeck(i).getUnderrunCount();
+
+    audio.releaseResources();
+    return juce::Result::ok();
+}
+
+bool OfflineRenderer::isRenderCommandLine(const juce::String& commandLine)
+{
+    return commandLine.contains("--render");
+}
+
+juce::String OfflineRenderer::getUsage()
+{
+    return "Usage: audioPlayer --render=<out.wav|out.flac> --main=<file> [--mixer=<file>]\n"
+           "       [--main-gain=1] [--mixer-gain=1] [--main-speed=1] [--mixer-speed=1]\n"
+           "       [--loop-start=<sec> --loop-end=<sec> --length=<sec>] [--length=<sec>]\n"
+           "       [--stretch=off|fast|normal|high] [--rate=44100] [--block=512] [--bits=24]\n"
+           "       [--in-memory]\n";
+}
+
+int OfflineRenderer::runFromCommandLine(const juce::String& commandLine)
+{
+    juce::ArgumentList args("audioPlayer", juce::StringArray::fromTokens(commandLine, true));
+
+    RenderSettings settings;
+    auto result = RenderSettings::parse(args, settings);
+    if (result.failed())
+    {
+        std::cerr << result.getErrorMessage() << "\n" << getUsage();
+        return 1;
+    }
+
+    RenderStats stats;
+    OfflineRenderer renderer;
+    result = renderer.render(settings, stats);
+    if (result.failed())
+    {
+        std::cerr << result.getErrorMessage() << "\n";
+        return 1;
+    }
+
+    std::cout << "Rendered " << juce::String(stats.renderedSeconds, 2) << " s to " << settings.outputFile.getFullPathName()
+              << " in " << juce::String(stats.elapsedSeconds, 2) << " s ("
+              << juce::String(stats.getRealtimeFactor(), 1) << "x realtime, "
+              << stats.underruns << " underruns)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <JuceHeader.h>
+#include "PlayerAudio.h"
+
+struct RenderSettings
+{
+    juce::File outputFile;
+    juce::File mainFile;
+    juce::File mixerFile;
+    float mainGain = 1.0f;
+    float mixerGain = 1.0f;
+    double mainSpeed = 1.0;
+    double mixerSpeed = 1.0;
+    double loopStart = 0.0;
+    double loopEnd = 0.0;
+    double lengthSeconds = 0.0;
+    double sampleRate = 44100.0;
+    int blockSize = 512;
+    int bitsPerSample = 24;
+    bool inMemory = false;
+    TimeStretchSource::Quality stretch = TimeStretchSource::Quality::off;
+
+    bool hasLoop() const { return loopEnd > loopStart; }
+    static juce::Result parse(const juce::ArgumentList& args, RenderSettings& settings);
+};
+
+struct RenderStats
+{
+    double renderedSeconds = 0.0;
+    double elapsedSeconds = 0.0;
+    int underruns = 0;
+
+    double getRealtimeFactor() const { return elapsedSeconds > 0.0 ? renderedSeconds / elapsedSeconds : 0.0; }
+};
+
+// Pulls PlayerAudio as fast as the decoders allow and writes the mix to a
+// WAV or FLAC file, without an audio device.
+class OfflineRenderer
+{
+public:
+    OfflineRenderer();
+
+    juce::Result render(const RenderSettings& settings, RenderStats& stats);
+
+    static bool isRenderCommandLine(const juce::String& commandLine);
+    static int runFromCommandLine(const juce::String& commandLine);
+    static juce::String getUsage();
+
+private:
+    juce::Result loadDeck(int deckIndex, const juce::File& file, float gain, double speed, TimeStretchSource::Quality stretch);
+    std::unique_ptr<juce::AudioFormatWriter> createWriter(const RenderSettings& settings, juce::String& error);
+
+    PlayerAudio audio;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OfflineRenderer)
+};
@@ -0,0 +1,379 @@
+#include "PeakCache.h"
+#include "TrackCache.h"
+#include "MappedReader.h"
+
+namespace
+{
+    const juce::int32 peakFileMagic = 0x4b505041;
+    const juce::int32 peakFileVersion = 2;
+    const juce::int64 maxCacheBytes = 256 * 1024 * 1024;
+
+    juce::int8 quantise(float value)
+    {
+        return (juce::int8)juce::jlimit(-127, 127, juce::roundToInt(value * 127.0f));
+    }
+}
+
+void PeakPyramid::initialise(int channels, juce::int64 length, double rate)
+{
+    numChannels = channels;
+    lengthInSamples = length;
+    sampleRate = rate;
+    levels.clear();
+
+    int samplesPerPeak = baseSamplesPerPeak;
+    for (;;)
+    {
+        auto* level = levels.add(new Level());
+        level->samplesPerPeak = samplesPerPeak;
+        level->numPeaks = (int)((length + samplesPerPeak - 1) / samplesPerPeak);
+        level->data.resize((size_t)numChannels * (size_t)level->numPeaks * 2, 0);
+
+        if (level->numPeaks <= 1024)
+            break;
+        samplesPerPeak *= levelFactor;
+    }
+}
+
+bool PeakPyramid::build(juce::AudioFormatReader& reader, const std::function<bool()>& shouldStop)
+{
+    if (reader.lengthInSamples <= 0 || reader.sampleRate <= 0.0)
+        return false;
+
+    initialise(juce::jlimit(1, 2, (int)reader.numChannels), reader.lengthInSamples, reader.sampleRate);
+    ready = true;
+
+    const int chunkSize = baseSamplesPerPeak * 256;
+    juce::AudioBuffer<float> buffer(numChannels, chunkSize);
+    auto& base = *levels[0];
+
+    for (juce::int64 pos = 0; pos < lengthInSamples; pos += chunkSize)
+    {
+        if (shouldStop())
+            return false;
+
+        int numSamples = (int)juce::jmin((juce::int64)chunkSize, lengthInSamples - pos);
+        reader.read(&buffer, 0, numSamples, pos, true, true);
+
+        int firstPeak = (int)(pos / baseSamplesPerPeak);
+        int numPeaksInChunk = (numSamples + baseSamplesPerPeak - 1) / baseSamplesPerPeak;
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            const float* samples = buffer.getReadPointer(ch);
+            for (int i = 0; i < numPeaksInChunk; ++i)
+            {
+                int start = i * baseSamplesPerPeak;
+                auto range = juce::FloatVectorOperations::findMinAndMax(samples + start, juce::jmin(baseSamplesPerPeak, numSamples - start));
+                auto* peak = base.getPeak(ch, firstPeak + i);
+                peak[0] = quantise(range.getStart());
+                peak[1] = quantise(range.getEnd());
+            }
+        }
+
+        base.peaksReady = firstPeak + numPeaksInChunk;
+        reduceLevels(pos + chunkSize >= lengthInSamples);
+    }
+
+    complete = true;
+    return true;
+}
+
+void PeakPyramid::reduceLevels(bool finished)
+{
+    for (int l = 1; l < levels.size(); ++l)
+    {
+        auto& source = *levels[l - 1];
+        auto& dest = *levels[l];
+        int sourceReady = source.peaksReady.load();
+        int target = finished ? dest.numPeaks : sourceReady / levelFactor;
+
+        for (int p = dest.peaksReady.load(); p < target; ++p)
+        {
+            int first = p * levelFactor;
+            int last = juce::jmin(first + levelFactor, sourceReady);
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                juce::int8 lo = 127, hi = -127;
+                for (int s = first; s < last; ++s)
+                {
+                    auto* peak = source.getPeak(ch, s);
+                    lo = juce::jmin(lo, peak[0]);
+                    hi = juce::jmax(hi, peak[1]);
+                }
+                auto* out = dest.getPeak(ch, p);
+                out[0] = lo;
+                out[1] = hi;
+            }
+        }
+        dest.peaksReady = target;
+    }
+}
+
+bool PeakPyramid::getRange(int channel, juce::int64 startSample, juce::int64 endSample, float& minValue, float& maxValue) const
+{
+    if (!ready || channel < 0 || channel >= numChannels || levels.isEmpty())
+        return false;
+
+    juce::int64 span = juce::jmax((juce::int64)1, endSample - startSample);
+    const Level* level = levels[0];
+    for (auto* candidate : levels)
+        if (candidate->samplesPerPeak <= span)
+            level = candidate;
+
+    int first = (int)juce::jmax((juce::int64)0, startSample / level->samplesPerPeak);
+    int last = (int)juce::jmin((juce::int64)level->peaksReady.load(), (endSample + level->samplesPerPeak - 1) / level->samplesPerPeak);
+    last = juce::jmax(last, juce::jmin(first + 1, level->peaksReady.load()));
+    if (first >= last)
+        return false;
+
+    juce::int8 lo = 127, hi = -127;
+    for (int p = first; p < last; ++p)
+    {
+        auto* peak = level->getPeak(channel, p);
+        lo = juce::jmin(lo, peak[0]);
+        hi = juce::jmax(hi, peak[1]);
+    }
+
+    minValue = lo / 127.0f;
+    maxValue = hi / 127.0f;
+    return true;
+}
+
+bool PeakPyramid::writeTo(const juce::File& file, const juce::File& sourceFile) const
+{
+    if (!complete)
+        return false;
+
+    file.getParentDirectory().createDirectory();
+    juce::TemporaryFile temp(file);
+    {
+        juce::FileOutputStream out(temp.getFile());
+        if (!out.openedOk())
+            return false;
+
+        out.writeInt(peakFileMagic);
+        out.writeInt(peakFileVersion);
+        out.writeInt64(sourceFile.getSize());
+        out.writeInt(numChannels);
+        out.writeInt64(lengthInSamples);
+        out.writeDouble(sampleRate);
+        out.writeInt(levels.size());
+
+        for (auto* level : levels)
+        {
+            out.writeInt(level->samplesPerPeak);
+            out.writeInt(level->numPeaks);
+            out.write(level->data.data(), level->data.size());
+        }
+
+        out.flush();
+        if (out.getStatus().failed())
+            return false;
+    }
+    return temp.overwriteTargetFileWithTemporary();
+}
+
+bool PeakPyramid::readFrom(const juce::File& file, const juce::File& sourceFile)
+{
+    juce::FileInputStream in(file);
+    if (!in.openedOk())
+        return false;
+
+    if (in.readInt() != peakFileMagic || in.readInt() != peakFileVersion)
+        return false;
+
+    if (in.readInt64() != sourceFile.getSize())
+        return false;
+
+    int channels = in.readInt();
+    juce::int64 length = in.readInt64();
+    double rate = in.readDouble();
+    int numLevels = in.readInt();
+    if (channels < 1 || channels > 2 || length <= 0 || rate <= 0.0)
+        return false;
+
+    // Check the header against what is actually left in the file before
+    // allocating, so a damaged length cannot ask for gigabytes. The base level
+    // alone takes a byte for every 128 samples of each channel.
+    auto remaining = in.getNumBytesRemaining();
+    if (length / (baseSamplesPerPeak / 2) > remaining)
+        return false;
+
+    juce::int64 expectedBytes = 0;
+    for (juce::int64 samplesPerPeak = baseSamplesPerPeak;; samplesPerPeak *= levelFactor)
+    {
+        auto numPeaks = (length + samplesPerPeak - 1) / samplesPerPeak;
+        expectedBytes += 8 + (juce::int64)channels * numPeaks * 2;
+        if (numPeaks <= 1024)
+            break;
+    }
+    if (expectedBytes != remaining)
+        return false;
+
+    initialise(channels, length, rate);
+    if (numLevels != levels.size())
+        return false;
+
+    for (auto* level : levels)
+    {
+        if (in.readInt() != level->samplesPerPeak || in.readInt() != level->numPeaks)
+            return false;
+        if (in.read(level->data.data(), (int)level->data.size()) != (int)level->data.size())
+            return false;
+        level->peaksReady = level->numPeaks;
+    }
+
+    ready = true;
+    complete = true;
+    return true;
+}
+
+class PeakCache::BuildJob : public juce::ThreadPoolJob
+{
+public:
+    BuildJob(PeakCache& owner, std::shared_ptr<PeakPyramid> pyramidToBuild, const juce::File& fileToScan,
+             const juce::String& cacheKey, juce::AudioFormatManager& formats)
+        : juce::ThreadPoolJob("Peak Scan"), cache(owner), pyramid(std::move(pyramidToBuild)), file(fileToScan),
+          key(cacheKey), formatManager(formats)
+    {
+    }
+
+    JobStatus runJob() override
+    {
+        auto cacheFile = TrackCache::getCacheFile(file, "peaks");
+        if (pyramid->readFrom(cacheFile, file))
+        {
+            cacheFile.setLastAccessTime(juce::Time::getCurrentTime());
+            return jobHasFinished;
+        }
+
+        auto reader = MappedReader::create(formatManager, file);
+        if (reader == nullptr)
+            reader.reset(formatManager.createReaderFor(file));
+        if (reader == nullptr)
+        {
+            cache.forget(key, pyramid, true);
+            return jobHasFinished;
+        }
+
+        auto shouldStop = [this] { return shouldExit() || cache.forget(key, pyramid, false); };
+        if (pyramid->build(*reader, shouldStop))
+        {
+            if (pyramid->writeTo(cacheFile, file))
+                TrackCache::trim(maxCacheBytes);
+        }
+        else
+        {
+            cache.forget(key, pyramid, true);
+        }
+
+        return jobHasFinished;
+    }
+
+private:
+    PeakCache& cache;
+    std::shared_ptr<PeakPyramid> pyramid;
+    juce::File file;
+    juce::String key;
+    juce::AudioFormatManager& formatManager;
+};
+
+class PeakCache::DetailJob : public juce::ThreadPoolJob
+{
+public:
+    DetailJob(PeakCache& owner, std::shared_ptr<PeakDetail> detailToRead, const juce::File& fileToRead,
+              juce::AudioFormatManager& formats, int channels)
+        : juce::ThreadPoolJob("Peak Detail"), cache(owner), detail(std::move(detailToRead)), file(fileToRead),
+          formatManager(formats), numChannels(channels)
+    {
+    }
+
+    JobStatus runJob() override
+    {
+        // Superseded by a newer range before it got this far.
+        if (detail.use_count() > 1 && !shouldExit())
+            read();
+
+        detail->finished = true;
+        return jobHasFinished;
+    }
+
+private:
+    void read()
+    {
+        if (cache.detailFile != file || cache.detailReader == nullptr)
+        {
+            cache.detailFile = file;
+            cache.detailReader = MappedReader::create(formatManager, file);
+            if (cache.detailReader == nullptr)
+                cache.detailReader.reset(formatManager.createReaderFor(file));
+            if (cache.detailReader == nullptr)
+                return;
+        }
+
+        auto range = detail->getRange();
+        int numSamples = (int)range.getLength() + 1;
+        detail->buffer.setSize(juce::jmax(1, numChannels), numSamples);
+        if (cache.detailReader->read(&detail->buffer, 0, numSamples, range.getStart(), true, true))
+            detail->ready = true;
+    }
+
+    PeakCache& cache;
+    std::shared_ptr<PeakDetail> detail;
+    juce::File file;
+    juce::AudioFormatManager& formatManager;
+    int numChannels;
+};
+
+PeakCache::PeakCache()
+{
+}
+
+PeakCache::~PeakCache()
+{
+    workers.removeAllJobs(true, 5000);
+    detailWorkers.removeAllJobs(true, 5000);
+}
+
+std::shared_ptr<PeakPyramid> PeakCache::getPeaks(const juce::File& file, juce::AudioFormatManager& formats)
+{
+    auto key = TrackCache::getKey(file);
+    const juce::ScopedLock sl(pyramidLock);
+
+    for (auto it = pyramids.begin(); it != pyramids.end();)
+        it = it->second.expired() ? pyramids.erase(it) : std::next(it);
+
+    auto found = pyramids.find(key);
+    if (found != pyramids.end())
+        if (auto existing = found->second.lock())
+            return existing;
+
+    auto pyramid = std::make_shared<PeakPyramid>();
+    pyramids[key] = pyramid;
+    workers.addJob(new BuildJob(*this, pyramid, file, key, formats), true);
+    return pyramid;
+}
+
+// Called by a BuildJob. Once nothing but the job holds the pyramid, or its
+// scan failed, it is taken out of the map under the lock so getPeaks() cannot
+// hand it out again after the job has decided to stop.
+bool PeakCache::forget(const juce::String& key, const std::shared_ptr<PeakPyramid>& pyramid, bool failed)
+{
+    const juce::ScopedLock sl(pyramidLock);
+    if (!failed && pyramid.use_count() > 1)
+        return false;
+
+    auto found = pyramids.find(key);
+    if (found != pyramids.end() && found->second.lock() == pyramid)
+        pyramids.erase(found);
+    return true;
+}
+
+std::shared_ptr<PeakDetail> PeakCache::getDetail(const juce::File& file, juce::AudioFormatManager& formats,
+                                                 juce::Range<juce::int64> range, int numChannels)
+{
+    auto detail = std::make_shared<PeakDetail>(range);
+    detailWorkers.addJob(new DetailJob(*this, detail, file, formats, numChannels), true);
+    return detail;
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <JuceHeader.h>
+
+class PeakPyramid
+{
+public:
+    static constexpr int baseSamplesPerPeak = 256;
+    static constexpr int levelFactor = 4;
+
+    PeakPyramid() = default;
+
+    bool build(juce::AudioFormatReader& reader, const std::function<bool()>& shouldStop);
+    bool writeTo(const juce::File& file, const juce::File& sourceFile) const;
+    bool readFrom(const juce::File& file, const juce::File& sourceFile);
+
+    bool getRange(int channel, juce::int64 startSample, juce::int64 endSample, float& minValue, float& maxValue) const;
+
+    bool isReady() const { return ready.load(); }
+    bool isComplete() const { return complete.load(); }
+    int getNumChannels() const { return numChannels; }
+    int getNumLevels() const { return levels.size(); }
+    juce::int64 getLengthInSamples() const { return lengthInSamples; }
+    double getSampleRate() const { return sampleRate; }
+    double getLengthInSeconds() const { return ready && sampleRate > 0.0 ? (double)lengthInSamples / sampleRate : 0.0; }
+
+private:
+    struct Level
+    {
+        int samplesPerPeak = 0;
+        int numPeaks = 0;
+        std::vector<juce::int8> data;
+        std::atomic<int> peaksReady { 0 };
+
+        juce::int8* getPeak(int channel, int peak) { return data.data() + ((size_t)channel * (size_t)numPeaks + (size_t)peak) * 2; }
+        const juce::int8* getPeak(int channel, int peak) const { return data.data() + ((size_t)channel * (size_t)numPeaks + (size_t)peak) * 2; }
+    };
+
+    void initialise(int channels, juce::int64 length, double rate);
+    void reduceLevels(bool finished);
+
+    juce::OwnedArray<Level> levels;
+    int numChannels = 0;
+    juce::int64 lengthInSamples = 0;
+    double sampleRate = 0.0;
+    std::atomic<bool> ready { false };
+    std::atomic<bool> complete { false };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PeakPyramid)
+};
+
+// The samples of one range of a file, for zoom levels finer than the
+// pyramid's base level. Decoded by a PeakCache job; the GUI polls isReady().
+class PeakDetail
+{
+public:
+    explicit PeakDetail(juce::Range<juce::int64> rangeToRead) : range(rangeToRead) {}
+
+    juce::Range<juce::int64> getRange() const { return range; }
+    bool isReady() const { return ready.load(); }
+    bool isFinished() const { return finished.load(); }
+    const juce::AudioBuffer<float>& getBuffer() const { return buffer; }
+
+private:
+    friend class PeakCache;
+
+    const juce::Range<juce::int64> range;
+    juce::AudioBuffer<float> buffer;
+    std::atomic<bool> ready { false };
+    std::atomic<bool> finished { false };
+};
+
+class PeakCache
+{
+public:
+    PeakCache();
+    ~PeakCache();
+
+    // Returns the pyramid already being scanned or shown for this file if
+    // there is one, otherwise starts a new scan.
+    std::shared_ptr<PeakPyramid> getPeaks(const juce::File& file, juce::AudioFormatManager& formats);
+    std::shared_ptr<PeakDetail> getDetail(const juce::File& file, juce::AudioFormatManager& formats,
+                                          juce::Range<juce::int64> range, int numChannels);
+
+private:
+    class BuildJob;
+    class DetailJob;
+
+    bool forget(const juce::String& key, const std::shared_ptr<PeakPyramid>& pyramid, bool failed);
+
+    juce::ThreadPool workers{1};
+    juce::CriticalSection pyramidLock;
+    std::map<juce::String, std::weak_ptr<PeakPyramid>> pyramids;
+    // A separate thread so zooming in is not held up by a peak scan. The
+    // reader is only touched by that thread and kept open between requests.
+    juce::ThreadPool detailWorkers{1};
+    juce::File detailFile;
+    std::unique_ptr<juce::AudioFormatReader> detailReader;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PeakCache)
+};
@@ -0,0 +1,217 @@
+#include "PerfMonitor.h"
+
+void PerfMonitor::record(juce::int64 elapsedTicks, int numSamples)
+{
+    double rate = sampleRate.load(std::memory_order_relaxed);
+    if (rate <= 0.0 || numSamples <= 0)
+        return;
+
+    if (resetRequested.exchange(false, std::memory_order_acquire))
+    {
+        callbacks.store(0, std::memory_order_relaxed);
+        overruns.store(0, std::memory_order_relaxed);
+        totalLoad.store(0.0, std::memory_order_relaxed);
+        maxLoad.store(0.0, std::memory_order_relaxed);
+        for (auto& count : histogram)
+            count.store(0, std::memory_order_relaxed);
+    }
+
+    double deadline = numSamples / rate;
+    double load = juce::Time::highResolutionTicksToSeconds(elapsedTicks) / deadline;
+    int bin = juce::jlimit(0, PerfSnapshot::numBins - 1, (int)(load / PerfSnapshot::binWidth));
+
+    // The audio thread is the only writer, so plain load/store pairs are enough.
+    histogram[(size_t)bin].store(histogram[(size_t)bin].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    callbacks.store(callbacks.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    totalLoad.store(totalLoad.load(std::memory_order_relaxed) + load, std::memory_order_relaxed);
+    lastDeadlineMs.store(deadline * 1000.0, std::memory_order_relaxed);
+    if (load > maxLoad.load(std::memory_order_relaxed))
+        maxLoad.store(load, std::memory_order_relaxed);
+    if (load >= 1.0)
+        overruns.store(overruns.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+void PerfMonitor::reset()
+{
+    resetRequested.store(true, std::memory_order_release);
+}
+
+PerfSnapshot PerfMonitor::getSnapshot() const
+{
+    PerfSnapshot snapshot;
+    snapshot.callbacks = callbacks.load(std::memory_order_relaxed);
+    snapshot.overruns = overruns.load(std::memory_order_relaxed);
+    snapshot.deadlineMs = lastDeadlineMs.load(std::memory_order_relaxed);
+    snapshot.maxLoad = maxLoad.load(std::memory_order_relaxed);
+    snapshot.averageLoad = snapshot.callbacks > 0 ? totalLoad.load(std::memory_order_relaxed) / (double)snapshot.callbacks : 0.0;
+    for (size_t i = 0; i < histogram.size(); ++i)
+        snapshot.histogram[i] = histogram[i].load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+double PerfSnapshot::getPercentileLoad(double percentile) const
+{
+    juce::int64 total = 0;
+    for (auto count : histogram)
+        total += count;
+    if (total == 0)
+        return 0.0;
+
+    auto threshold = (juce::int64)std::ceil(total * percentile);
+    juce::int64 seen = 0;
+    for (int i = 0; i < numBins; ++i)
+    {
+        seen += histogram[(size_t)i];
+        if (seen >= threshold)
+            return juce::jmin((i + 1) * binWidth, maxLoad);
+    }
+    return maxLoad;
+}
+
+int PerfSnapshot::getTotalUnderruns() const
+{
+    int total = 0;
+    for (const auto& deck : decks)
+        total += deck.underruns;
+    return total;
+}
+
+juce::String PerfSnapshot::toText() const
+{
+    auto percent = [](double load) { return juce::String(load * 100.0, 1) + "%"; };
+
+    juce::String text;
+    text << "Callbacks: " << callbacks << " (deadline " << juce::String(deadlineMs, 2) << " ms)\n"
+         << "Load avg " << percent(averageLoad) << ", p50 " << percent(getPercentileLoad(0.5))
+         << ", p99 " << percent(getPercentileLoad(0.99)) << ", max " << percent(maxLoad) << "\n"
+         << "Late callbacks: " << overruns << ", device xruns: " << (deviceXRuns >= 0 ? juce::String(deviceXRuns) : juce::String("n/a"))
+         << ", read-ahead underruns: " << getTotalUnderruns() << "\n";
+
+    for (const auto& deck : decks)
+    {
+        text << deck.name << ": ";
+        if (deck.file.isEmpty())
+            text << "empty\n";
+        else
+            text << deck.file << ", decode " << juce::String(deck.decodeSpeed, 0) << "x realtime ("
+                 << juce::String(deck.decodeSeconds * 1000.0, 0) << " ms), " << deck.underruns << " underruns\n";
+    }
+    return text;
+}
+
+juce::String PerfSnapshot::toJson() const
+{
+    auto* root = new juce::DynamicObject();
+    root->setProperty("time", juce::Time::getCurrentTime().toISO8601(true));
+    root->setProperty("callbacks", callbacks);
+    root->setProperty("lateCallbacks", overruns);
+    root->setProperty("deviceXRuns", deviceXRuns);
+    root->setProperty("deadlineMs", deadlineMs);
+    root->setProperty("averageLoad", averageLoad);
+    root->setProperty("p50Load", getPercentileLoad(0.5));
+    root->setProperty("p95Load", getPercentileLoad(0.95));
+    root->setProperty("p99Load", getPercentileLoad(0.99));
+    root->setProperty("maxLoad", maxLoad);
+
+    juce::Array<juce::var> bins;
+    for (auto count : histogram)
+        bins.add(count);
+    root->setProperty("histogram", bins);
+
+    juce::Array<juce::var> deckStats;
+    for (const auto& deck : decks)
+    {
+        auto* entry = new juce::DynamicObject();
+        entry->setProperty("name", deck.name);
+        entry->setProperty("file", deck.file);
+        entry->setProperty("underruns", deck.underruns);
+        entry->setProperty("decodeSeconds", deck.decodeSeconds);
+        entry->setProperty("decodeSpeed", deck.decodeSpeed);
+        deckStats.add(juce::var(entry));
+    }
+    root->setProperty("decks", deckStats);
+
+    return juce::JSON::toString(juce::var(root), true);
+}
+
+PerfLog::PerfLog(std::function<PerfSnapshot()> snapshotSource, juce::File logFile, int intervalSeconds)
+    : getSnapshot(std::move(snapshotSource)), file(std::move(logFile))
+{
+    startTimer(juce::jmax(1, intervalSeconds) * 1000);
+}
+
+PerfLog::~PerfLog()
+{
+    stopTimer();
+}
+
+void PerfLog::writeNow()
+{
+    if (file.getSize() > 1024 * 1024)
+        file.moveFileTo(file.withFileExtension("1.log"));
+
+    file.getParentDirectory().createDirectory();
+    file.appendText(getSnapshot().toJson() + "\n");
+}
+
+namespace
+{
+    struct StartupStages
+    {
+        double startMs = 0.0;
+        bool finished = false;
+        juce::StringArray names;
+        juce::Array<double> times;
+    };
+
+    StartupStages& getStartupStages()
+    {
+        static StartupStages stages;
+        return stages;
+    }
+}
+
+void StartupTrace::begin()
+{
+    auto& stages = getStartupStages();
+    stages = {};
+    stages.startMs = juce::Time::getMillisecondCounterHiRes();
+}
+
+void StartupTrace::mark(const juce::String& stage)
+{
+    auto& stages = getStartupStages();
+    if (stages.startMs == 0.0 || stages.finished)
+        return;
+
+    stages.names.add(stage);
+    stages.times.add(juce::Time::getMillisecondCounterHiRes() - stages.startMs);
+}
+
+void StartupTrace::finish(const juce::File& logFile)
+{
+    auto& stages = getStartupStages();
+    if (stages.startMs == 0.0 || stages.finished)
+        return;
+
+    mark("first frame");
+    stages.finished = true;
+
+    auto json = toJson();
+    logFile.getParentDirectory().createDirectory();
+    logFile.appendText(json + "\n");
+}
+
+juce::String StartupTrace::toJson()
+{
+    auto& stages = getStartupStages();
+    auto* stageTimes = new juce::DynamicObject();
+    for (int i = 0; i < stages.names.size(); ++i)
+        stageTimes->setProperty(stages.names[i], stages.times[i]);
+
+    auto* root = new juce::DynamicObject();
+    root->setProperty("time", juce::Time::getCurrentTime().toISO8601(true));
+    root->setProperty("startupMs", stages.times.isEmpty() ? 0.0 : stages.times.getLast());
+    root->setProperty("stages", juce::var(stageTimes));
+    return juce::JSON::toString(juce::var(root), true);
+}
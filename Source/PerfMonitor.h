@@ -0,0 +1,101 @@
+#pragma once
+#include <JuceHeader.h>
+
+struct DeckPerfStats
+{
+    juce::String name;
+    juce::String file;
+    int underruns = 0;
+    double decodeSeconds = 0.0;
+    double decodeSpeed = 0.0;
+};
+
+struct PerfSnapshot
+{
+    static constexpr int numBins = 40;
+    static constexpr double binWidth = 0.05;
+
+    juce::int64 callbacks = 0;
+    juce::int64 overruns = 0;
+    int deviceXRuns = -1;
+    double deadlineMs = 0.0;
+    double averageLoad = 0.0;
+    double maxLoad = 0.0;
+    std::array<juce::int64, numBins> histogram {};
+    juce::Array<DeckPerfStats> decks;
+
+    double getPercentileLoad(double percentile) const;
+    int getTotalUnderruns() const;
+    juce::String toText() const;
+    juce::String toJson() const;
+};
+
+// Collected from the audio callback with relaxed atomics only; any thread can
+// take a snapshot. Loads are callback time as a fraction of the block deadline.
+// reset() only raises a flag, and the next record() clears the counters on the
+// audio thread so they never have two writers.
+class PerfMonitor
+{
+public:
+    class CallbackTimer
+    {
+    public:
+        CallbackTimer(PerfMonitor& monitorToUse, int numSamples)
+            : monitor(monitorToUse), samples(numSamples), startTicks(juce::Time::getHighResolutionTicks()) {}
+        ~CallbackTimer() { monitor.record(juce::Time::getHighResolutionTicks() - startTicks, samples); }
+
+    private:
+        PerfMonitor& monitor;
+        int samples;
+        juce::int64 startTicks;
+
+        JUCE_DECLARE_NON_COPYABLE(CallbackTimer)
+    };
+
+    void prepare(double newSampleRate) { sampleRate = newSampleRate; }
+    void record(juce::int64 elapsedTicks, int numSamples);
+    void reset();
+    PerfSnapshot getSnapshot() const;
+
+private:
+    std::atomic<double> sampleRate { 0.0 };
+    std::atomic<juce::int64> callbacks { 0 };
+    std::atomic<juce::int64> overruns { 0 };
+    std::atomic<double> totalLoad { 0.0 };
+    std::atomic<double> maxLoad { 0.0 };
+    std::atomic<double> lastDeadlineMs { 0.0 };
+    std::array<std::atomic<juce::int64>, PerfSnapshot::numBins> histogram {};
+    std::atomic<bool> resetRequested { false };
+};
+
+// Milliseconds from JUCEApplication::initialise to each startup stage up to
+// the first painted frame. Message thread only.
+class StartupTrace
+{
+public:
+    static void begin();
+    static void mark(const juce::String& stage);
+    // Marks the first frame and appends the trace to the log once; later
+    // calls do nothing.
+    static void finish(const juce::File& logFile);
+    static juce::String toJson();
+};
+
+// Appends a JSON line with the current snapshot to a log file at a fixed
+// interval, rolling the file over once it gets large.
+class PerfLog : private juce::Timer
+{
+public:
+    PerfLog(std::function<PerfSnapshot()> snapshotSource, juce::File logFile, int intervalSeconds);
+    ~PerfLog() override;
+
+    void writeNow();
+
+private:
+    void timerCallback() override { writeNow(); }
+
+    std::function<PerfSnapshot()> getSnapshot;
+    juce::File file;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PerfLog)
+};
@@ -1,422 +1,524 @@
 #include "PlayerAudio.h"
 
-PlayerAudio::PlayerAudio() : resamplingSource(&transportSource, false), mixerResamplingSource(&mixerTransportSource, false)
+PlayerAudio::PlayerAudio()
+    : sampleCache(formatManager), trackLoader(formatManager, readAheadPool, sampleCache), loudnessScanner(formatManager)
 {
     formatManager.registerBasicFormats();
-    mixer.addInputSource(&resamplingSource, false);
-    mixer.addInputSource(&mixerResamplingSource, false);
+    loudnessScanner.onScanned = [this](const juce::File& file, const TrackLoudness&) { updateTrackGains(file); };
+    decks.add(new Deck(commands, nextDeckId++));
+    decks.add(new Deck(commands, nextDeckId++));
+    masterRamp.setCurrentAndTarget(1.0f);
 }
 
 PlayerAudio::~PlayerAudio()
 {
-    mixer.removeAllInputs();
-    transportSource.stop();
-    transportSource.setSource(nullptr);
-    mixerTransportSource.stop();
-    mixerTransportSource.setSource(nullptr);
+    const juce::ScopedLock sl(deckLock);
+    for (auto* deck : decks)
+        deck->clearTrack();
 }
 
 void PlayerAudio::prepareToPlay(int samplesPerBlockExpected, double sampleRate)
 {
-    transportSource.prepareToPlay(samplesPerBlockExpected, sampleRate);
-    mixerTransportSource.prepareToPlay(samplesPerBlockExpected, sampleRate);
-    resamplingSource.prepareToPlay(samplesPerBlockExpected, sampleRate);
-    mixerResamplingSource.prepareToPlay(samplesPerBlockExpected, sampleRate);
-    mixer.prepareToPlay(samplesPerBlockExpected, sampleRate);
+    preparedBlockSize = samplesPerBlockExpected;
+    preparedSampleRate = sampleRate;
+    perfMonitor.prepare(sampleRate);
+    masterRamp.prepare(sampleRate, 0.015);
+    masterMeter.prepare(sampleRate);
+    
+    // Does the one-time CPU detection here rather than on the first callback.
+    juce::ignoreUnused(MixKernels::getInstructionSet());
+    
+    const juce::ScopedLock sl(deckLock);
+    mixBuffer.setSize(maxOutputChannels, samplesPerBlockExpected);
+    for (auto* deck : decks)
+        deck->prepareToPlay(samplesPerBlockExpected, sampleRate);
 }
 
 void PlayerAudio::getNextAudioBlock(const juce::AudioSourceChannelInfo& bufferToFill)
 {
-    if (readerSource.get() == nullptr)
+    PerfMonitor::CallbackTimer timer(perfMonitor, bufferToFill.numSamples);
+    auto& output = *bufferToFill.buffer;
+    int start = bufferToFill.startSample;
+    int numSamples = bufferToFill.numSamples;
+    auto blockStart = sampleClock.load(std::memory_order_relaxed);
+    bool rendered = false;
+    
     {
-        bufferToFill.clearActiveBufferRegion();
-        return;
-    }
+        // The deck list only changes when a deck is added or removed; skip the
+        // block rather than wait on the message thread.
+        const juce::ScopedTryLock sl(deckLock);
+        if (!sl.isLocked() || mixBuffer.getNumSamples() == 0)
+        {
+            sampleClock.store(blockStart + numSamples, std::memory_order_relaxed);
+            bufferToFill.clearActiveBufferRegion();
+            return;
+        }
     
-    mixer.getNextAudioBlock(bufferToFill);
+        commands.drain([this, blockStart](const ControlCommand& command)
+        {
+            if (command.time > blockStart)
+                schedule(command);
+            else
+                handleCommand(command);
+        });
     
-    double currentPos = transportSource.getCurrentPosition();
-    double length = getLengthInSeconds();
+        // Scheduled commands split the block so each lands on its exact sample,
+        // as does a block longer than the one mixBuffer was prepared for.
+        for (int done = 0; done < numSamples;)
+        {
+            auto now = blockStart + done;
+            int length = juce::jmin(numSamples - done, mixBuffer.getNumSamples());
+            if (numScheduled > 0)
+                length = (int)juce::jmin((juce::int64)length, applyScheduled(now) - now);
+            
+            rendered = mixDecks(output, start + done, length) || rendered;
+            done += length;
+        }
     
-    if (abLoopEnabled && currentPos >= abLoopEnd)
-    {
-        transportSource.setPosition(abLoopStart);
-        if (mixerReaderSource.get() != nullptr)
-            mixerTransportSource.setPosition(abLoopStart);
+        for (auto* deck : decks)
+            deck->publishState();
     }
-    else if (looping && !abLoopEnabled && length > 0.0 && currentPos >= length - 0.05)
+    
+    sampleClock.store(blockStart + numSamples, std::memory_order_relaxed);
+    if (!rendered)
     {
-        transportSource.setPosition(0.0);
-        transportSource.start();
-        if (mixerReaderSource.get() != nullptr)
-        {
-            mixerTransportSource.setPosition(0.0);
-            mixerTransportSource.start();
-        }
+        masterMeter.processSilence(numSamples);
+        bufferToFill.clearActiveBufferRegion();
+        return;
     }
+    
+    masterRamp.setTarget(masterMuted ? 0.0f : 1.0f);
+    MixKernels::applyGain(output, start, numSamples, masterRamp);
+    masterMeter.process(output, start, numSamples);
+    
+    if (auto requested = firstSampleRequestTicks.exchange(0))
+        firstSampleMs = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - requested) * 1000.0;
 }
 
-void PlayerAudio::releaseResources()
+bool PlayerAudio::mixDecks(juce::AudioBuffer<float>& output, int start, int numSamples)
 {
-    mixer.releaseResources();
-    resamplingSource.releaseResources();
-    mixerResamplingSource.releaseResources();
-    transportSource.releaseResources();
-    mixerTransportSource.releaseResources();
+    int rendered = 0;
+    Deck* firstDeck = nullptr;
+    for (auto* deck : decks)
+    {
+        if (!deck->isAudible())
+        {
+            deck->getMeter().processSilence(numSamples);
+            continue;
+        }
+    
+        // Decks are metered before mixing, at the gain they are heading to.
+        if (rendered == 0)
+        {
+            deck->render(output, start, numSamples);
+            deck->getMeter().process(output, start, numSamples, deck->getGainRamp().getTarget());
+            firstDeck = deck;
+        }
+        else
+        {
+            juce::AudioBuffer<float> deckBuffer(mixBuffer.getArrayOfWritePointers(),
+                                                juce::jmin(output.getNumChannels(), mixBuffer.getNumChannels()), numSamples);
+            deck->render(deckBuffer, 0, numSamples);
+            deck->getMeter().process(deckBuffer, 0, numSamples, deck->getGainRamp().getTarget());
+            if (rendered == 1)
+                MixKernels::mixPair(output, start, firstDeck->getGainRamp(), deckBuffer, 0, deck->getGainRamp(), numSamples);
+            else
+                MixKernels::addWithGain(output, start, deckBuffer, 0, numSamples, deck->getGainRamp());
+        }
+        ++rendered;
+    }
+    
+    if (rendered == 1)
+        MixKernels::applyGain(output, start, numSamples, firstDeck->getGainRamp());
+    else if (rendered == 0)
+        for (int ch = 0; ch < output.getNumChannels(); ++ch)
+            output.clear(ch, start, numSamples);
+    return rendered > 0;
 }
 
-void PlayerAudio::loadFile(const juce::File& file)
+void PlayerAudio::schedule(const ControlCommand& command)
 {
-    auto* reader = formatManager.createReaderFor(file);
-    if (reader == nullptr)
+    // Nothing should schedule this far ahead; apply now rather than drop it.
+    if (numScheduled == (int)scheduled.size())
+    {
+        handleCommand(command);
         return;
+    }
     
-    currentFile = file;
-    currentReader = reader;
-    title = reader->metadataValues.getValue("title", file.getFileNameWithoutExtension());
-    artist = reader->metadataValues.getValue("artist", "Unknown Artist");
-    duration = reader->lengthInSamples / reader->sampleRate;
-    
-    transportSource.stop();
-    transportSource.setSource(nullptr);
-    readerSource.reset(new juce::AudioFormatReaderSource(reader, true));
-    readerSource->setLooping(looping);
-    transportSource.setSource(readerSource.get(), 0, nullptr, reader->sampleRate);
-    transportSource.setGain(gain);
-    transportSource.setPosition(0.0);
-    duration = transportSource.getLengthInSeconds();
-    
-    resamplingSource.setResamplingRatio(playbackSpeed);
-    
-    if (artist == "Unknown Artist")
+    // Kept in time order, and in push order for equal times.
+    int index = numScheduled;
+    while (index > 0 && scheduled[(size_t)index - 1].time > command.time)
     {
-        juce::ChildProcess ffprobe;
-        juce::StringArray args;
-        args.add("ffprobe");
-        args.add("-v");
-        args.add("error");
-        args.add("-show_entries");
-        args.add("format_tags=artist,title");
-        args.add("-of");
-        args.add("default=nw=1:nk=1");
-        args.add(file.getFullPathName());
-        
-        if (ffprobe.start(args))
-        {
-            juce::String out = ffprobe.readAllProcessOutput().trim();
-            juce::StringArray lines;
-            lines.addLines(out);
-            if (lines.size() >= 2)
-            {
-                artist = lines[0];
-                title = lines[1];
-            }
-        }
+        scheduled[(size_t)index] = scheduled[(size_t)index - 1];
+        --index;
     }
+    scheduled[(size_t)index] = command;
+    ++numScheduled;
 }
 
-void PlayerAudio::loadMixerFile(const juce::File& file)
+juce::int64 PlayerAudio::applyScheduled(juce::int64 now)
 {
-    auto* reader = formatManager.createReaderFor(file);
-    if (reader == nullptr)
-        return;
-    
-    mixerReader = reader;
-    mixerTitle = reader->metadataValues.getValue("title", file.getFileNameWithoutExtension());
-    mixerArtist = reader->metadataValues.getValue("artist", "Unknown Artist");
-    mixerDuration = reader->lengthInSamples / reader->sampleRate;
+    int due = 0;
+    while (due < numScheduled && scheduled[(size_t)due].time <= now)
+        handleCommand(scheduled[(size_t)due++]);
     
-    mixerTransportSource.stop();
-    mixerTransportSource.setSource(nullptr);
-    mixerReaderSource.reset(new juce::AudioFormatReaderSource(reader, true));
-    mixerReaderSource->setLooping(looping);
-    mixerTransportSource.setSource(mixerReaderSource.get(), 0, nullptr, reader->sampleRate);
-    mixerTransportSource.setGain(mixerGain);
-    mixerTransportSource.setPosition(0.0);
-    mixerDuration = mixerTransportSource.getLengthInSeconds();
-    
-    mixerResamplingSource.setResamplingRatio(mixerPlaybackSpeed);
+    std::copy(scheduled.begin() + due, scheduled.begin() + numScheduled, scheduled.begin());
+    numScheduled -= due;
+    return numScheduled > 0 ? scheduled[0].time : std::numeric_limits<juce::int64>::max();
+}
+
+void PlayerAudio::handleCommand(const ControlCommand& command)
+{
+    if (command.type == ControlCommand::Type::setMasterMuted)
+    {
+        masterMuted = command.value != 0.0;
+        return;
+    }
     
-    if (mixerArtist == "Unknown Artist")
+    for (auto* deck : decks)
     {
-        juce::ChildProcess ffprobe;
-        juce::StringArray args;
-        args.add("ffprobe");
-        args.add("-v");
-        args.add("error");
-        args.add("-show_entries");
-        args.add("format_tags=artist,title");
-        args.add("-of");
-        args.add("default=nw=1:nk=1");
-        args.add(file.getFullPathName());
-        
-        if (ffprobe.start(args))
+        if (command.target == ControlCommand::allDecks)
+        {
+            deck->handleCommand(command);
+        }
+        else if (deck->getId() == command.target)
         {
-            juce::String out = ffprobe.readAllProcessOutput().trim();
-            juce::StringArray lines;
-            lines.addLines(out);
-            if (lines.size() >= 2)
-            {
-                mixerArtist = lines[0];
-                mixerTitle = lines[1];
-            }
+            deck->handleCommand(command);
+            return;
         }
     }
 }
 
-void PlayerAudio::play()
+void PlayerAudio::releaseResources()
 {
-    if (!transportSource.isPlaying())
-        transportSource.start();
-    if (mixerReaderSource.get() != nullptr && !mixerTransportSource.isPlaying())
-        mixerTransportSource.start();
+    const juce::ScopedLock sl(deckLock);
+    for (auto* deck : decks)
+        deck->releaseResources();
 }
 
-void PlayerAudio::pause()
+void PlayerAudio::configureDeck(Deck& deck)
 {
-    transportSource.stop();
-    if (mixerReaderSource.get() != nullptr)
-        mixerTransportSource.stop();
+    deck.setLooping(looping);
+    deck.setLoopRegion(abLoopEnabled, abLoopStart, abLoopEnd);
+    deck.setCrossfadeSeconds(crossfadeSeconds);
 }
 
-void PlayerAudio::stop()
+int PlayerAudio::addDeck()
 {
-    transportSource.stop();
-    transportSource.setPosition(0.0);
-    if (mixerReaderSource.get() != nullptr)
+    auto deck = std::make_unique<Deck>(commands, nextDeckId++);
+    configureDeck(*deck);
+    if (preparedBlockSize.load() > 0)
+        deck->prepareToPlay(preparedBlockSize.load(), preparedSampleRate.load());
+    
+    const juce::ScopedLock sl(deckLock);
+    decks.add(deck.release());
+    return decks.size() - 1;
+}
+
+void PlayerAudio::removeDeck(int index)
+{
+    jassert(index > mixerDeckIndex && index < decks.size());
+    if (index <= mixerDeckIndex || index >= decks.size())
+        return;
+    
+    std::unique_ptr<Deck> removed;
     {
-        mixerTransportSource.stop();
-        mixerTransportSource.setPosition(0.0);
+        const juce::ScopedLock sl(deckLock);
+        removed.reset(decks.removeAndReturn(index));
     }
 }
 
-void PlayerAudio::setPosition(double pos)
+LoadRequest PlayerAudio::makeLoadRequest(const juce::File& file) const
 {
-    transportSource.setPosition(pos);
+    LoadRequest request;
+    request.file = file;
+    request.readAheadSeconds = readAheadSeconds;
+    request.looping = looping;
+    request.useFfprobeFallback = useFfprobeFallback;
+    request.blockingReads = offlineRendering;
+    request.decodeToMemory = inMemoryMode;
+    request.maxMemorySeconds = maxMemorySeconds;
+    request.blockSize = preparedBlockSize.load();
+    request.outputSampleRate = preparedSampleRate.load();
+    return request;
 }
 
-void PlayerAudio::setMixerPosition(double pos)
+void PlayerAudio::loadFile(int deckIndex, const juce::File& file)
 {
-    if (mixerReaderSource.get() != nullptr)
-        mixerTransportSource.setPosition(pos);
+    auto& deck = getDeck(deckIndex);
+    int generation = deck.beginLoad();
+    auto track = trackLoader.prepare(makeLoadRequest(file), juce::Time::getHighResolutionTicks());
+    deck.endLoad(generation);
+    if (track != nullptr)
+    {
+        recordLoadTiming(*track);
+        track->trackGain = getNormalisationGain(file);
+        deck.setTrack(std::move(track));
+        cacheLoopRegion(deck);
+    }
 }
 
-double PlayerAudio::getLengthInSeconds() const
+void PlayerAudio::loadFileAsync(int deckIndex, const juce::File& file, std::function<void(bool)> onLoaded)
 {
-    return transportSource.getLengthInSeconds();
+    // The callback finds the deck by id, since removing a deck shifts the
+    // indices of the ones after it.
+    auto& deck = getDeck(deckIndex);
+    int deckId = deck.getId();
+    int generation = deck.beginLoad();
+    if (normalising)
+        loudnessScanner.scan(file);
+    trackLoader.prepareAsync(makeLoadRequest(file), [this, deckId, generation, onLoaded](std::unique_ptr<PreparedTrack> track)
+    {
+        auto* target = findDeck(deckId);
+        if (target == nullptr || !target->isLoadCurrent(generation))
+            return;
+        target->endLoad(generation);
+        bool ok = track != nullptr;
+        if (ok)
+        {
+            recordLoadTiming(*track);
+            track->trackGain = getNormalisationGain(track->file);
+            target->setTrack(std::move(track));
+            cacheLoopRegion(*target);
+        }
+        if (onLoaded)
+            onLoaded(ok);
+    });
 }
 
-double PlayerAudio::getMixerLengthInSeconds() const
+void PlayerAudio::queueNextFile(int deckIndex, const juce::File& file)
 {
-    return mixerTransportSource.getLengthInSeconds();
+    auto& deck = getDeck(deckIndex);
+    int generation = deck.beginQueue(file);
+    if (!deck.hasTrack() || abLoopEnabled)
+        return;
+    
+    if (normalising)
+        loudnessScanner.scan(file);
+    trackLoader.prepareAsync(makeLoadRequest(file), [this, deckId = deck.getId(), generation](std::unique_ptr<PreparedTrack> track)
+    {
+        auto* target = findDeck(deckId);
+        if (target == nullptr || !target->isQueueCurrent(generation))
+            return;
+        if (track != nullptr)
+            track->trackGain = getNormalisationGain(track->file);
+        target->queueNext(std::move(track));
+    });
 }
 
-void PlayerAudio::setGain(float g)
+Deck* PlayerAudio::findDeck(int deckId)
 {
-    gain = g;
-    transportSource.setGain(gain);
+    for (auto* deck : decks)
+        if (deck->getId() == deckId)
+            return deck;
+    return nullptr;
 }
 
-void PlayerAudio::setMixerGain(float g)
+void PlayerAudio::setNormalisation(bool enabled, float targetLufs)
 {
-    mixerGain = g;
-    if (mixerReaderSource.get() != nullptr)
-        mixerTransportSource.setGain(mixerGain);
+    normalising = enabled;
+    normalisationTarget = targetLufs;
+    for (auto* deck : decks)
+    {
+        if (deck->hasTrack())
+            deck->setTrackGain(deck->getFile(), getNormalisationGain(deck->getFile()));
+        if (deck->getQueuedFile() != juce::File())
+            deck->setTrackGain(deck->getQueuedFile(), getNormalisationGain(deck->getQueuedFile()));
+    }
 }
 
-void PlayerAudio::setSpeed(double speed)
+float PlayerAudio::getNormalisationGain(const juce::File& file)
 {
-    playbackSpeed = juce::jlimit(0.5, 2.0, speed);
-    resamplingSource.setResamplingRatio(playbackSpeed);
+    TrackLoudness loudness;
+    if (!normalising || !loudnessScanner.getLoudness(file, loudness))
+        return 1.0f;
+    return loudness.getNormalisationGain(normalisationTarget);
 }
 
-void PlayerAudio::setMixerSpeed(double speed)
+void PlayerAudio::updateTrackGains(const juce::File& file)
 {
-    mixerPlaybackSpeed = juce::jlimit(0.5, 2.0, speed);
-    if (mixerReaderSource.get() != nullptr)
-        mixerResamplingSource.setResamplingRatio(mixerPlaybackSpeed);
+    if (!normalising)
+        return;
+    
+    float trackGain = getNormalisationGain(file);
+    for (auto* deck : decks)
+        deck->setTrackGain(file, trackGain);
 }
 
-bool PlayerAudio::isPlaying() const
+void PlayerAudio::setCrossfadeSeconds(double seconds)
 {
-    return transportSource.isPlaying();
+    crossfadeSeconds = juce::jlimit(0.0, 10.0, seconds);
+    for (auto* deck : decks)
+        deck->setCrossfadeSeconds(crossfadeSeconds);
 }
 
-void PlayerAudio::setLooping(bool shouldLoop)
+void PlayerAudio::recordLoadTiming(const PreparedTrack& track)
 {
-    looping = shouldLoop;
-    if (readerSource)
-        readerSource->setLooping(looping);
-    if (mixerReaderSource)
-        mixerReaderSource->setLooping(looping);
+    collectLoadTimings();
+    
+    auto format = track.formatName;
+    if (track.decodedInMemory)
+        format << " (in memory)";
+    else if (track.memoryMapped)
+        format << " (mapped)";
+    auto& stats = loadStats[format];
+    stats.loads++;
+    stats.totalOpenMs += track.openMs;
+    
+    pendingTimingFormat = format;
+    firstSampleMs = -1.0;
+    firstSampleRequestTicks = track.requestTicks;
 }
 
-bool PlayerAudio::isLooping() const
+void PlayerAudio::collectLoadTimings()
 {
-    return looping;
+    double ms = firstSampleMs.exchange(-1.0);
+    if (ms < 0.0 || pendingTimingFormat.isEmpty())
+        return;
+    
+    auto& stats = loadStats[pendingTimingFormat];
+    stats.firstSamples++;
+    stats.totalFirstSampleMs += ms;
+    stats.maxFirstSampleMs = juce::jmax(stats.maxFirstSampleMs, ms);
+    pendingTimingFormat.clear();
 }
 
-void PlayerAudio::toggleMute()
+PerfSnapshot PlayerAudio::getPerfSnapshot() const
 {
-    if (isMuted)
-    {
-        transportSource.setGain(gain);
-        if (mixerReaderSource.get() != nullptr)
-            mixerTransportSource.setGain(mixerGain);
-        isMuted = false;
-    }
-    else
+    auto snapshot = perfMonitor.getSnapshot();
+    snapshot.deviceXRuns = xrunCounter != nullptr ? xrunCounter() : -1;
+    for (int i = 0; i < decks.size(); ++i)
     {
-        transportSource.setGain(0.0f);
-        if (mixerReaderSource.get() != nullptr)
-            mixerTransportSource.setGain(0.0f);
-        isMuted = true;
+        const auto& deck = *decks[i];
+        DeckPerfStats stats;
+        stats.name = "Deck " + juce::String(i + 1);
+        stats.file = deck.getFile().getFileName();
+        stats.underruns = deck.getUnderrunCount();
+        stats.decodeSeconds = deck.getDecodeSeconds();
+        stats.decodeSpeed = deck.getDecodeSpeed();
+        snapshot.decks.add(stats);
     }
+    return snapshot;
 }
 
-void PlayerAudio::jumpForward(double seconds)
+juce::String PlayerAudio::getLoadTimingReport()
 {
-    double newPosition = transportSource.getCurrentPosition() + seconds;
-    if (newPosition < transportSource.getLengthInSeconds())
-    {
-        transportSource.setPosition(newPosition);
-        if (mixerReaderSource.get() != nullptr)
-            mixerTransportSource.setPosition(newPosition);
-    }
-    else
+    collectLoadTimings();
+    
+    juce::String report;
+    for (const auto& [format, stats] : loadStats)
     {
-        transportSource.stop();
-        if (mixerReaderSource.get() != nullptr)
-            mixerTransportSource.stop();
+        report << format << ": " << stats.loads << " loads, open "
+               << juce::String(stats.loads > 0 ? stats.totalOpenMs / stats.loads : 0.0, 1) << " ms avg, first sample "
+               << juce::String(stats.firstSamples > 0 ? stats.totalFirstSampleMs / stats.firstSamples : 0.0, 1) << " ms avg / "
+               << juce::String(stats.maxFirstSampleMs, 1) << " ms max\n";
     }
+    return report;
 }
 
-void PlayerAudio::jumpBackward(double seconds)
+void PlayerAudio::play()
 {
-    double newPosition = transportSource.getCurrentPosition() - seconds;
-    if (newPosition > 0.0)
-    {
-        transportSource.setPosition(newPosition);
-        if (mixerReaderSource.get() != nullptr)
-            mixerTransportSource.setPosition(newPosition);
-    }
-    else
-    {
-        transportSource.setPosition(0.0);
-        if (mixerReaderSource.get() != nullptr)
-            mixerTransportSource.setPosition(0.0);
-    }
+    playAt(-1);
 }
 
-void PlayerAudio::setABLooping(bool enabled, double startTime, double endTime)
+void PlayerAudio::playAt(juce::int64 sampleTime)
 {
-    abLoopEnabled = enabled;
-    abLoopStart = startTime;
-    abLoopEnd = endTime;
+    commands.beginBatch();
+    postToAllDecks(ControlCommand::Type::start);
+    bool queued = commands.endBatch(sampleTime);
+    jassertquiet(queued);
 }
 
-void PlayerAudio::clearMixerTrack()
+void PlayerAudio::pause()
 {
-    mixerTransportSource.stop();
-    mixerTransportSource.setSource(nullptr);
-    mixerReaderSource.reset();
-    mixerReader = nullptr;
-    mixerTitle = "";
-    mixerArtist = "";
-    mixerAlbum = "";
-    mixerDuration = 0.0;
+    postToAllDecks(ControlCommand::Type::stop);
 }
 
-void PlayerAudio::toggleTrack1Mute()
+void PlayerAudio::stop()
 {
-    if (isTrack1Muted)
-    {
-        transportSource.setGain(savedTrack1Gain);
-        isTrack1Muted = false;
-    }
-    else
-    {
-        savedTrack1Gain = gain;
-        transportSource.setGain(0.0f);
-        isTrack1Muted = true;
-    }
+    commands.beginBatch();
+    postToAllDecks(ControlCommand::Type::stop);
+    postToAllDecks(ControlCommand::Type::setPosition, 0.0);
+    bool queued = commands.endBatch();
+    jassertquiet(queued);
 }
 
-void PlayerAudio::toggleTrack2Mute()
+bool PlayerAudio::isPlaying() const
 {
-    if (mixerReaderSource.get() != nullptr)
-    {
-        if (isTrack2Muted)
-        {
-            mixerTransportSource.setGain(savedTrack2Gain);
-            isTrack2Muted = false;
-        }
-        else
-        {
-            savedTrack2Gain = mixerGain;
-            mixerTransportSource.setGain(0.0f);
-            isTrack2Muted = true;
-        }
-    }
+    return getDeck(mainDeckIndex).isPlaying();
 }
 
-void PlayerAudio::track1JumpForward(double seconds)
+void PlayerAudio::jumpForward(double seconds)
 {
-    double newPosition = transportSource.getCurrentPosition() + seconds;
-    if (newPosition < transportSource.getLengthInSeconds())
-        transportSource.setPosition(newPosition);
+    auto& main = getDeck(mainDeckIndex);
+    double newPosition = main.getPosition() + seconds;
+    if (newPosition < main.getLengthInSeconds())
+        postToAllDecks(ControlCommand::Type::setPosition, newPosition);
+    else
+        pause();
 }
 
-void PlayerAudio::track1JumpBackward(double seconds)
+void PlayerAudio::jumpBackward(double seconds)
 {
-    double newPosition = transportSource.getCurrentPosition() - seconds;
-    if (newPosition > 0.0)
-        transportSource.setPosition(newPosition);
-    else
-        transportSource.setPosition(0.0);
+    double newPosition = juce::jmax(0.0, getDeck(mainDeckIndex).getPosition() - seconds);
+    postToAllDecks(ControlCommand::Type::setPosition, newPosition);
 }
 
-void PlayerAudio::track2JumpForward(double seconds)
+// One command for every deck, however many there are, so a transport change
+// fits in a batch and takes a single slot in the scheduled list.
+void PlayerAudio::postToAllDecks(ControlCommand::Type type, double value)
 {
-    if (mixerReaderSource.get() != nullptr)
-    {
-        double newPosition = mixerTransportSource.getCurrentPosition() + seconds;
-        if (newPosition < mixerTransportSource.getLengthInSeconds())
-            mixerTransportSource.setPosition(newPosition);
-    }
+    if (type == ControlCommand::Type::setPosition)
+        for (auto* deck : decks)
+            deck->expectPosition(value);
+    
+    bool queued = commands.push({ type, ControlCommand::allDecks, value });
+    jassertquiet(queued);
 }
 
-void PlayerAudio::track2JumpBackward(double seconds)
+void PlayerAudio::setLooping(bool shouldLoop)
 {
-    if (mixerReaderSource.get() != nullptr)
-    {
-        double newPosition = mixerTransportSource.getCurrentPosition() - seconds;
-        if (newPosition > 0.0)
-            mixerTransportSource.setPosition(newPosition);
-        else
-            mixerTransportSource.setPosition(0.0);
-    }
+    looping = shouldLoop;
+    for (auto* deck : decks)
+        deck->setLooping(looping);
 }
 
-void PlayerAudio::pauseTrack1()
+bool PlayerAudio::isLooping() const
 {
-    transportSource.stop();
+    return looping;
 }
 
-void PlayerAudio::pauseTrack2()
+void PlayerAudio::toggleMute()
 {
-    if (mixerReaderSource.get() != nullptr)
-        mixerTransportSource.stop();
+    muteRequested = !muteRequested;
+    bool queued = commands.push({ ControlCommand::Type::setMasterMuted, -1, muteRequested ? 1.0 : 0.0 });
+    jassertquiet(queued);
 }
 
-void PlayerAudio::playTrack1()
+void PlayerAudio::setABLooping(bool enabled, double startTime, double endTime)
 {
-    if (!transportSource.isPlaying())
-        transportSource.start();
+    abLoopEnabled = enabled;
+    abLoopStart = startTime;
+    abLoopEnd = endTime;
+    for (auto* deck : decks)
+    {
+        deck->setLoopRegion(abLoopEnabled, abLoopStart, abLoopEnd);
+        cacheLoopRegion(*deck);
+    }
 }
 
-void PlayerAudio::playTrack2()
+void PlayerAudio::cacheLoopRegion(Deck& deck)
 {
-    if (mixerReaderSource.get() != nullptr && !mixerTransportSource.isPlaying())
-        mixerTransportSource.start();
+    // Only decks loaded in memory mode have a CachedReader to hand the clip to.
+    auto* cached = dynamic_cast<CachedReader*>(deck.getReader());
+    if (cached == nullptr || !abLoopEnabled || abLoopEnd <= abLoopStart)
+        return;
+    
+    auto start = (juce::int64)(abLoopStart * cached->sampleRate);
+    // The loop crossfade reads a few ms past the end point, so keep that in RAM too.
+    auto end = juce::jmin(cached->lengthInSamples, (juce::int64)((abLoopEnd + 0.05) * cached->sampleRate));
+    if (end - start > (juce::int64)(maxMemorySeconds * cached->sampleRate) || cached->covers(start, end))
+        return;
+    
+    sampleCache.decodeAsync(*cached, deck.getFile(), start, end);
 }
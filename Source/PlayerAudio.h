@@ -1,9 +1,19 @@
 #pragma once
 #include <JuceHeader.h>
+#include "ReadAhead.h"
+#include "TrackLoader.h"
+#include "Deck.h"
+#include "CommandQueue.h"
+#include "PerfMonitor.h"
+#include "MixKernels.h"
+#include "LoudnessScanner.h"
 
 class PlayerAudio : public juce::AudioSource
 {
 public:
+    static constexpr int mainDeckIndex = 0;
+    static constexpr int mixerDeckIndex = 1;
+    
     PlayerAudio();
     ~PlayerAudio() override;
     
@@ -11,101 +21,130 @@ public:
     void getNextAudioBlock(const juce::AudioSourceChannelInfo& bufferToFill) override;
     void releaseResources() override;
     
-    void loadFile(const juce::File& file);
-    void loadMixerFile(const juce::File& file);
+    int getNumDecks() const { return decks.size(); }
+    Deck& getDeck(int index) { return *decks[index]; }
+    const Deck& getDeck(int index) const { return *decks[index]; }
+    int addDeck();
+    void removeDeck(int index);
+    
+    void loadFile(int deckIndex, const juce::File& file);
+    void loadFileAsync(int deckIndex, const juce::File& file, std::function<void(bool)> onLoaded);
+    void queueNextFile(int deckIndex, const juce::File& file);
+    juce::String getLoadTimingReport();
+    void setUseFfprobeFallback(bool shouldUse) { useFfprobeFallback = shouldUse; }
+    void setReadAheadSeconds(double seconds) { readAheadSeconds = juce::jmax(0.1, seconds); }
+    void setCrossfadeSeconds(double seconds);
+    void setOfflineRendering(bool isOffline) { offlineRendering = isOffline; }
+    double getCrossfadeSeconds() const { return crossfadeSeconds; }
+    
+    // Memory mode decodes short files, and A-B regions of longer ones, once into
+    // RAM so loops replay without decoding again. Takes effect on the next load.
+    void setInMemoryMode(bool enabled) { inMemoryMode = enabled; }
+    bool isInMemoryMode() const { return inMemoryMode; }
+    void setMaxMemorySeconds(double seconds) { maxMemorySeconds = juce::jmax(1.0, seconds); }
+    SampleCache& getSampleCache() { return sampleCache; }
+    
+    // Loudness normalisation gives each track a gain offset that brings it to
+    // targetLufs. Loads never wait for a scan: a track that has not been
+    // measured yet plays at unity and picks its gain up when the scan ends.
+    void setNormalisation(bool enabled, float targetLufs = -18.0f);
+    bool isNormalising() const { return normalising; }
+    float getNormalisationTarget() const { return normalisationTarget; }
+    LoudnessScanner& getLoudnessScanner() { return loudnessScanner; }
+    
+    // Transport changes reach every deck in the same block. playAt() starts
+    // them all on one output sample, as counted by getSampleClock().
     void play();
+    void playAt(juce::int64 sampleTime);
+    juce::int64 getSampleClock() const { return sampleClock.load(std::memory_order_relaxed); }
     void pause();
     void stop();
-    void setPosition(double pos);
-    void setMixerPosition(double pos);
-    double getLengthInSeconds() const;
-    double getMixerLengthInSeconds() const;
-    void setGain(float g);
-    void setMixerGain(float g);
-    void setSpeed(double speed);
-    void setMixerSpeed(double speed);
     bool isPlaying() const;
+    void jumpForward(double seconds);
+    void jumpBackward(double seconds);
     void setLooping(bool shouldLoop);
     bool isLooping() const;
     void toggleMute();
-    void toggleTrack1Mute();
-    void toggleTrack2Mute();
-    void track1JumpForward(double seconds);
-    void track1JumpBackward(double seconds);
-    void track2JumpForward(double seconds);
-    void track2JumpBackward(double seconds);
-    void pauseTrack1();
-    void pauseTrack2();
-    void playTrack1();
-    void playTrack2();
-    bool isMuted = false;
-    bool isTrack1Muted = false;
-    bool isTrack2Muted = false;
-    float savedTrack1Gain = 1.0f;
-    float savedTrack2Gain = 1.0f;
-    void jumpForward(double seconds);
-    void jumpBackward(double seconds);
+    bool isMuted() const { return muteRequested; }
     
     void setABLooping(bool enabled, double startTime, double endTime);
     bool isABLooping() const { return abLoopEnabled; }
     double getABLoopStart() const { return abLoopStart; }
     double getABLoopEnd() const { return abLoopEnd; }
     
-    juce::String getTitle() const { return title; }
-    juce::String getArtist() const { return artist; }
-    juce::String getAlbum() const { return album; }
-    double getDuration() const { return duration; }
-    
-    juce::String getMixerTitle() const { return mixerTitle; }
-    juce::String getMixerArtist() const { return mixerArtist; }
-    juce::String getMixerAlbum() const { return mixerAlbum; }
-    double getMixerDuration() const { return mixerDuration; }
-    
-    bool hasMixerTrack() const { return mixerReaderSource.get() != nullptr; }
-    
-    juce::AudioFormatReader* getCurrentReader() const { return currentReader; }
-    juce::AudioFormatReader* getMixerReader() const { return mixerReader; }
-    
-    juce::AudioTransportSource transportSource;
-    juce::AudioTransportSource mixerTransportSource;
-    
-    juce::File getCurrentFile() const { return currentFile; }
-    double getCurrentPosition() const { return transportSource.getCurrentPosition(); }
+    juce::AudioFormatManager& getFormatManager() { return formatManager; }
     
-    void clearMixerTrack();
+    // Levels of the summed output after the master mute, for the GUI meters.
+    const LevelMeter& getMasterMeter() const { return masterMeter; }
     
-    juce::AudioFormatManager& getFormatManager() { return formatManager; }
+    PerfSnapshot getPerfSnapshot() const;
+    void resetPerfStats() { perfMonitor.reset(); }
+    void setXRunCounter(std::function<int()> counter) { xrunCounter = std::move(counter); }
 
 private:
-    juce::AudioFormatManager formatManager;
-    std::unique_ptr<juce::AudioFormatReaderSource> readerSource;
-    std::unique_ptr<juce::AudioFormatReaderSource> mixerReaderSource;
+    struct LoadStats
+    {
+        int loads = 0;
+        int firstSamples = 0;
+        double totalOpenMs = 0.0;
+        double totalFirstSampleMs = 0.0;
+        double maxFirstSampleMs = 0.0;
+    };
+    
+    void postToAllDecks(ControlCommand::Type type, double value = 0.0);
+    Deck* findDeck(int deckId);
+    LoadRequest makeLoadRequest(const juce::File& file) const;
+    float getNormalisationGain(const juce::File& file);
+    void updateTrackGains(const juce::File& file);
+    void configureDeck(Deck& deck);
+    void handleCommand(const ControlCommand& command);
+    bool mixDecks(juce::AudioBuffer<float>& output, int start, int numSamples);
+    void schedule(const ControlCommand& command);
+    juce::int64 applyScheduled(juce::int64 now);
+    void recordLoadTiming(const PreparedTrack& track);
+    void collectLoadTimings();
+    void cacheLoopRegion(Deck& deck);
     
-    juce::MixerAudioSource mixer;
-    juce::ResamplingAudioSource resamplingSource;
-    juce::ResamplingAudioSource mixerResamplingSource;
+    juce::AudioFormatManager formatManager;
+    ReadAheadPool readAheadPool{2};
+    SampleCache sampleCache;
+    TrackLoader trackLoader;
+    LoudnessScanner loudnessScanner;
+    bool normalising = true;
+    float normalisationTarget = -18.0f;
+    std::atomic<int> preparedBlockSize { 0 };
+    std::atomic<double> preparedSampleRate { 0.0 };
+    std::atomic<juce::int64> firstSampleRequestTicks { 0 };
+    std::atomic<double> firstSampleMs { -1.0 };
+    juce::String pendingTimingFormat;
+    std::map<juce::String, LoadStats> loadStats;
+    double readAheadSeconds = 2.0;
+    bool useFfprobeFallback = false;
+    bool offlineRendering = false;
+    bool inMemoryMode = false;
+    double maxMemorySeconds = 120.0;
+    double crossfadeSeconds = 0.0;
+    
+    ControlQueue commands;
+    juce::CriticalSection deckLock;
+    juce::OwnedArray<Deck> decks;
+    int nextDeckId = 0;
+    // Sized once in prepareToPlay; longer blocks are mixed in pieces and
+    // channels past the first eight only carry the first deck.
+    static constexpr int maxOutputChannels = 8;
+    juce::AudioBuffer<float> mixBuffer;
+    bool masterMuted = false;
+    bool muteRequested = false;
+    MixKernels::GainRamp masterRamp;
+    std::atomic<juce::int64> sampleClock { 0 };
+    std::array<ControlCommand, 64> scheduled {};
+    int numScheduled = 0;
+    LevelMeter masterMeter;
+    PerfMonitor perfMonitor;
+    std::function<int()> xrunCounter;
     
-    float gain = 1.0f;
-    float mixerGain = 1.0f;
     bool looping = false;
-    double playbackSpeed = 1.0;
-    double mixerPlaybackSpeed = 1.0;
-    
     bool abLoopEnabled = false;
     double abLoopStart = 0.0;
     double abLoopEnd = 0.0;
-    
-    juce::String title;
-    juce::String artist;
-    juce::String album;
-    double duration = 0.0;
-    
-    juce::String mixerTitle;
-    juce::String mixerArtist;
-    juce::String mixerAlbum;
-    double mixerDuration = 0.0;
-    
-    juce::AudioFormatReader* currentReader = nullptr;
-    juce::AudioFormatReader* mixerReader = nullptr;
-    juce::File currentFile;
 };
@@ -1,4 +1,5 @@
 #include "PlayerGUI.h"
+#include "TrackCache.h"
 
 static juce::String formatDuration(double seconds)
 {
@@ -8,104 +9,342 @@ static juce::String formatDuration(double seconds)
     return juce::String(mins) + ":" + juce::String(secs).paddedLeft('0', 2);
 }
 
-static std::unique_ptr<juce::Drawable> createDrawableFromSVGFile(const juce::File& svgFile)
+WaveformDisplay::WaveformDisplay(PlayerAudio& audioRef)
+    : audio(audioRef)
 {
-    if (!svgFile.existsAsFile())
-        return nullptr;
-    juce::String contents = svgFile.loadFileAsString();
-    if (contents.isEmpty())
-        return nullptr;
-    std::unique_ptr<juce::XmlElement> xml = juce::parseXML(contents);
-    if (!xml)
-        return nullptr;
-    return juce::Drawable::createFromSVG(*xml);
+    setOpaque(true);
 }
 
-WaveformDisplay::WaveformDisplay(PlayerAudio& audioRef)
-    : audio(audioRef), thumbnailCache(5), thumbnail(512, audio.getFormatManager(), thumbnailCache)
+juce::int64 WaveformDisplay::getTotalSamples() const
 {
-    thumbnail.addChangeListener(this);
-    startTimer(40);
+    return peaks != nullptr && peaks->isReady() ? peaks->getLengthInSamples() : 0;
 }
 
-WaveformDisplay::~WaveformDisplay()
+juce::Range<juce::int64> WaveformDisplay::getVisibleRange() const
 {
-    stopTimer();
+    auto total = getTotalSamples();
+    if (viewLength <= 0 || viewLength >= total)
+        return { 0, total };
+    return { viewStart, viewStart + viewLength };
 }
 
-void WaveformDisplay::changeListenerCallback(juce::ChangeBroadcaster* source)
+void WaveformDisplay::setVisibleRange(juce::int64 start, juce::int64 length)
 {
-    if (source == &thumbnail)
-        repaint();
+    auto total = getTotalSamples();
+    if (total <= 0)
+        return;
+    
+    // Zooming stops at a few pixels per sample.
+    auto minLength = juce::jmin(total, juce::jmax((juce::int64)16, (juce::int64)getWidth() / 8));
+    length = juce::jlimit(minLength, total, length);
+    start = juce::jlimit((juce::int64)0, total - length, start);
+    if (start == viewStart && length == viewLength)
+        return;
+    
+    viewStart = start;
+    viewLength = length;
+    imageNeedsRender = true;
+    playheadX = -1.0f;
+    repaint();
 }
 
-void WaveformDisplay::paint(juce::Graphics& g)
+void WaveformDisplay::zoomAround(float x, double factor)
 {
-    g.fillAll(juce::Colour::fromString("#FF1A1F2B"));
-    g.setColour(juce::Colour::fromString("#FFFEE715"));
+    auto visible = getVisibleRange();
+    if (visible.isEmpty() || getWidth() <= 0)
+        return;
     
-    if (thumbnail.getTotalLength() > 0.0)
+    double anchor = (double)visible.getStart() + (double)visible.getLength() * x / getWidth();
+    auto length = (juce::int64)((double)visible.getLength() * factor);
+    setVisibleRange((juce::int64)(anchor - (double)length * x / getWidth()), length);
+}
+
+void WaveformDisplay::mouseWheelMove(const juce::MouseEvent& e, const juce::MouseWheelDetails& wheel)
+{
+    auto visible = getVisibleRange();
+    if (wheel.deltaX != 0.0f || e.mods.isShiftDown())
     {
-        thumbnail.drawChannels(g, getLocalBounds(), 0.0, thumbnail.getTotalLength(), 0.7f);
+        float delta = wheel.deltaX != 0.0f ? wheel.deltaX : wheel.deltaY;
+        setVisibleRange(visible.getStart() - (juce::int64)(delta * 0.5f * (float)visible.getLength()), visible.getLength());
+    }
+    else
+    {
+        zoomAround((float)e.x, std::pow(2.0, -wheel.deltaY * 2.0));
+    }
+}
+
+void WaveformDisplay::mouseMagnify(const juce::MouseEvent& e, float scaleFactor)
+{
+    if (scaleFactor > 0.0f)
+        zoomAround((float)e.x, 1.0 / scaleFactor);
+}
+
+void WaveformDisplay::mouseDown(const juce::MouseEvent&)
+{
+    dragStartView = getVisibleRange().getStart();
+}
+
+void WaveformDisplay::mouseDrag(const juce::MouseEvent& e)
+{
+    auto visible = getVisibleRange();
+    if (getWidth() > 0)
+        setVisibleRange(dragStartView - (juce::int64)((double)e.getDistanceFromDragStartX() * (double)visible.getLength() / getWidth()),
+                        visible.getLength());
+}
+
+void WaveformDisplay::mouseDoubleClick(const juce::MouseEvent&)
+{
+    setVisibleRange(0, getTotalSamples());
+}
+
+void WaveformDisplay::drawPeaks(juce::Graphics& g, juce::Rectangle<int> area)
+{
+    int numChannels = peaks->getNumChannels();
+    int width = area.getWidth();
+    auto visible = getVisibleRange();
+    if (numChannels <= 0 || width <= 0 || visible.isEmpty())
+        return;
+    
+    // Below the pyramid's finest level the peaks come from the samples
+    // themselves, decoded off the message thread; until they arrive the base
+    // level stands in.
+    detailPending = false;
+    if (visible.getLength() < (juce::int64)width * PeakPyramid::baseSamplesPerPeak)
+    {
+        if (detail == nullptr || detail->getRange() != visible)
+            detail = peakCache->getDetail(file, audio.getFormatManager(), visible, numChannels);
+        if (detail->isReady())
+        {
+            drawDetail(g, area, visible);
+            return;
+        }
+        detailPending = !detail->isFinished();
+    }
+    
+    float channelHeight = (float)area.getHeight() / (float)numChannels;
+    juce::RectangleList<float> columns;
+    
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        float centre = (float)area.getY() + channelHeight * ((float)ch + 0.5f);
+        float halfHeight = channelHeight * 0.5f * 0.7f;
         
-        if (abMarkersEnabled)
+        for (int x = 0; x < width; ++x)
         {
-            double totalLength = thumbnail.getTotalLength();
-            if (totalLength > 0.0)
+            juce::int64 startSample = visible.getStart() + visible.getLength() * x / width;
+            juce::int64 endSample = visible.getStart() + visible.getLength() * (x + 1) / width;
+            float minValue, maxValue;
+            if (!peaks->getRange(ch, startSample, endSample, minValue, maxValue))
+                break;
+            
+            float top = centre - maxValue * halfHeight;
+            float bottom = centre - minValue * halfHeight;
+            columns.addWithoutMerging({ (float)(area.getX() + x), top, 1.0f, juce::jmax(1.0f, bottom - top) });
+        }
+    }
+    
+    g.fillRectList(columns);
+}
+
+void WaveformDisplay::drawDetail(juce::Graphics& g, juce::Rectangle<int> area, juce::Range<juce::int64> visible)
+{
+    auto& detailBuffer = detail->getBuffer();
+    int numChannels = juce::jmin(peaks->getNumChannels(), detailBuffer.getNumChannels());
+    int width = area.getWidth();
+    double samplesPerPixel = (double)visible.getLength() / width;
+    float channelHeight = (float)area.getHeight() / (float)numChannels;
+    
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        float centre = (float)area.getY() + channelHeight * ((float)ch + 0.5f);
+        float halfHeight = channelHeight * 0.5f * 0.7f;
+        const float* samples = detailBuffer.getReadPointer(ch);
+        
+        if (samplesPerPixel >= 1.0)
+        {
+            juce::RectangleList<float> columns;
+            for (int x = 0; x < width; ++x)
             {
-                float startX = (float)((abStart / totalLength) * (double)getWidth());
-                float endX = (float)((abEnd / totalLength) * (double)getWidth());
-                
-                g.setColour(juce::Colours::red.withAlpha(0.3f));
-                g.fillRect(startX, 0.0f, endX - startX, (float)getHeight());
-                
-                g.setColour(juce::Colours::red);
-                g.drawLine(startX, 0, startX, getHeight(), 2.0f);
-                g.drawLine(endX, 0, endX, getHeight(), 2.0f);
+                int first = (int)(samplesPerPixel * x);
+                int last = juce::jmax(first + 1, (int)(samplesPerPixel * (x + 1)));
+                auto range = juce::FloatVectorOperations::findMinAndMax(samples + first, last - first);
+                float top = centre - range.getEnd() * halfHeight;
+                float bottom = centre - range.getStart() * halfHeight;
+                columns.addWithoutMerging({ (float)(area.getX() + x), top, 1.0f, juce::jmax(1.0f, bottom - top) });
             }
+            g.fillRectList(columns);
         }
-        
-        for (const auto& marker : displayMarkers)
+        else
         {
-            double totalLength = thumbnail.getTotalLength();
-            if (totalLength > 0.0)
+            // Fewer samples than pixels: join the samples up and mark each one.
+            juce::Path path;
+            float pixelsPerSample = (float)(1.0 / samplesPerPixel);
+            for (int i = 0; i < detailBuffer.getNumSamples(); ++i)
             {
-                float xPos = (float)((marker.timestamp / totalLength) * (double)getWidth());
-                g.setColour(juce::Colours::green);
-                g.drawLine(xPos, 0, xPos, getHeight(), 1.5f);
-                g.setColour(juce::Colours::green.withAlpha(0.8f));
-                g.drawText(marker.label, xPos + 2, 2, 100, 20, juce::Justification::left);
+                juce::Point<float> point((float)area.getX() + (float)i * pixelsPerSample, centre - samples[i] * halfHeight);
+                if (i == 0)
+                    path.startNewSubPath(point);
+                else
+                    path.lineTo(point);
+                if (pixelsPerSample >= 6.0f)
+                    g.fillEllipse(point.x - 1.5f, point.y - 1.5f, 3.0f, 3.0f);
             }
+            g.strokePath(path, juce::PathStrokeType(1.0f));
+        }
+    }
+}
+
+void WaveformDisplay::renderWaveformImage()
+{
+    imageNeedsRender = false;
+    imageComplete = peaks != nullptr && peaks->isComplete();
+    lastRenderMs = juce::Time::getMillisecondCounterHiRes();
+    
+    auto scale = juce::Component::getApproximateScaleFactorForComponent(this);
+    int imageWidth = juce::roundToInt((float)getWidth() * scale);
+    int imageHeight = juce::roundToInt((float)getHeight() * scale);
+    if (imageWidth <= 0 || imageHeight <= 0)
+    {
+        waveformImage = {};
+        return;
+    }
+    
+    if (waveformImage.getWidth() != imageWidth || waveformImage.getHeight() != imageHeight)
+        waveformImage = juce::Image(juce::Image::RGB, imageWidth, imageHeight, false);
+    
+    juce::Graphics g(waveformImage);
+    g.addTransform(juce::AffineTransform::scale(scale));
+    g.fillAll(juce::Colour::fromString("#FF1A1F2B"));
+    g.setColour(juce::Colour::fromString("#FFFEE715"));
+    if (peaks != nullptr && peaks->getLengthInSeconds() > 0.0)
+        drawPeaks(g, getLocalBounds());
+}
+
+void WaveformDisplay::resized()
+{
+    imageNeedsRender = true;
+}
+
+void WaveformDisplay::onVBlank()
+{
+    // While the peaks are still being scanned, redraw the image a few times a
+    // second so the waveform fills in; after that it only changes with the view.
+    if (peaks != nullptr && !imageComplete && juce::Time::getMillisecondCounterHiRes() - lastRenderMs > 150.0)
+    {
+        imageNeedsRender = true;
+        repaint();
+    }
+    
+    if (detailPending && detail != nullptr && detail->isFinished())
+    {
+        imageNeedsRender = true;
+        repaint();
+    }
+    
+    if (positionSource != nullptr)
+        setCurrentPosition(positionSource());
+}
+
+float WaveformDisplay::timeToX(double seconds) const
+{
+    auto visible = getVisibleRange();
+    if (visible.isEmpty() || peaks->getSampleRate() <= 0.0)
+        return -1.0f;
+    return (float)((seconds * peaks->getSampleRate() - (double)visible.getStart()) / (double)visible.getLength() * (double)getWidth());
+}
+
+void WaveformDisplay::repaintPlayhead(float x)
+{
+    if (x >= 0.0f && x <= (float)getWidth())
+        repaint(juce::roundToInt(x) - 2, 0, 5, getHeight());
+}
+
+void WaveformDisplay::paint(juce::Graphics& g)
+{
+    if (imageNeedsRender || waveformImage.isNull())
+        renderWaveformImage();
+    
+    g.drawImage(waveformImage, getLocalBounds().toFloat());
+    
+    if (peaks != nullptr && peaks->getLengthInSeconds() > 0.0)
+    {
+        if (abMarkersEnabled)
+        {
+            float startX = timeToX(abStart);
+            float endX = timeToX(abEnd);
+            
+            g.setColour(juce::Colours::red.withAlpha(0.3f));
+            g.fillRect(startX, 0.0f, endX - startX, (float)getHeight());
+            
+            g.setColour(juce::Colours::red);
+            g.drawLine(startX, 0, startX, getHeight(), 2.0f);
+            g.drawLine(endX, 0, endX, getHeight(), 2.0f);
         }
         
-        double totalLength = thumbnail.getTotalLength();
-        if (totalLength > 0.0)
+        for (const auto& marker : displayMarkers)
+        {
+            float xPos = timeToX(marker.timestamp);
+            g.setColour(juce::Colours::green);
+            g.drawLine(xPos, 0, xPos, getHeight(), 1.5f);
+            g.setColour(juce::Colours::green.withAlpha(0.8f));
+            g.drawText(marker.label, xPos + 2, 2, 100, 20, juce::Justification::left);
+        }
+        
+        if (playheadX >= 0.0f)
         {
-            float xPos = (float)((currentPosition / totalLength) * (double)getWidth());
             g.setColour(juce::Colours::white);
-            g.drawLine(xPos, 0, xPos, getHeight(), 2.0f);
+            g.drawLine(playheadX, 0, playheadX, getHeight(), 2.0f);
         }
     }
     else
     {
+        g.setColour(juce::Colour::fromString("#FFFEE715"));
         g.drawText("No audio loaded", getLocalBounds(), juce::Justification::centred);
     }
 }
 
 void WaveformDisplay::loadWaveform(const juce::File& audioFile)
 {
-    thumbnail.clear();
+    peaks.reset();
+    detail.reset();
+    detailPending = false;
+    file = audioFile;
     if (audioFile.existsAsFile())
     {
-        thumbnail.setSource(new juce::FileInputSource(audioFile));
+        peaks = peakCache->getPeaks(audioFile, audio.getFormatManager());
         fileLoaded = true;
     }
+    viewStart = 0;
+    viewLength = 0;
+    imageNeedsRender = true;
+    imageComplete = false;
+    playheadX = -1.0f;
     repaint();
 }
 
 void WaveformDisplay::setCurrentPosition(double position)
 {
+    bool wasVisible = currentPosition * (peaks != nullptr ? peaks->getSampleRate() : 0.0) < (double)getVisibleRange().getEnd();
     currentPosition = position;
+    
+    // When zoomed in, turn the page as the playhead runs off the right edge.
+    float x = timeToX(position);
+    if (viewLength > 0 && wasVisible && x > (float)getWidth() && !isMouseButtonDown())
+    {
+        auto visible = getVisibleRange();
+        setVisibleRange((juce::int64)(position * peaks->getSampleRate()), visible.getLength());
+        x = timeToX(position);
+    }
+    
+    // Snap to whole pixels so a slow-moving playhead doesn't repaint anything
+    // until it actually moves.
+    x = x >= 0.0f && x <= (float)getWidth() ? std::floor(x) + 0.5f : -1.0f;
+    if (x == playheadX)
+        return;
+    
+    repaintPlayhead(playheadX);
+    repaintPlayhead(x);
+    playheadX = x;
 }
 
 void WaveformDisplay::setABMarkers(bool enabled, double startPos, double endPos)
@@ -116,11 +355,6 @@ void WaveformDisplay::setABMarkers(bool enabled, double startPos, double endPos)
     repaint();
 }
 
-void WaveformDisplay::timerCallback()
-{
-    repaint();
-}
-
 void WaveformDisplay::setMarkers(const juce::Array<Marker>& markersToShow)
 {
     displayMarkers = markersToShow;
@@ -245,16 +479,127 @@ void ABLoopDialog::resized()
     cancelButton.setBounds(buttonRow.removeFromLeft(150));
 }
 
-juce::File PlayerGUI::getSVGFile(const juce::String& name)
+PerfOverlay::PerfOverlay(PlayerAudio& audioRef) : audio(audioRef)
+{
+    setInterceptsMouseClicks(true, false);
+}
+
+void PerfOverlay::visibilityChanged()
+{
+    if (isVisible())
+    {
+        timerCallback();
+        startTimer(250);
+    }
+    else
+    {
+        stopTimer();
+    }
+}
+
+void PerfOverlay::timerCallback()
+{
+    snapshot = audio.getPerfSnapshot();
+    repaint();
+}
+
+void PerfOverlay::mouseDoubleClick(const juce::MouseEvent&)
+{
+    audio.resetPerfStats();
+    timerCallback();
+}
+
+void PerfOverlay::paint(juce::Graphics& g)
 {
-    juce::File execDir = juce::File::getSpecialLocation(juce::File::currentExecutableFile).getParentDirectory();
-    for (int i = 0; i < 5; ++i)
+    auto area = getLocalBounds().toFloat();
+    g.setColour(juce::Colours::black.withAlpha(0.8f));
+    g.fillRoundedRectangle(area, 6.0f);
+    
+    auto content = getLocalBounds().reduced(10);
+    auto graph = content.removeFromBottom(60).toFloat();
+    
+    g.setColour(juce::Colour::fromString("#FFFEE715"));
+    g.setFont(juce::FontOptions(13.0f));
+    g.drawFittedText(snapshot.toText(), content, juce::Justification::topLeft, 12);
+    
+    juce::int64 peak = 1;
+    for (auto count : snapshot.histogram)
+        peak = juce::jmax(peak, count);
+    
+    float barWidth = graph.getWidth() / (float)PerfSnapshot::numBins;
+    for (int i = 0; i < PerfSnapshot::numBins; ++i)
     {
-        juce::File svgDir = execDir.getSiblingFile("Source").getChildFile("svgs");
-        if (svgDir.exists()) return svgDir.getChildFile(name + ".svg");
-        execDir = execDir.getParentDirectory();
+        auto count = snapshot.histogram[(size_t)i];
+        if (count == 0)
+            continue;
+        
+        float height = juce::jmax(1.0f, graph.getHeight() * (float)std::log1p((double)count) / (float)std::log1p((double)peak));
+        bool late = (i + 1) * PerfSnapshot::binWidth > 1.0;
+        g.setColour(late ? juce::Colours::red : juce::Colours::limegreen);
+        g.fillRect(graph.getX() + i * barWidth, graph.getBottom() - height, juce::jmax(1.0f, barWidth - 1.0f), height);
     }
-    return juce::File();
+    
+    float deadlineX = graph.getX() + (float)(1.0 / PerfSnapshot::binWidth) * barWidth;
+    g.setColour(juce::Colours::white.withAlpha(0.6f));
+    g.drawVerticalLine(juce::roundToInt(deadlineX), graph.getY(), graph.getBottom());
+}
+
+LevelMeterDisplay::LevelMeterDisplay(const juce::String& name, std::function<MeterReading()> source)
+    : label(name), readingSource(std::move(source))
+{
+    setInterceptsMouseClicks(false, false);
+}
+
+void LevelMeterDisplay::onVBlank()
+{
+    if (!isShowing() || readingSource == nullptr)
+        return;
+    
+    auto latest = readingSource();
+    if (latest != reading)
+    {
+        reading = latest;
+        repaint();
+    }
+}
+
+void LevelMeterDisplay::paint(juce::Graphics& g)
+{
+    const float minDb = -60.0f;
+    const float maxDb = 6.0f;
+    
+    auto area = getLocalBounds();
+    auto text = area.removeFromRight(230);
+    g.setColour(juce::Colours::white);
+    g.setFont(juce::FontOptions(13.0f));
+    g.drawText(label, area.removeFromLeft(50), juce::Justification::centredLeft);
+    
+    auto formatDb = [](float db) { return db <= -99.0f ? juce::String("-inf") : juce::String(db, 1); };
+    g.drawText("TP " + formatDb(reading.truePeakDb) + "  M " + formatDb(reading.momentaryLufs)
+                   + "  S " + formatDb(reading.shortTermLufs) + " LUFS",
+               text.withTrimmedLeft(10), juce::Justification::centredLeft);
+    
+    auto bars = area.reduced(0, 4).toFloat();
+    g.setColour(juce::Colours::black.withAlpha(0.6f));
+    g.fillRect(bars);
+    
+    auto toX = [&bars, minDb, maxDb](float db)
+    {
+        return bars.getX() + bars.getWidth() * (juce::jlimit(minDb, maxDb, db) - minDb) / (maxDb - minDb);
+    };
+    auto barColour = [](float db)
+    {
+        return db > 0.0f ? juce::Colours::red : db > -9.0f ? juce::Colours::orange : juce::Colours::limegreen;
+    };
+    
+    auto peakBar = bars.removeFromTop(bars.getHeight() * 0.5f);
+    g.setColour(barColour(reading.peakDb));
+    g.fillRect(peakBar.withRight(toX(reading.peakDb)));
+    g.setColour(barColour(reading.rmsDb).withAlpha(0.7f));
+    g.fillRect(bars.withRight(toX(reading.rmsDb)));
+    
+    g.setColour(juce::Colours::white.withAlpha(0.6f));
+    g.drawVerticalLine(juce::roundToInt(toX(0.0f)), peakBar.getY(), bars.getBottom());
 }
 
 juce::String PlayerGUI::formatTime(double seconds)
@@ -265,55 +610,60 @@ juce::String PlayerGUI::formatTime(double seconds)
     return juce::String(mins) + ":" + juce::String(secs).paddedLeft('0', 2);
 }
 
-void PlayerGUI::safeSetButtonImage(juce::DrawableButton& btn, std::unique_ptr<juce::Drawable>& drawable, const juce::String& fallbackText)
+void PlayerGUI::safeSetButtonImage(juce::DrawableButton& btn, const juce::Drawable* drawable, const juce::String& fallbackText)
 {
     btn.setButtonStyle(juce::DrawableButton::ImageFitted);
-    if (drawable) { btn.setImages(drawable.get()); btn.setButtonText(""); }
+    if (drawable) { btn.setImages(drawable); btn.setButtonText(""); }
     else btn.setButtonText(fallbackText);
 }
-PlayerGUI::PlayerGUI(PlayerAudio& audioRef) : audio(audioRef), waveformDisplay(audioRef), mixerWaveformDisplay(audioRef)
-{
-    loadIcon     = createDrawableFromSVGFile(getSVGFile("upload"));
-    restartIcon  = createDrawableFromSVGFile(getSVGFile("restart"));
-    stopIcon     = createDrawableFromSVGFile(getSVGFile("stop"));
-    playIcon     = createDrawableFromSVGFile(getSVGFile("start"));
-    pauseIcon    = createDrawableFromSVGFile(getSVGFile("pause"));
-    startIcon    = createDrawableFromSVGFile(getSVGFile("startsong"));
-    endIcon      = createDrawableFromSVGFile(getSVGFile("endsong"));
-    loopIcon     = createDrawableFromSVGFile(getSVGFile("loop"));
-    muteIcon     = createDrawableFromSVGFile(getSVGFile("mute"));
-    unmuteIcon   = createDrawableFromSVGFile(getSVGFile("unmute"));
-    backwardIcon = createDrawableFromSVGFile(getSVGFile("backward"));
-    forwardIcon  = createDrawableFromSVGFile(getSVGFile("forward"));
-    playlistIcon = createDrawableFromSVGFile(getSVGFile("playlist"));
-    mixerIcon    = createDrawableFromSVGFile(getSVGFile("mixer"));
-    abLoopIcon   = createDrawableFromSVGFile(getSVGFile("abloop"));
-    saveIcon     = createDrawableFromSVGFile(getSVGFile("save"));
-    markerIcon   = createDrawableFromSVGFile(getSVGFile("marker"));
-    
-    safeSetButtonImage(loadButton, loadIcon, "Load");
-    safeSetButtonImage(restartButton, restartIcon, "Restart");
-    safeSetButtonImage(stopButton, stopIcon, "Stop");
-    safeSetButtonImage(playPauseButton, playIcon, "Play");
-    safeSetButtonImage(startButton, startIcon, "Start");
-    safeSetButtonImage(endButton, endIcon, "End");
-    safeSetButtonImage(loopButton, loopIcon, "Loop");
-    safeSetButtonImage(muteButton, muteIcon, "Mute");
-    safeSetButtonImage(backwardButton, backwardIcon, "backward 5s");
-    safeSetButtonImage(forwardButton, forwardIcon, "forward 5s");
-    safeSetButtonImage(playlistButton, playlistIcon, "Playlist");
-    safeSetButtonImage(mixerButton, mixerIcon, "Mixer");
-    safeSetButtonImage(abLoopButton, abLoopIcon, "A-B Loop");
-    safeSetButtonImage(saveButton, saveIcon, "Save");
-    safeSetButtonImage(markerButton, markerIcon, "Marker");
-    safeSetButtonImage(track1PlayPauseButton, playIcon, "Play T1");
-    safeSetButtonImage(track1MuteButton, muteIcon, "Mute T1");
-    safeSetButtonImage(track1ForwardButton, forwardIcon, "Fwd T1");
-    safeSetButtonImage(track1BackwardButton, backwardIcon, "Bwd T1");
-    safeSetButtonImage(track2PlayPauseButton, playIcon, "Play T2");
-    safeSetButtonImage(track2MuteButton, muteIcon, "Mute T2");
-    safeSetButtonImage(track2ForwardButton, forwardIcon, "Fwd T2");
-    safeSetButtonImage(track2BackwardButton, backwardIcon, "Bwd T2");
+
+const juce::Drawable* PlayerGUI::getIcon(const juce::String& name)
+{
+    auto& icon = icons[name];
+    if (icon == nullptr)
+    {
+        int size = 0;
+        if (auto* data = BinaryData::getNamedResource((name + "_svg").toRawUTF8(), size))
+            if (auto xml = juce::parseXML(juce::String::fromUTF8(data, size)))
+                icon = juce::Drawable::createFromSVG(*xml);
+    }
+    return icon.get();
+}
+PlayerGUI::PlayerGUI(PlayerAudio& audioRef) : waveformDisplay(audioRef), mixerWaveformDisplay(audioRef), audio(audioRef),
+    mainDeck(audioRef.getDeck(PlayerAudio::mainDeckIndex)), mixerDeck(audioRef.getDeck(PlayerAudio::mixerDeckIndex)),
+    perfOverlay(audioRef),
+    mainMeter("Deck 1", [this] { return mainDeck.getMeter().getReading(); }),
+    mixerMeter("Deck 2", [this] { return mixerDeck.getMeter().getReading(); }),
+    masterMeter("Master", [this] { return audio.getMasterMeter().getReading(); }),
+    library(audioRef.getFormatManager(), Library::getDefaultIndexFile()),
+    session(TrackCache::getAppDataDirectory())
+{
+    StartupTrace::mark("gui members");
+    
+    safeSetButtonImage(loadButton, getIcon("upload"), "Load");
+    safeSetButtonImage(restartButton, getIcon("restart"), "Restart");
+    safeSetButtonImage(stopButton, getIcon("stop"), "Stop");
+    safeSetButtonImage(playPauseButton, getIcon("start"), "Play");
+    safeSetButtonImage(startButton, getIcon("startsong"), "Start");
+    safeSetButtonImage(endButton, getIcon("endsong"), "End");
+    safeSetButtonImage(loopButton, getIcon("loop"), "Loop");
+    safeSetButtonImage(muteButton, getIcon("mute"), "Mute");
+    safeSetButtonImage(backwardButton, getIcon("backward"), "backward 5s");
+    safeSetButtonImage(forwardButton, getIcon("forward"), "forward 5s");
+    safeSetButtonImage(playlistButton, getIcon("playlist"), "Playlist");
+    safeSetButtonImage(mixerButton, getIcon("mixer"), "Mixer");
+    safeSetButtonImage(abLoopButton, getIcon("abloop"), "A-B Loop");
+    safeSetButtonImage(saveButton, getIcon("save"), "Save");
+    safeSetButtonImage(markerButton, getIcon("marker"), "Marker");
+    safeSetButtonImage(track1PlayPauseButton, getIcon("start"), "Play T1");
+    safeSetButtonImage(track1MuteButton, getIcon("mute"), "Mute T1");
+    safeSetButtonImage(track1ForwardButton, getIcon("forward"), "Fwd T1");
+    safeSetButtonImage(track1BackwardButton, getIcon("backward"), "Bwd T1");
+    safeSetButtonImage(track2PlayPauseButton, getIcon("start"), "Play T2");
+    safeSetButtonImage(track2MuteButton, getIcon("mute"), "Mute T2");
+    safeSetButtonImage(track2ForwardButton, getIcon("forward"), "Fwd T2");
+    safeSetButtonImage(track2BackwardButton, getIcon("backward"), "Bwd T2");
+    StartupTrace::mark("icons");
     
     for (auto* b : { &loadButton, &restartButton, &stopButton, &playPauseButton, &startButton, &endButton,
                  &loopButton, &muteButton, &backwardButton, &forwardButton, &playlistButton, &mixerButton,
@@ -330,6 +680,7 @@ PlayerGUI::PlayerGUI(PlayerAudio& audioRef) : audio(audioRef), waveformDisplay(a
     volumeSlider.setRange(0.0, 1.0, 0.01);
     volumeSlider.setValue(0.8, juce::dontSendNotification);
     volumeSlider.addListener(this);
+    volumeSlider.onDragEnd = [this]() { session.commitPending(); };
     addAndMakeVisible(volumeSlider);
     
     mixerVolumeSlider.setColour(juce::Slider::thumbColourId, juce::Colour::fromString("#FFFEE715"));
@@ -339,6 +690,7 @@ PlayerGUI::PlayerGUI(PlayerAudio& audioRef) : audio(audioRef), waveformDisplay(a
     mixerVolumeSlider.setRange(0.0, 1.0, 0.01);
     mixerVolumeSlider.setValue(0.8, juce::dontSendNotification);
     mixerVolumeSlider.addListener(this);
+    mixerVolumeSlider.onDragEnd = [this]() { session.commitPending(); };
     mixerVolumeSlider.setVisible(false);
     addAndMakeVisible(mixerVolumeSlider);
     
@@ -380,6 +732,7 @@ PlayerGUI::PlayerGUI(PlayerAudio& audioRef) : audio(audioRef), waveformDisplay(a
     speedSlider.setValue(1.0, juce::dontSendNotification);
     speedSlider.setTextValueSuffix("x");
     speedSlider.addListener(this);
+    speedSlider.onDragEnd = [this]() { session.commitPending(); };
     addAndMakeVisible(speedSlider);
     
     mixerSpeedSlider.setSliderStyle(juce::Slider::LinearHorizontal);
@@ -389,10 +742,11 @@ PlayerGUI::PlayerGUI(PlayerAudio& audioRef) : audio(audioRef), waveformDisplay(a
     mixerSpeedSlider.setColour(juce::Slider::backgroundColourId, juce::Colour::fromString("#FF1A1F2B"));
     mixerSpeedSlider.setColour(juce::Slider::textBoxTextColourId, juce::Colour::fromString("#FFFEE715"));
     mixerSpeedSlider.setColour(juce::Slider::textBoxBackgroundColourId, juce::Colour::fromString("#FF1A1F2B"));
-    mixerSpeedSlider.setRange(0.5, 2.0, 0.1);
+    mixerSpeedSlider.setRange(0.5, 2.0, 0.001);
     mixerSpeedSlider.setValue(1.0, juce::dontSendNotification);
     mixerSpeedSlider.setTextValueSuffix("x");
     mixerSpeedSlider.addListener(this);
+    mixerSpeedSlider.onDragEnd = [this]() { session.commitPending(); };
     mixerSpeedSlider.setVisible(false);
     addAndMakeVisible(mixerSpeedSlider);
     
@@ -407,6 +761,42 @@ PlayerGUI::PlayerGUI(PlayerAudio& audioRef) : audio(audioRef), waveformDisplay(a
     mixerSpeedLabel.setVisible(false);
     addAndMakeVisible(mixerSpeedLabel);
     
+    for (auto* box : { &stretchBox, &mixerStretchBox })
+    {
+        box->addItem("Resample", 1);
+        box->addItem("Keep pitch: fast", 2);
+        box->addItem("Keep pitch: normal", 3);
+        box->addItem("Keep pitch: high", 4);
+        box->setSelectedId(1, juce::dontSendNotification);
+        box->setColour(juce::ComboBox::backgroundColourId, juce::Colour::fromString("#FF1A1F2B"));
+        box->setColour(juce::ComboBox::textColourId, juce::Colour::fromString("#FFFEE715"));
+        box->setColour(juce::ComboBox::arrowColourId, juce::Colour::fromString("#FFFEE715"));
+        addAndMakeVisible(box);
+    }
+    stretchBox.onChange = [this] { mainDeck.setTimeStretchQuality((TimeStretchSource::Quality)(stretchBox.getSelectedId() - 1)); };
+    mixerStretchBox.onChange = [this] { mixerDeck.setTimeStretchQuality((TimeStretchSource::Quality)(mixerStretchBox.getSelectedId() - 1)); };
+    mixerStretchBox.setVisible(false);
+    
+    syncButton.setButtonText("Sync");
+    syncButton.setColour(juce::TextButton::buttonColourId, juce::Colour::fromString("#FF2E3648"));
+    syncButton.setColour(juce::TextButton::textColourOffId, juce::Colour::fromString("#FFFEE715"));
+    syncButton.onClick = [this] { syncMixerTempo(); };
+    syncButton.setEnabled(false);
+    addChildComponent(syncButton);
+    
+    // On by default so an A-B loop set on a loaded track plays from RAM. It
+    // takes effect from the next track loaded.
+    memoryButton.setButtonText("RAM");
+    memoryButton.setClickingTogglesState(true);
+    memoryButton.setColour(juce::TextButton::buttonColourId, juce::Colour::fromString("#FF2E3648"));
+    memoryButton.setColour(juce::TextButton::buttonOnColourId, juce::Colour::fromString("#FFFEE715"));
+    memoryButton.setColour(juce::TextButton::textColourOffId, juce::Colour::fromString("#FFFEE715"));
+    memoryButton.setColour(juce::TextButton::textColourOnId, juce::Colour::fromString("#FF1A1F2B"));
+    memoryButton.onClick = [this] { audio.setInMemoryMode(memoryButton.getToggleState()); };
+    memoryButton.setToggleState(true, juce::dontSendNotification);
+    audio.setInMemoryMode(true);
+    addAndMakeVisible(memoryButton);
+    
     track1Label.setText("TRACK 1", juce::dontSendNotification);
     track1Label.setColour(juce::Label::textColourId, juce::Colour::fromString("#FFFEE715"));
     track1Label.setJustificationType(juce::Justification::centred);
@@ -465,6 +855,8 @@ PlayerGUI::PlayerGUI(PlayerAudio& audioRef) : audio(audioRef), waveformDisplay(a
     mixerTotalTimeLabel.setVisible(false);
     addAndMakeVisible(mixerTotalTimeLabel);
     
+    waveformDisplay.setPositionSource([this] { return mainDeck.getPosition(); });
+    mixerWaveformDisplay.setPositionSource([this] { return mixerDeck.getPosition(); });
     addAndMakeVisible(waveformDisplay);
     addAndMakeVisible(mixerWaveformDisplay);
     mixerWaveformDisplay.setVisible(false);
@@ -483,24 +875,70 @@ PlayerGUI::PlayerGUI(PlayerAudio& audioRef) : audio(audioRef), waveformDisplay(a
     addAndMakeVisible(playlistBox);
     playlistBox.setVisible(false);
     
+    librarySearch.setTextToShowWhenEmpty("Search library...", juce::Colours::grey);
+    librarySearch.setColour(juce::TextEditor::backgroundColourId, juce::Colour::fromString("#FF1A1F2B"));
+    librarySearch.setColour(juce::TextEditor::textColourId, juce::Colour::fromString("#FFFEE715"));
+    librarySearch.onTextChange = [this] { updateLibraryResults(); };
+    addChildComponent(librarySearch);
+    
+    libraryScanButton.setButtonText("Add Folder...");
+    libraryScanButton.setColour(juce::TextButton::buttonColourId, juce::Colour::fromString("#FF2E3648"));
+    libraryScanButton.setColour(juce::TextButton::textColourOffId, juce::Colour::fromString("#FFFEE715"));
+    libraryScanButton.onClick = [this]()
+    {
+        fileChooser = std::make_unique<juce::FileChooser>("Add a folder to the library...", juce::File());
+        fileChooser->launchAsync(juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectDirectories,
+            [this](const juce::FileChooser& chooser)
+            {
+                auto folder = chooser.getResult();
+                if (folder.isDirectory())
+                    library.scan(folder);
+            });
+    };
+    addChildComponent(libraryScanButton);
+    
+    library.addChangeListener(this);
+    library.load();
+    
+    playlist.setMetadataLookup([this](const juce::File& file, PlaylistEntry& entry)
+    {
+        int index = library.indexOf(file);
+        if (index < 0)
+            return false;
+        const auto& track = library.getTrack(index);
+        entry.title = track.title;
+        entry.artist = track.artist;
+        entry.duration = track.duration;
+        return true;
+    });
+    playlist.addListener(this);
+    
+    addChildComponent(perfOverlay);
+    addAndMakeVisible(mainMeter);
+    addChildComponent(mixerMeter);
+    addAndMakeVisible(masterMeter);
+    perfLog = std::make_unique<PerfLog>([this] { return audio.getPerfSnapshot(); },
+                                        TrackCache::getAppDataDirectory().getChildFile("perf.log"), 60);
+    
     startTimer(100);
     loadSession();
+    StartupTrace::mark("session restored");
     setWantsKeyboardFocus(true);
 
     track1PlayPauseButton.setVisible(false);
     track2PlayPauseButton.setVisible(false);
     
-    if (audio.getTitle().isNotEmpty())
+    if (mainDeck.getTitle().isNotEmpty())
     {
-        updateMetadata(audio.getTitle(), audio.getArtist(), audio.getAlbum(), audio.getDuration());
-        double totalLength = audio.getLengthInSeconds();
+        updateMetadata(mainDeck.getTitle(), mainDeck.getArtist(), mainDeck.getAlbum(), mainDeck.getDuration());
+        double totalLength = mainDeck.getLengthInSeconds();
         positionSlider.setRange(0.0, totalLength, 0.001);
         totalTimeLabel.setText(formatTime(totalLength), juce::dontSendNotification);
     }
     
-    if (audio.getMixerTitle().isNotEmpty())
+    if (mixerDeck.getTitle().isNotEmpty())
     {
-        updateMixerMetadata(audio.getMixerTitle(), audio.getMixerArtist(), audio.getMixerAlbum(), audio.getMixerDuration());
+        updateMixerMetadata(mixerDeck.getTitle(), mixerDeck.getArtist(), mixerDeck.getAlbum(), mixerDeck.getDuration());
         mixerVolumeSlider.setVisible(true);
         mixerMetadataLabel.setVisible(true);
     }
@@ -509,12 +947,15 @@ PlayerGUI::PlayerGUI(PlayerAudio& audioRef) : audio(audioRef), waveformDisplay(a
 PlayerGUI::~PlayerGUI()
 {
     stopTimer();
-    saveSession();
+    playlist.removeListener(this);
+    library.removeChangeListener(this);
+    journalPositions();
 }
 
 void PlayerGUI::paint(juce::Graphics& g)
 {
     g.fillAll(juce::Colour::fromString("#FF101820"));
+    StartupTrace::finish(TrackCache::getAppDataDirectory().getChildFile("perf.log"));
 }
 
 void PlayerGUI::resized()
@@ -547,7 +988,7 @@ void PlayerGUI::resized()
     
     area.removeFromTop(20);
     
-    if (audio.hasMixerTrack())
+    if (mixerDeck.hasTrack())
     {
         int halfWidth = (area.getWidth() - 20) / 2;
         
@@ -578,12 +1019,20 @@ void PlayerGUI::resized()
         leftPanel.removeFromTop(10);
         auto speedArea = leftPanel.removeFromTop(30);
         speedLabel.setBounds(speedArea.removeFromLeft(60));
+        stretchBox.setBounds(speedArea.removeFromRight(170));
+        speedArea.removeFromRight(10);
+        memoryButton.setBounds(speedArea.removeFromRight(50));
+        speedArea.removeFromRight(10);
         speedSlider.setBounds(speedArea);
         
         leftPanel.removeFromTop(10);
         volumeSlider.setBounds(leftPanel.removeFromTop(40));
         leftPanel.removeFromTop(10);
         metadataLabel.setBounds(leftPanel.removeFromTop(30));
+        leftPanel.removeFromTop(10);
+        mainMeter.setBounds(leftPanel.removeFromTop(24));
+        leftPanel.removeFromTop(4);
+        masterMeter.setBounds(leftPanel.removeFromTop(24));
         
         track2Label.setBounds(rightPanel.removeFromTop(30));
         rightPanel.removeFromTop(10);
@@ -607,12 +1056,18 @@ void PlayerGUI::resized()
         rightPanel.removeFromTop(10);
         auto mixerSpeedArea = rightPanel.removeFromTop(30);
         mixerSpeedLabel.setBounds(mixerSpeedArea.removeFromLeft(60));
+        mixerStretchBox.setBounds(mixerSpeedArea.removeFromRight(170));
+        mixerSpeedArea.removeFromRight(10);
+        syncButton.setBounds(mixerSpeedArea.removeFromRight(60));
+        mixerSpeedArea.removeFromRight(10);
         mixerSpeedSlider.setBounds(mixerSpeedArea);
         
         rightPanel.removeFromTop(10);
         mixerVolumeSlider.setBounds(rightPanel.removeFromTop(40));
         rightPanel.removeFromTop(10);
         mixerMetadataLabel.setBounds(rightPanel.removeFromTop(30));
+        rightPanel.removeFromTop(10);
+        mixerMeter.setBounds(rightPanel.removeFromTop(24));
     }
     else
     {
@@ -630,53 +1085,90 @@ void PlayerGUI::resized()
         area.removeFromTop(10);
         auto speedArea = area.removeFromTop(40);
         speedLabel.setBounds(speedArea.removeFromLeft(60));
+        stretchBox.setBounds(speedArea.removeFromRight(170));
+        speedArea.removeFromRight(10);
+        memoryButton.setBounds(speedArea.removeFromRight(50));
+        speedArea.removeFromRight(10);
         speedSlider.setBounds(speedArea);
         
         area.removeFromTop(10);
         volumeSlider.setBounds(area.removeFromTop(40));
         area.removeFromTop(10);
         metadataLabel.setBounds(area.removeFromTop(30));
+        area.removeFromTop(10);
+        mainMeter.setBounds(area.removeFromTop(24));
+        area.removeFromTop(4);
+        masterMeter.setBounds(area.removeFromTop(24));
     }
+    mixerMeter.setVisible(mixerDeck.hasTrack());
     
     if (playlistVisible)
+    {
         playlistBox.setBounds(area.removeFromBottom(200));
+        auto libraryRow = area.removeFromBottom(30);
+        libraryScanButton.setBounds(libraryRow.removeFromRight(150));
+        libraryRow.removeFromRight(10);
+        librarySearch.setBounds(libraryRow);
+    }
     else
         playlistBox.setBounds(0, 0, 0, 0);
+    librarySearch.setVisible(playlistVisible);
+    libraryScanButton.setVisible(playlistVisible);
+    
+    perfOverlay.setBounds(getLocalBounds().reduced(10).withTrimmedTop(btnH + 10).removeFromRight(460).removeFromTop(200));
 }
 
 void PlayerGUI::timerCallback()
 {
+    if (mainDeck.pollAdvance())
+    {
+        currentPlaylistIndex = queuedPlaylistIndex;
+        playlistBox.selectRow(currentPlaylistIndex);
+        showCurrentTrack();
+    }
+    
+    if (!mainDeck.isLoading())
+        queueNextInPlaylist();
+    
+    if (++sessionTicks % 50 == 0)
+        journalPositions();
+    
+    if (library.isScanning())
+        libraryScanButton.setButtonText("Scanning " + juce::String(library.getNumScanned()) + "/" + juce::String(library.getNumToScan()));
+    else if (libraryScanButton.getButtonText() != "Add Folder...")
+        libraryScanButton.setButtonText("Add Folder...");
+    
+    updateTempoDisplay();
+    
     if (!isDraggingPosition)
     {
-        double currentPos = audio.transportSource.getCurrentPosition();
-        double totalLength = audio.getLengthInSeconds();
+        double currentPos = mainDeck.getPosition();
+        double totalLength = mainDeck.getLengthInSeconds();
         
         if (totalLength > 0.0)
         {
             positionSlider.setValue(currentPos, juce::dontSendNotification);
             currentTimeLabel.setText(formatTime(currentPos), juce::dontSendNotification);
             totalTimeLabel.setText(formatTime(totalLength), juce::dontSendNotification);
-            waveformDisplay.setCurrentPosition(currentPos);
         }
     }
     
-    if (!isDraggingMixerPosition && audio.hasMixerTrack())
+    if (!isDraggingMixerPosition && mixerDeck.hasTrack())
     {
-        double mixerPos = audio.mixerTransportSource.getCurrentPosition();
-        double mixerLength = audio.getMixerLengthInSeconds();
+        double mixerPos = mixerDeck.getPosition();
+        double mixerLength = mixerDeck.getLengthInSeconds();
         
         if (mixerLength > 0.0)
         {
             mixerPositionSlider.setValue(mixerPos, juce::dontSendNotification);
             mixerCurrentTimeLabel.setText(formatTime(mixerPos), juce::dontSendNotification);
             mixerTotalTimeLabel.setText(formatTime(mixerLength), juce::dontSendNotification);
-            mixerWaveformDisplay.setCurrentPosition(mixerPos);
         }
     }
-    if (audio.isPlaying())
+    if (audio.isPlaying() && !mainDeck.isLoading() && !mainDeck.isNextTrackReady())
     {
-        double currentPos = audio.transportSource.getCurrentPosition();
-        double totalLength = audio.getLengthInSeconds();
+        double currentPos = mainDeck.getPosition();
+        double totalLength = mainDeck.getLengthInSeconds();
     
         if (totalLength > 0.0 && currentPos >= totalLength - 0.1)
         {
@@ -697,7 +1189,7 @@ void PlayerGUI::showABLoopDialog()
         double startTime = startMin * 60.0 + startSec;
         double endTime = endMin * 60.0 + endSec;
         
-        if (startTime < endTime && endTime <= audio.getLengthInSeconds())
+        if (startTime < endTime && endTime <= mainDeck.getLengthInSeconds())
         {
             audio.setABLooping(true, startTime, endTime);
             waveformDisplay.setABMarkers(true, startTime, endTime);
@@ -725,17 +1217,7 @@ void PlayerGUI::buttonClicked(juce::Button* button)
             {
                 auto file = chooser.getResult();
                 if (file.existsAsFile())
-                {
-                    audio.loadFile(file);
-                    updateMetadata(audio.getTitle(), audio.getArtist(), audio.getAlbum(), audio.getDuration());
-                    double totalLength = audio.getLengthInSeconds();
-                    positionSlider.setRange(0.0, totalLength, 0.001);
-                    totalTimeLabel.setText(formatTime(totalLength), juce::dontSendNotification);
-                    waveformDisplay.loadWaveform(file);
-                    audio.play();
-                    isPlaying = true;
-                    if (pauseIcon) playPauseButton.setImages(pauseIcon.get()); else playPauseButton.setButtonText("Pause");
-                }
+                    loadAndPlay(file);
             });
     }
     else if (button == &playPauseButton)
@@ -744,19 +1226,20 @@ void PlayerGUI::buttonClicked(juce::Button* button)
         {
             audio.pause();
             isPlaying = false;
-            if (playIcon) playPauseButton.setImages(playIcon.get()); else playPauseButton.setButtonText("Play");
+            journalPositions();
+            safeSetButtonImage(playPauseButton, getIcon("start"), "Play");
         }
         else
         {
             audio.play();
             isPlaying = true;
-            if (pauseIcon) playPauseButton.setImages(pauseIcon.get()); else playPauseButton.setButtonText("Pause");
+            safeSetButtonImage(playPauseButton, getIcon("pause"), "Pause");
         }
     }
     else if (button == &stopButton)
     {
         audio.stop();
-        audio.clearMixerTrack();
+        mixerDeck.clearTrack();
         isPlaying = false;
         
         positionSlider.setValue(0.0, juce::dontSendNotification);
@@ -780,6 +1263,8 @@ void PlayerGUI::buttonClicked(juce::Button* button)
         mixerPositionSlider.setVisible(false);
         mixerSpeedSlider.setVisible(false);
         mixerSpeedLabel.setVisible(false);
+        mixerStretchBox.setVisible(false);
+        syncButton.setVisible(false);
         mixerCurrentTimeLabel.setVisible(false);
         mixerTotalTimeLabel.setVisible(false);
         track2Label.setVisible(false);
@@ -791,6 +1276,8 @@ void PlayerGUI::buttonClicked(juce::Button* button)
         
         waveformDisplay.loadWaveform(juce::File());
         mixerWaveformDisplay.loadWaveform(juce::File());
+        mainTempo.reset();
+        mixerTempo.reset();
         
         audio.setABLooping(false, 0.0, 0.0);
         waveformDisplay.setABMarkers(false, 0.0, 0.0);
@@ -798,21 +1285,23 @@ void PlayerGUI::buttonClicked(juce::Button* button)
         audio.setLooping(false);
         
         markers.clear();
+        session.clearMarkers();
+        session.setDeckFile(PlayerAudio::mixerDeckIndex, juce::File());
+        session.setDeckPosition(PlayerAudio::mainDeckIndex, 0.0);
         
-        if (playIcon) playPauseButton.setImages(playIcon.get()); 
-        else playPauseButton.setButtonText("Play");
+        safeSetButtonImage(playPauseButton, getIcon("start"), "Play");
         
         resized();
     }
     else if (button == &restartButton || button == &startButton)
     {
-        audio.setPosition(0.0);
+        mainDeck.setPosition(0.0);
         positionSlider.setValue(0.0, juce::dontSendNotification);
         currentTimeLabel.setText("0:00", juce::dontSendNotification);
         
-        if (audio.hasMixerTrack())
+        if (mixerDeck.hasTrack())
         {
-            audio.setMixerPosition(0.0);
+            mixerDeck.setPosition(0.0);
             mixerPositionSlider.setValue(0.0, juce::dontSendNotification);
             mixerCurrentTimeLabel.setText("0:00", juce::dontSendNotification);
         }
@@ -831,10 +1320,10 @@ void PlayerGUI::buttonClicked(juce::Button* button)
     else if (button == &muteButton)
     {
         audio.toggleMute();
-        if (audio.isMuted)
-            safeSetButtonImage(muteButton, unmuteIcon, "Unmute");
+        if (audio.isMuted())
+            safeSetButtonImage(muteButton, getIcon("unmute"), "Unmute");
         else
-            safeSetButtonImage(muteButton, muteIcon, "Mute");
+            safeSetButtonImage(muteButton, getIcon("mute"), "Mute");
     }
     else if (button == &backwardButton)
         audio.jumpBackward(5.0);
@@ -857,19 +1346,15 @@ void PlayerGUI::buttonClicked(juce::Button* button)
     {
         playlistVisible = !playlistVisible;
         playlistBox.setVisible(playlistVisible);
-        if (playlistVisible && playlistFiles.isEmpty())
+        if (playlistVisible && playlist.isEmpty())
         {
             fileChooser = std::make_unique<juce::FileChooser>(
-                "Select audio files...", juce::File(), "*.wav;*.mp3;*.aiff;*.flac");
+                "Select audio files or a playlist...", juce::File(), "*.wav;*.mp3;*.aiff;*.flac;*.m3u;*.m3u8;*.pls");
             fileChooser->launchAsync(
                 juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectMultipleItems,
                 [this](const juce::FileChooser& chooser)
                 {
-                    auto results = chooser.getResults();
-                    for (auto& file : results)
-                        if (file.existsAsFile())
-                            playlistFiles.add(file);
-                    playlistBox.updateContent();
+                    addToPlaylist(chooser.getResults());
                     resized();
                     repaint();
                 });
@@ -906,48 +1391,17 @@ void PlayerGUI::buttonClicked(juce::Button* button)
                                 pendingMixerFile2 = file2;
                                 mixerFileCount++;
                                 
-                                audio.loadFile(pendingMixerFile1);
-                                audio.loadMixerFile(pendingMixerFile2);
-                                
-                                updateMetadata(audio.getTitle(), audio.getArtist(), audio.getAlbum(), audio.getDuration());
-                                updateMixerMetadata(audio.getMixerTitle(), audio.getMixerArtist(), audio.getMixerAlbum(), audio.getMixerDuration());
-                                
-                                double totalLength = audio.getLengthInSeconds();
-                                positionSlider.setRange(0.0, totalLength, 0.001);
-                                totalTimeLabel.setText(formatTime(totalLength), juce::dontSendNotification);
-                                
-                                double mixerLength = audio.getMixerLengthInSeconds();
-                                mixerPositionSlider.setRange(0.0, mixerLength, 0.001);
-                                mixerTotalTimeLabel.setText(formatTime(mixerLength), juce::dontSendNotification);
-                                
-                                waveformDisplay.loadWaveform(pendingMixerFile1);
-                                mixerWaveformDisplay.loadWaveform(pendingMixerFile2);
-                                
-                                mixerVolumeSlider.setVisible(true);
-                                mixerMetadataLabel.setVisible(true);
-                                mixerPositionSlider.setVisible(true);
-                                mixerSpeedSlider.setVisible(true);
-                                mixerSpeedLabel.setVisible(true);
-                                mixerCurrentTimeLabel.setVisible(true);
-                                mixerTotalTimeLabel.setVisible(true);
-                                track2Label.setVisible(true);
-                                mixerWaveformDisplay.setVisible(true);
-                                track1PlayPauseButton.setVisible(true);
-                                track1MuteButton.setVisible(true);
-                                track1ForwardButton.setVisible(true);
-                                track1BackwardButton.setVisible(true);
-                                track2PlayPauseButton.setVisible(true);
-                                track2MuteButton.setVisible(true);
-                                track2ForwardButton.setVisible(true);
-                                track2BackwardButton.setVisible(true);
-
-                                audio.play();
-                                isPlaying = true;
-                                if (pauseIcon) playPauseButton.setImages(pauseIcon.get());
-                                else playPauseButton.setButtonText("Pause");
-                                
-                                resized();
-                                repaint();
+                                juce::Component::SafePointer<PlayerGUI> safeThis(this);
+                                audio.loadFileAsync(PlayerAudio::mainDeckIndex, pendingMixerFile1, [safeThis](bool firstLoaded)
+                                {
+                                    if (safeThis == nullptr || !firstLoaded)
+                                        return;
+                                    safeThis->audio.loadFileAsync(PlayerAudio::mixerDeckIndex, safeThis->pendingMixerFile2, [safeThis](bool secondLoaded)
+                                    {
+                                        if (safeThis != nullptr && secondLoaded)
+                                            safeThis->mixerTracksLoaded();
+                                    });
+                                });
                             }
                         });
                 }
@@ -966,81 +1420,89 @@ void PlayerGUI::buttonClicked(juce::Button* button)
     {
         if (isTrack1Playing)
         {
-            audio.pauseTrack1();
+            mainDeck.stop();
             isTrack1Playing = false;
-            if (playIcon) track1PlayPauseButton.setImages(playIcon.get());
+            if (auto* icon = getIcon("start")) track1PlayPauseButton.setImages(icon);
         }
         else
         {
-            audio.playTrack1();
+            mainDeck.start();
             isTrack1Playing = true;
-            if (pauseIcon) track1PlayPauseButton.setImages(pauseIcon.get());
+            if (auto* icon = getIcon("pause")) track1PlayPauseButton.setImages(icon);
         }
     }
     else if (button == &track1MuteButton)
     {
-        audio.toggleTrack1Mute();
         isTrack1Muted = !isTrack1Muted;
+        mainDeck.setMuted(isTrack1Muted);
+        session.setDeckMuted(PlayerAudio::mainDeckIndex, isTrack1Muted);
         if (isTrack1Muted)
-            safeSetButtonImage(track1MuteButton, unmuteIcon, "Unmute T1");
+            safeSetButtonImage(track1MuteButton, getIcon("unmute"), "Unmute T1");
         else
-            safeSetButtonImage(track1MuteButton, muteIcon, "Mute T1");
+            safeSetButtonImage(track1MuteButton, getIcon("mute"), "Mute T1");
     }
     else if (button == &track1ForwardButton)
     {
-        audio.track1JumpForward(10.0);
+        mainDeck.jump(10.0);
     }
     else if (button == &track1BackwardButton)
     {
-        audio.track1JumpBackward(10.0);
+        mainDeck.jump(-10.0);
     }
     else if (button == &track2PlayPauseButton)
     {
         if (isTrack2Playing)
         {
-            audio.pauseTrack2();
+            mixerDeck.stop();
             isTrack2Playing = false;
-            if (playIcon) track2PlayPauseButton.setImages(playIcon.get());
+            if (auto* icon = getIcon("start")) track2PlayPauseButton.setImages(icon);
         }
         else
         {
-            audio.playTrack2();
+            mixerDeck.start();
             isTrack2Playing = true;
-            if (pauseIcon) track2PlayPauseButton.setImages(pauseIcon.get());
+            if (auto* icon = getIcon("pause")) track2PlayPauseButton.setImages(icon);
         }
     }
     else if (button == &track2MuteButton)
     {
-        audio.toggleTrack2Mute();
         isTrack2Muted = !isTrack2Muted;
+        mixerDeck.setMuted(isTrack2Muted);
+        session.setDeckMuted(PlayerAudio::mixerDeckIndex, isTrack2Muted);
         if (isTrack2Muted)
-            safeSetButtonImage(track2MuteButton, unmuteIcon, "Unmute T2");
+            safeSetButtonImage(track2MuteButton, getIcon("unmute"), "Unmute T2");
         else
-            safeSetButtonImage(track2MuteButton, muteIcon, "Mute T2");
+            safeSetButtonImage(track2MuteButton, getIcon("mute"), "Mute T2");
     }
     else if (button == &track2ForwardButton)
     {
-        audio.track2JumpForward(10.0);
+        mixerDeck.jump(10.0);
     }
     else if (button == &track2BackwardButton)
     {
-        audio.track2JumpBackward(10.0);
+        mixerDeck.jump(-10.0);
     }
 }
 
 void PlayerGUI::sliderValueChanged(juce::Slider* slider)
 {
     if (slider == &volumeSlider)
-        audio.setGain(static_cast<float>(volumeSlider.getValue()));
+    {
+        mainDeck.setGain(static_cast<float>(volumeSlider.getValue()));
+        session.setDeckGain(PlayerAudio::mainDeckIndex, static_cast<float>(volumeSlider.getValue()));
+    }
     else if (slider == &mixerVolumeSlider)
-        audio.setMixerGain(static_cast<float>(mixerVolumeSlider.getValue()));
+    {
+        mixerDeck.setGain(static_cast<float>(mixerVolumeSlider.getValue()));
+        session.setDeckGain(PlayerAudio::mixerDeckIndex, static_cast<float>(mixerVolumeSlider.getValue()));
+    }
     else if (slider == &positionSlider)
     {
         if (isDraggingPosition)
         {
             double target = positionSlider.getValue();
-            audio.setPosition(target);
-            currentTimeLabel.setText(formatTime(audio.transportSource.getCurrentPosition()), juce::dontSendNotification);
+            mainDeck.setPosition(target);
+            currentTimeLabel.setText(formatTime(mainDeck.getPosition()), juce::dontSendNotification);
         }
     }
     else if (slider == &mixerPositionSlider)
@@ -1048,17 +1510,19 @@ void PlayerGUI::sliderValueChanged(juce::Slider* slider)
         if (isDraggingMixerPosition)
         {
             double target = mixerPositionSlider.getValue();
-            audio.setMixerPosition(target);
-            mixerCurrentTimeLabel.setText(formatTime(audio.mixerTransportSource.getCurrentPosition()), juce::dontSendNotification);
+            mixerDeck.setPosition(target);
+            mixerCurrentTimeLabel.setText(formatTime(mixerDeck.getPosition()), juce::dontSendNotification);
         }
     }
     else if (slider == &speedSlider)
     {
-        audio.setSpeed(speedSlider.getValue());
+        mainDeck.setSpeed(speedSlider.getValue());
+        session.setDeckSpeed(PlayerAudio::mainDeckIndex, speedSlider.getValue());
     }
     else if (slider == &mixerSpeedSlider)
     {
-        audio.setMixerSpeed(mixerSpeedSlider.getValue());
+        mixerDeck.setSpeed(mixerSpeedSlider.getValue());
+        session.setDeckSpeed(PlayerAudio::mixerDeckIndex, mixerSpeedSlider.getValue());
     }
 }
 
@@ -1067,7 +1531,7 @@ void PlayerGUI::updateMetadata(const juce::String& title, const juce::String& ar
     juce::String safeTitle = title.isNotEmpty() ? title : "Unknown";
     juce::String safeArtist = artist.isNotEmpty() ? artist : "Unknown";
     juce::String formattedDuration = (duration > 0) ? juce::String((int)(duration / 60)) + ":" + juce::String((int)duration % 60).paddedLeft('0', 2) : "0:00";
-    juce::String info = safeTitle + " - " + safeArtist + " [" + formattedDuration + "]";
+    juce::String info = safeTitle + " - " + safeArtist + (album.isNotEmpty() ? " (" + album + ")" : juce::String()) + " [" + formattedDuration + "]";
     metadataLabel.setText(info, juce::dontSendNotification);
 }
 
@@ -1076,7 +1540,7 @@ void PlayerGUI::updateMixerMetadata(const juce::String& title, const juce::Strin
     juce::String safeTitle = title.isNotEmpty() ? title : "Unknown";
     juce::String safeArtist = artist.isNotEmpty() ? artist : "Unknown";
     juce::String formattedDuration = (duration > 0) ? juce::String((int)(duration / 60)) + ":" + juce::String((int)duration % 60).paddedLeft('0', 2) : "0:00";
-    juce::String info = safeTitle + " - " + safeArtist + " [" + formattedDuration + "]";
+    juce::String info = safeTitle + " - " + safeArtist + (album.isNotEmpty() ? " (" + album + ")" : juce::String()) + " [" + formattedDuration + "]";
     mixerMetadataLabel.setText(info, juce::dontSendNotification);
 }
 
@@ -1086,10 +1550,24 @@ void PlayerGUI::refreshPlaylist()
     playlistBox.repaint();
 }
 
+void PlayerGUI::updateLibraryResults()
+{
+    libraryResults = isShowingLibrary() ? library.search(librarySearch.getText()) : juce::Array<int>();
+    refreshPlaylist();
+}
+
+void PlayerGUI::changeListenerCallback(juce::ChangeBroadcaster* source)
+{
+    if (source == &library && isShowingLibrary())
+        updateLibraryResults();
+}
+
 int PlayerGUI::getNumRows()
 {
+    if (isShowingLibrary())
+        return libraryResults.size();
     if (playlistVisible)
-        return playlistFiles.size();
+        return playlist.size();
     else
         return 0;
 }
@@ -1098,114 +1576,271 @@ void PlayerGUI::paintListBoxItem(int rowNumber, juce::Graphics& g, int width, in
 {
     g.fillAll(rowIsSelected ? juce::Colour::fromString("#FF2E3648") : juce::Colour::fromString("#FF1A1F2B"));
     g.setColour(juce::Colour::fromString("#FFFEE715"));
-    if (rowNumber >= 0 && rowNumber < playlistFiles.size())
-        g.drawText(playlistFiles[rowNumber].getFileNameWithoutExtension(), 4, 0, width - 8, height, juce::Justification::centredLeft);
+    if (isShowingLibrary())
+    {
+        if (rowNumber >= 0 && rowNumber < libraryResults.size())
+        {
+            const auto& track = library.getTrack(libraryResults[rowNumber]);
+            auto name = track.artist.isNotEmpty() ? track.artist + " - " + track.title : track.title;
+            g.drawText(formatDuration(track.duration), width - 64, 0, 60, height, juce::Justification::centredRight);
+            g.drawText(name, 4, 0, width - 72, height, juce::Justification::centredLeft);
+        }
+        return;
+    }
+    if (rowNumber >= 0 && rowNumber < playlist.size())
+    {
+        const auto& entry = playlist.getEntry(rowNumber);
+        g.drawText(entry.durationText, width - 64, 0, 60, height, juce::Justification::centredRight);
+        g.drawText(entry.displayText, 4, 0, width - 72, height, juce::Justification::centredLeft);
+    }
 }
 
 void PlayerGUI::listBoxItemDoubleClicked(int rowNumber, const juce::MouseEvent&)
 {
-    if (rowNumber >= 0 && rowNumber < playlistFiles.size())
+    if (isShowingLibrary())
+    {
+        if (rowNumber >= 0 && rowNumber < libraryResults.size())
+        {
+            auto file = library.getTrack(libraryResults[rowNumber]).getFile();
+            if (file.existsAsFile())
+                loadAndPlay(file);
+        }
+        return;
+    }
+    
+    if (rowNumber >= 0 && rowNumber < playlist.size())
     {
-        auto file = playlistFiles[rowNumber];
+        auto file = playlist.getFile(rowNumber);
         currentPlaylistIndex = rowNumber;
         if (file.existsAsFile())
+            loadAndPlay(file);
+    }
+}
+
+void PlayerGUI::deleteKeyPressed(int lastRowSelected)
+{
+    if (!isShowingLibrary())
+        playlist.remove(lastRowSelected);
+}
+
+void PlayerGUI::addToPlaylist(const juce::Array<juce::File>& files)
+{
+    juce::Array<juce::File> audioFiles;
+    for (auto& file : files)
+    {
+        if (PlaylistModel::isPlaylistFile(file))
         {
-            audio.loadFile(file);
-            updateMetadata(audio.getTitle(), audio.getArtist(), audio.getAlbum(), audio.getDuration());
-            double totalLength = audio.getLengthInSeconds();
-            positionSlider.setRange(0.0, totalLength, 0.001);
-            totalTimeLabel.setText(formatTime(totalLength), juce::dontSendNotification);
-            waveformDisplay.loadWaveform(file);
-            audio.play();
-            isPlaying = true;
-            if (pauseIcon) playPauseButton.setImages(pauseIcon.get()); else playPauseButton.setButtonText("Pause");
+            playlist.insert(-1, audioFiles);
+            audioFiles.clear();
+            auto result = playlist.importFrom(file);
+            if (result.failed())
+                juce::AlertWindow::showMessageBoxAsync(juce::MessageBoxIconType::WarningIcon, "Playlist", result.getErrorMessage());
+        }
+        else if (file.existsAsFile())
+        {
+            audioFiles.add(file);
         }
     }
+    playlist.insert(-1, audioFiles);
 }
 
-void PlayerGUI::saveSession()
+void PlayerGUI::exportPlaylist()
 {
-    juce::File sessionFile = juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
-        .getChildFile("AudioPlayer").getChildFile("session.xml");
+    if (playlist.isEmpty())
+        return;
+    
+    fileChooser = std::make_unique<juce::FileChooser>("Export playlist...", juce::File(), "*.m3u;*.m3u8;*.pls");
+    fileChooser->launchAsync(juce::FileBrowserComponent::saveMode | juce::FileBrowserComponent::warnAboutOverwriting,
+        [this](const juce::FileChooser& chooser)
+        {
+            auto file = chooser.getResult();
+            if (file == juce::File())
+                return;
+            if (!PlaylistModel::isPlaylistFile(file))
+                file = file.withFileExtension("m3u");
+            auto result = playlist.exportTo(file);
+            if (result.failed())
+                juce::AlertWindow::showMessageBoxAsync(juce::MessageBoxIconType::WarningIcon, "Playlist", result.getErrorMessage());
+        });
+}
+
+void PlayerGUI::moveSelectedPlaylistRow(int delta)
+{
+    int row = playlistBox.getSelectedRow();
+    if (isShowingLibrary() || !juce::isPositiveAndBelow(row + delta, playlist.size()))
+        return;
+    playlist.move(row, row + delta);
+    playlistBox.selectRow(row + delta);
+}
+
+void PlayerGUI::playlistRowsInserted(int startRow, int numRows)
+{
+    for (auto* index : { &currentPlaylistIndex, &queuedPlaylistIndex })
+        if (*index >= startRow)
+            *index += numRows;
+    
+    juce::Array<juce::File> files;
+    for (int row = startRow; row < startRow + numRows; ++row)
+        files.add(playlist.getFile(row));
     
-    sessionFile.getParentDirectory().createDirectory();
+    // Measured ahead of time so the tracks start at their normalised level.
+    if (audio.isNormalising())
+        audio.getLoudnessScanner().scan(files);
     
-    juce::XmlElement root("Session");
+    if (!restoringSession)
+    {
+        session.insertPlaylistFiles(startRow, files);
+        session.setPlaylistIndex(currentPlaylistIndex);
+    }
     
-    if (audio.getCurrentFile().existsAsFile())
+    if (!isShowingLibrary())
     {
-        root.setAttribute("lastFile", audio.getCurrentFile().getFullPathName());
-        root.setAttribute("lastPosition", audio.getCurrentPosition());
-        root.setAttribute("volume", volumeSlider.getValue());
-        root.setAttribute("speed", speedSlider.getValue());
+        playlistBox.updateContent();
+        playlistBox.repaint();
     }
+}
+
+void PlayerGUI::playlistRowsRemoved(int startRow, int numRows)
+{
+    for (auto* index : { &currentPlaylistIndex, &queuedPlaylistIndex })
+    {
+        if (*index >= startRow + numRows)
+            *index -= numRows;
+        else if (*index >= startRow)
+            *index = -1;
+    }
+    
+    session.removePlaylistFiles(startRow, numRows);
+    session.setPlaylistIndex(currentPlaylistIndex);
     
-    juce::XmlElement* markersElement = root.createNewChildElement("Markers");
-    for (const auto& marker : markers)
+    if (!isShowingLibrary())
+    {
+        playlistBox.updateContent();
+        playlistBox.repaint();
+    }
+}
+
+void PlayerGUI::playlistRowMoved(int fromRow, int toRow)
+{
+    for (auto* index : { &currentPlaylistIndex, &queuedPlaylistIndex })
     {
-        juce::XmlElement* markerElement = markersElement->createNewChildElement("Marker");
-        markerElement->setAttribute("timestamp", marker.timestamp);
-        markerElement->setAttribute("label", marker.label);
+        if (*index == fromRow)
+            *index = toRow;
+        else if (fromRow < toRow && *index > fromRow && *index <= toRow)
+            --*index;
+        else if (fromRow > toRow && *index >= toRow && *index < fromRow)
+            ++*index;
     }
     
-    root.writeTo(sessionFile);
+    session.movePlaylistFile(fromRow, toRow);
+    session.setPlaylistIndex(currentPlaylistIndex);
+    
+    if (!isShowingLibrary())
+        for (int row = juce::jmin(fromRow, toRow); row <= juce::jmax(fromRow, toRow); ++row)
+            playlistBox.repaintRow(row);
+}
+
+void PlayerGUI::playlistRowChanged(int row)
+{
+    if (!isShowingLibrary())
+        playlistBox.repaintRow(row);
+}
+
+void PlayerGUI::saveSession()
+{
+    journalPositions();
+    session.compact();
+}
+
+void PlayerGUI::journalPositions()
+{
+    for (int i : { PlayerAudio::mainDeckIndex, PlayerAudio::mixerDeckIndex })
+        if (audio.getDeck(i).hasTrack())
+            session.setDeckPosition(i, audio.getDeck(i).getPosition());
+    
+    session.commitPending();
 }
 
 void PlayerGUI::loadSession()
 {
-    juce::File sessionFile = juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
-        .getChildFile("AudioPlayer").getChildFile("session.xml");
+    // The session is already in memory, so the controls are restored at once
+    // and only the audio is loaded in the background.
+    auto& state = session.getState();
+    const juce::ScopedValueSetter<bool> restoring(restoringSession, true);
     
-    if (!sessionFile.existsAsFile())
-        return;
+    markers = state.markers;
+    waveformDisplay.setMarkers(markers);
     
-    std::unique_ptr<juce::XmlElement> root = juce::parseXML(sessionFile);
-    if (!root || root->getTagName() != "Session")
+    if (!state.playlist.isEmpty())
+    {
+        playlist.insert(0, state.playlist);
+        currentPlaylistIndex = juce::jlimit(-1, playlist.size() - 1, state.playlistIndex);
+    }
+    
+    auto& main = state.decks[PlayerAudio::mainDeckIndex];
+    volumeSlider.setValue(main.gain, juce::dontSendNotification);
+    speedSlider.setValue(main.speed, juce::dontSendNotification);
+    mainDeck.setGain(main.gain);
+    mainDeck.setSpeed(main.speed);
+    isTrack1Muted = main.muted;
+    mainDeck.setMuted(isTrack1Muted);
+    if (isTrack1Muted)
+        safeSetButtonImage(track1MuteButton, getIcon("unmute"), "Unmute T1");
+    
+    if (!main.file.existsAsFile())
         return;
     
-    juce::String lastFilePath = root->getStringAttribute("lastFile");
-    if (lastFilePath.isNotEmpty())
+    juce::Component::SafePointer<PlayerGUI> safeThis(this);
+    audio.loadFileAsync(PlayerAudio::mainDeckIndex, main.file, [safeThis](bool loaded)
     {
-        juce::File lastFile(lastFilePath);
-        if (lastFile.existsAsFile())
+        if (safeThis == nullptr || !loaded)
+            return;
+        
+        auto& gui = *safeThis;
+        auto& restored = gui.session.getState();
+        double position = restored.decks[PlayerAudio::mainDeckIndex].position;
+        gui.mainDeck.setPosition(position);
+        gui.positionSlider.setValue(position, juce::dontSendNotification);
+        
+        auto& mixer = restored.decks[PlayerAudio::mixerDeckIndex];
+        if (!mixer.file.existsAsFile())
         {
-            audio.loadFile(lastFile);
-            updateMetadata(audio.getTitle(), audio.getArtist(), audio.getAlbum(), audio.getDuration());
-            double totalLength = audio.getLengthInSeconds();
-            positionSlider.setRange(0.0, totalLength, 0.001);
-            totalTimeLabel.setText(formatTime(totalLength), juce::dontSendNotification);
-            waveformDisplay.loadWaveform(lastFile);
-            
-            double lastPosition = root->getDoubleAttribute("lastPosition", 0.0);
-            audio.setPosition(lastPosition);
-            positionSlider.setValue(lastPosition, juce::dontSendNotification);
-            
-            volumeSlider.setValue(root->getDoubleAttribute("volume", 0.8), juce::dontSendNotification);
-            speedSlider.setValue(root->getDoubleAttribute("speed", 1.0), juce::dontSendNotification);
+            gui.showCurrentTrack();
+            return;
         }
-    }
-    
-    markers.clear();
-    juce::XmlElement* markersElement = root->getChildByName("Markers");
-    if (markersElement)
-    {
-        for (auto* markerElement : markersElement->getChildIterator())
+        
+        gui.pendingMixerFile1 = gui.mainDeck.getFile();
+        gui.pendingMixerFile2 = mixer.file;
+        gui.audio.loadFileAsync(PlayerAudio::mixerDeckIndex, mixer.file, [safeThis](bool mixerLoaded)
         {
-            if (markerElement->getTagName() == "Marker")
+            if (safeThis == nullptr)
+                return;
+            
+            auto& gui = *safeThis;
+            if (!mixerLoaded)
             {
-                Marker marker;
-                marker.timestamp = markerElement->getDoubleAttribute("timestamp");
-                marker.label = markerElement->getStringAttribute("label");
-                markers.add(marker);
+                gui.showCurrentTrack();
+                return;
             }
-        }
-    }
-    waveformDisplay.setMarkers(markers);
+            
+            auto& deckState = gui.session.getState().decks[PlayerAudio::mixerDeckIndex];
+            gui.mixerVolumeSlider.setValue(deckState.gain, juce::dontSendNotification);
+            gui.mixerSpeedSlider.setValue(deckState.speed, juce::dontSendNotification);
+            gui.mixerDeck.setGain(deckState.gain);
+            gui.mixerDeck.setSpeed(deckState.speed);
+            gui.mixerDeck.setPosition(deckState.position);
+            gui.isTrack2Muted = deckState.muted;
+            gui.mixerDeck.setMuted(gui.isTrack2Muted);
+            if (gui.isTrack2Muted)
+                gui.safeSetButtonImage(gui.track2MuteButton, gui.getIcon("unmute"), "Unmute T2");
+            gui.mixerTracksLoaded(false);
+        });
+    });
 }
 
 void PlayerGUI::addMarker()
 {
-    double currentTime = audio.getCurrentPosition();
+    double currentTime = mainDeck.getPosition();
     int markerNumber = markers.size() + 1;
     
     Marker marker;
@@ -1213,6 +1848,7 @@ void PlayerGUI::addMarker()
     marker.label = "Marker " + juce::String(markerNumber) + " (" + formatTime(currentTime) + ")";
     
     markers.add(marker);
+    session.addMarker(marker);
     
     waveformDisplay.setMarkers(markers);
     juce::AlertWindow::showMessageBoxAsync(juce::AlertWindow::InfoIcon, "Marker Added", 
@@ -1234,7 +1870,7 @@ void PlayerGUI::showMarkersDialog()
                 auto* btn = new juce::TextButton(markers[i].label);
                 btn->onClick = [this, i]()
                 {
-                    audio.setPosition(markers[i].timestamp);
+                    gui.mainDeck.setPosition(markers[i].timestamp);
                     if (!audio.isPlaying())
                         audio.play();
                 };
@@ -1246,6 +1882,7 @@ void PlayerGUI::showMarkersDialog()
                 delBtn->onClick = [this, i]()
                 {
                     markers.remove(i);
+                    gui.session.removeMarker(i);
                     if (auto* parent = getParentComponent())
                         parent->exitModalState(0);
                     gui.waveformDisplay.setMarkers(markers);
@@ -1332,18 +1969,31 @@ bool PlayerGUI::keyPressed(const juce::KeyPress& key)
         {
             audio.pause();
             isPlaying = false;
-            if (playIcon) playPauseButton.setImages(playIcon.get()); 
-            else playPauseButton.setButtonText("Play");
+            safeSetButtonImage(playPauseButton, getIcon("start"), "Play");
         }
         else
         {
             audio.play();
             isPlaying = true;
-            if (pauseIcon) playPauseButton.setImages(pauseIcon.get()); 
-            else playPauseButton.setButtonText("Pause");
+            safeSetButtonImage(playPauseButton, getIcon("pause"), "Pause");
         }
         return true;
     }
+    else if (key == juce::KeyPress(juce::KeyPress::upKey, juce::ModifierKeys::commandModifier, 0))
+    {
+        moveSelectedPlaylistRow(-1);
+        return true;
+    }
+    else if (key == juce::KeyPress(juce::KeyPress::downKey, juce::ModifierKeys::commandModifier, 0))
+    {
+        moveSelectedPlaylistRow(1);
+        return true;
+    }
+    else if (key.getTextCharacter() == 'e' || key.getTextCharacter() == 'E')
+    {
+        exportPlaylist();
+        return true;
+    }
     else if (key == juce::KeyPress::leftKey)
     {
         audio.jumpBackward(5.0);
@@ -1358,23 +2008,23 @@ bool PlayerGUI::keyPressed(const juce::KeyPress& key)
     {
         float newVolume = juce::jmin(1.0f, (float)volumeSlider.getValue() + 0.05f);
         volumeSlider.setValue(newVolume);
-        audio.setGain(newVolume);
+        mainDeck.setGain(newVolume);
         return true;
     }
     else if (key == juce::KeyPress::downKey)
     {
         float newVolume = juce::jmax(0.0f, (float)volumeSlider.getValue() - 0.05f);
         volumeSlider.setValue(newVolume);
-        audio.setGain(newVolume);
+        mainDeck.setGain(newVolume);
         return true;
     }
     else if (key.getTextCharacter() == 'm' || key.getTextCharacter() == 'M')
     {
         audio.toggleMute();
-        if (audio.isMuted)
-            safeSetButtonImage(muteButton, unmuteIcon, "Unmute");
+        if (audio.isMuted())
+            safeSetButtonImage(muteButton, getIcon("unmute"), "Unmute");
         else
-            safeSetButtonImage(muteButton, muteIcon, "Mute");
+            safeSetButtonImage(muteButton, getIcon("mute"), "Mute");
         return true;
     }
     else if (key.getTextCharacter() == 'l' || key.getTextCharacter() == 'L')
@@ -1386,38 +2036,170 @@ bool PlayerGUI::keyPressed(const juce::KeyPress& key)
     }
     else if (key.getTextCharacter() == 'r' || key.getTextCharacter() == 'R')
     {
-        audio.setPosition(0.0);
+        mainDeck.setPosition(0.0);
         positionSlider.setValue(0.0, juce::dontSendNotification);
         currentTimeLabel.setText("0:00", juce::dontSendNotification);
         return true;
     }
+    else if (key.getTextCharacter() == 'p' || key.getTextCharacter() == 'P')
+    {
+        perfOverlay.setVisible(!perfOverlay.isVisible());
+        if (perfOverlay.isVisible())
+            perfOverlay.toFront(false);
+        return true;
+    }
     
     return false;
 }
 
 void PlayerGUI::playNextInPlaylist()
 {
-    if (playlistFiles.isEmpty())
+    if (playlist.isEmpty())
         return;
     
     currentPlaylistIndex++;
-    if (currentPlaylistIndex >= playlistFiles.size())
+    if (currentPlaylistIndex >= playlist.size())
         currentPlaylistIndex = 0;
     
-    auto file = playlistFiles[currentPlaylistIndex];
+    auto file = playlist.getFile(currentPlaylistIndex);
     if (file.existsAsFile())
     {
-        audio.loadFile(file);
-        updateMetadata(audio.getTitle(), audio.getArtist(), audio.getAlbum(), audio.getDuration());
-        double totalLength = audio.getLengthInSeconds();
-        positionSlider.setRange(0.0, totalLength, 0.001);
-        totalTimeLabel.setText(formatTime(totalLength), juce::dontSendNotification);
-        waveformDisplay.loadWaveform(file);
+        loadAndPlay(file);
+        playlistBox.selectRow(currentPlaylistIndex);
+    }
+}
+
+void PlayerGUI::loadAndPlay(const juce::File& file)
+{
+    juce::Component::SafePointer<PlayerGUI> safeThis(this);
+    audio.loadFileAsync(PlayerAudio::mainDeckIndex, file, [safeThis](bool loaded)
+    {
+        if (safeThis == nullptr)
+            return;
+        if (loaded)
+            safeThis->trackLoaded();
+    });
+}
+
+void PlayerGUI::trackLoaded()
+{
+    showCurrentTrack();
+    audio.play();
+    isPlaying = true;
+    safeSetButtonImage(playPauseButton, getIcon("pause"), "Pause");
+}
+
+void PlayerGUI::showCurrentTrack()
+{
+    updateMetadata(mainDeck.getTitle(), mainDeck.getArtist(), mainDeck.getAlbum(), mainDeck.getDuration());
+    double totalLength = mainDeck.getLengthInSeconds();
+    positionSlider.setRange(0.0, totalLength, 0.001);
+    totalTimeLabel.setText(formatTime(totalLength), juce::dontSendNotification);
+    waveformDisplay.loadWaveform(mainDeck.getFile());
+    mainTempo = tempoAnalyser->getTempo(mainDeck.getFile(), audio.getFormatManager());
+    playlist.setMetadata(mainDeck.getFile(), mainDeck.getTitle(), mainDeck.getArtist(), mainDeck.getDuration());
+    session.setDeckFile(PlayerAudio::mainDeckIndex, mainDeck.getFile());
+    session.setPlaylistIndex(currentPlaylistIndex);
+}
+
+void PlayerGUI::updateTempoDisplay()
+{
+    auto describe = [](const juce::String& name, const std::shared_ptr<TempoEstimate>& tempo)
+    {
+        auto info = tempo != nullptr ? tempo->getInfo() : TempoInfo();
+        return info.isValid() ? name + "  " + juce::String(info.bpm, 1) + " BPM" : name;
+    };
+    
+    auto track1Text = describe("TRACK 1", mainTempo);
+    if (track1Label.getText() != track1Text)
+        track1Label.setText(track1Text, juce::dontSendNotification);
+    
+    auto track2Text = describe("TRACK 2", mixerTempo);
+    if (track2Label.getText() != track2Text)
+        track2Label.setText(track2Text, juce::dontSendNotification);
+    
+    bool canSync = mainTempo != nullptr && mainTempo->getInfo().isValid()
+                && mixerTempo != nullptr && mixerTempo->getInfo().isValid();
+    if (syncButton.isEnabled() != canSync)
+        syncButton.setEnabled(canSync);
+}
+
+void PlayerGUI::syncMixerTempo()
+{
+    if (mainTempo == nullptr || mixerTempo == nullptr)
+        return;
+    
+    auto leader = mainTempo->getInfo();
+    auto follower = mixerTempo->getInfo();
+    if (!leader.isValid() || !follower.isValid())
+        return;
+    
+    // Goes through the slider so the deck and the session see the new speed.
+    mixerSpeedSlider.setValue(TempoEstimate::getSyncSpeed(leader.bpm * mainDeck.getSpeed(), follower.bpm));
+}
+
+void PlayerGUI::queueNextInPlaylist()
+{
+    if (playlist.isEmpty() || mainDeck.getFile() == juce::File())
+        return;
+    
+    int nextIndex = (currentPlaylistIndex + 1) % playlist.size();
+    auto file = playlist.getFile(nextIndex);
+    if (file.existsAsFile() && mainDeck.getQueuedFile() != file)
+    {
+        queuedPlaylistIndex = nextIndex;
+        audio.queueNextFile(PlayerAudio::mainDeckIndex, file);
+    }
+}
+
+void PlayerGUI::mixerTracksLoaded(bool startPlaying)
+{
+    session.setDeckFile(PlayerAudio::mainDeckIndex, pendingMixerFile1);
+    session.setDeckFile(PlayerAudio::mixerDeckIndex, pendingMixerFile2);
+    
+    updateMetadata(mainDeck.getTitle(), mainDeck.getArtist(), mainDeck.getAlbum(), mainDeck.getDuration());
+    updateMixerMetadata(mixerDeck.getTitle(), mixerDeck.getArtist(), mixerDeck.getAlbum(), mixerDeck.getDuration());
+    
+    double totalLength = mainDeck.getLengthInSeconds();
+    positionSlider.setRange(0.0, totalLength, 0.001);
+    totalTimeLabel.setText(formatTime(totalLength), juce::dontSendNotification);
+    
+    double mixerLength = mixerDeck.getLengthInSeconds();
+    mixerPositionSlider.setRange(0.0, mixerLength, 0.001);
+    mixerTotalTimeLabel.setText(formatTime(mixerLength), juce::dontSendNotification);
+    
+    waveformDisplay.loadWaveform(pendingMixerFile1);
+    mixerWaveformDisplay.loadWaveform(pendingMixerFile2);
+    mainTempo = tempoAnalyser->getTempo(pendingMixerFile1, audio.getFormatManager());
+    mixerTempo = tempoAnalyser->getTempo(pendingMixerFile2, audio.getFormatManager());
+    
+    mixerVolumeSlider.setVisible(true);
+    mixerMetadataLabel.setVisible(true);
+    mixerPositionSlider.setVisible(true);
+    mixerSpeedSlider.setVisible(true);
+    mixerSpeedLabel.setVisible(true);
+    mixerStretchBox.setVisible(true);
+    syncButton.setVisible(true);
+    mixerCurrentTimeLabel.setVisible(true);
+    mixerTotalTimeLabel.setVisible(true);
+    track2Label.setVisible(true);
+    mixerWaveformDisplay.setVisible(true);
+    track1PlayPauseButton.setVisible(true);
+    track1MuteButton.setVisible(true);
+    track1ForwardButton.setVisible(true);
+    track1BackwardButton.setVisible(true);
+    track2PlayPauseButton.setVisible(true);
+    track2MuteButton.setVisible(true);
+    track2ForwardButton.setVisible(true);
+    track2BackwardButton.setVisible(true);
+
+    if (startPlaying)
+    {
         audio.play();
         isPlaying = true;
-        if (pauseIcon) playPauseButton.setImages(pauseIcon.get());
-        else playPauseButton.setButtonText("Pause");
-        
-        playlistBox.selectRow(currentPlaylistIndex);
+        safeSetButtonImage(playPauseButton, getIcon("pause"), "Pause");
     }
+    
+    resized();
+    repaint();
 }
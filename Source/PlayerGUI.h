@@ -1,37 +1,73 @@
 #pragma once
 #include <JuceHeader.h>
 #include "PlayerAudio.h"
+#include "PeakCache.h"
+#include "PerfMonitor.h"
+#include "Library.h"
+#include "Playlist.h"
+#include "SessionStore.h"
+#include "TempoAnalyser.h"
 
-struct Marker
-{
-    double timestamp;
-    juce::String label;
-};
-
-class WaveformDisplay : public juce::Component, public juce::Timer, public juce::ChangeListener
+// Draws the visible range of the peaks once into a cached image and on each
+// display refresh only invalidates the strips the playhead leaves and enters.
+// The wheel zooms around the mouse, shift-wheel or dragging pans, and a
+// double-click shows the whole file again.
+class WaveformDisplay : public juce::Component
 {
 public:
     WaveformDisplay(PlayerAudio& audioRef);
-    ~WaveformDisplay() override;
     
     void paint(juce::Graphics& g) override;
+    void resized() override;
     void loadWaveform(const juce::File& audioFile);
     void setCurrentPosition(double position);
+    void setPositionSource(std::function<double()> source) { positionSource = std::move(source); }
     void setABMarkers(bool enabled, double startPos, double endPos);
-    void timerCallback() override;
-    void changeListenerCallback(juce::ChangeBroadcaster* source) override;
     void setMarkers(const juce::Array<Marker>& markersToShow);
     
+    juce::Range<juce::int64> getVisibleRange() const;
+    void setVisibleRange(juce::int64 start, juce::int64 length);
+    
+    void mouseWheelMove(const juce::MouseEvent& e, const juce::MouseWheelDetails& wheel) override;
+    void mouseMagnify(const juce::MouseEvent& e, float scaleFactor) override;
+    void mouseDown(const juce::MouseEvent& e) override;
+    void mouseDrag(const juce::MouseEvent& e) override;
+    void mouseDoubleClick(const juce::MouseEvent& e) override;
+    
 private:
+    juce::int64 getTotalSamples() const;
+    void zoomAround(float x, double factor);
+    void drawPeaks(juce::Graphics& g, juce::Rectangle<int> area);
+    void drawDetail(juce::Graphics& g, juce::Rectangle<int> area, juce::Range<juce::int64> visible);
+    void onVBlank();
+    void renderWaveformImage();
+    float timeToX(double seconds) const;
+    void repaintPlayhead(float x);
+    
     PlayerAudio& audio;
-    juce::AudioThumbnailCache thumbnailCache{5};
-    juce::AudioThumbnail thumbnail{512, audio.getFormatManager(), thumbnailCache};
+    juce::SharedResourcePointer<PeakCache> peakCache;
+    std::shared_ptr<PeakPyramid> peaks;
     bool fileLoaded = false;
     double currentPosition = 0.0;
     bool abMarkersEnabled = false;
     double abStart = 0.0;
     double abEnd = 0.0;
     juce::Array<Marker> displayMarkers;
+    
+    std::function<double()> positionSource;
+    juce::Image waveformImage;
+    bool imageNeedsRender = true;
+    bool imageComplete = false;
+    double lastRenderMs = 0.0;
+    float playheadX = -1.0f;
+    
+    juce::int64 viewStart = 0;
+    juce::int64 viewLength = 0;
+    juce::int64 dragStartView = 0;
+    juce::File file;
+    std::shared_ptr<PeakDetail> detail;
+    bool detailPending = false;
+    juce::VBlankAttachment vblank { this, [this] { onVBlank(); } };
 };
 
 class ABLoopDialog : public juce::Component
@@ -58,10 +94,46 @@ public:
     juce::Label colonLabel2;
 };
 
+class PerfOverlay : public juce::Component, public juce::Timer
+{
+public:
+    PerfOverlay(PlayerAudio& audioRef);
+    
+    void paint(juce::Graphics& g) override;
+    void timerCallback() override;
+    void visibilityChanged() override;
+    void mouseDoubleClick(const juce::MouseEvent&) override;
+    
+private:
+    PlayerAudio& audio;
+    PerfSnapshot snapshot;
+};
+
+// A peak bar over an RMS bar on a -60..+6 dB scale, with true-peak and
+// momentary/short-term loudness as text. Polls its source on each display
+// refresh and repaints only when the reading has changed.
+class LevelMeterDisplay : public juce::Component
+{
+public:
+    LevelMeterDisplay(const juce::String& name, std::function<MeterReading()> source);
+    
+    void paint(juce::Graphics& g) override;
+    
+private:
+    void onVBlank();
+    
+    juce::String label;
+    std::function<MeterReading()> readingSource;
+    MeterReading reading;
+    juce::VBlankAttachment vblank { this, [this] { onVBlank(); } };
+};
+
 class PlayerGUI : public juce::Component,
                   public juce::Button::Listener,
                   public juce::Slider::Listener,
                   public juce::ListBoxModel,
+                  public juce::ChangeListener,
+                  public PlaylistModel::Listener,
                   public juce::Timer
 {
 public:
@@ -83,16 +155,30 @@ public:
     void showMarkersDialog();
     bool keyPressed(const juce::KeyPress& key) override;
     void playNextInPlaylist();
+    void loadAndPlay(const juce::File& file);
     
     int getNumRows() override;
     void paintListBoxItem(int rowNumber, juce::Graphics& g, int width, int height, bool rowIsSelected) override;
     void listBoxItemDoubleClicked(int rowNumber, const juce::MouseEvent&) override;
+    void deleteKeyPressed(int lastRowSelected) override;
+    void changeListenerCallback(juce::ChangeBroadcaster* source) override;
+    void playlistRowsInserted(int startRow, int numRows) override;
+    void playlistRowsRemoved(int startRow, int numRows) override;
+    void playlistRowMoved(int fromRow, int toRow) override;
+    void playlistRowChanged(int row) override;
     
     WaveformDisplay waveformDisplay;
     WaveformDisplay mixerWaveformDisplay;
 
 private:
     PlayerAudio& audio;
+    Deck& mainDeck;
+    Deck& mixerDeck;
+    PerfOverlay perfOverlay;
+    std::unique_ptr<PerfLog> perfLog;
+    LevelMeterDisplay mainMeter;
+    LevelMeterDisplay mixerMeter;
+    LevelMeterDisplay masterMeter;
     
     juce::DrawableButton loadButton{"load", juce::DrawableButton::ImageFitted};
     juce::DrawableButton restartButton{"restart", juce::DrawableButton::ImageFitted};
@@ -124,6 +210,10 @@ private:
     juce::Slider mixerPositionSlider;
     juce::Slider speedSlider;
     juce::Slider mixerSpeedSlider;
+    juce::ComboBox stretchBox;
+    juce::ComboBox mixerStretchBox;
+    juce::TextButton syncButton;
+    juce::TextButton memoryButton;
     
     juce::Label metadataLabel;
     juce::Label mixerMetadataLabel;
@@ -141,14 +231,26 @@ private:
     juce::Label track2Label;
     
     juce::ListBox playlistBox;
-    juce::Array<juce::File> playlistFiles;
+    PlaylistModel playlist;
     bool playlistVisible = false;
     int currentPlaylistIndex = -1;
+    int queuedPlaylistIndex = -1;
+    
+    Library library;
+    juce::TextEditor librarySearch;
+    juce::TextButton libraryScanButton;
+    juce::Array<int> libraryResults;
+    
+    juce::SharedResourcePointer<TempoAnalyser> tempoAnalyser;
+    std::shared_ptr<TempoEstimate> mainTempo;
+    std::shared_ptr<TempoEstimate> mixerTempo;
+    
+    SessionStore session;
+    bool restoringSession = false;
+    int sessionTicks = 0;
     
-    std::unique_ptr<juce::Drawable> loadIcon, restartIcon, stopIcon,
-        playIcon, pauseIcon, startIcon, endIcon, loopIcon, muteIcon,
-        unmuteIcon, backwardIcon, forwardIcon, playlistIcon, mixerIcon,
-        abLoopIcon, saveIcon, markerIcon;
+    // Parsed from BinaryData the first time each icon is asked for.
+    std::map<juce::String, std::unique_ptr<juce::Drawable>> icons;
     
     std::unique_ptr<juce::FileChooser> fileChooser;
     std::unique_ptr<ABLoopDialog> abDialog;
@@ -169,9 +271,21 @@ private:
     juce::Array<Marker> markers;
     std::unique_ptr<juce::Component> markersDialog;
     
-    juce::File getSVGFile(const juce::String& name);
-    void safeSetButtonImage(juce::DrawableButton& btn, std::unique_ptr<juce::Drawable>& drawable, const juce::String& fallbackText);
+    const juce::Drawable* getIcon(const juce::String& name);
+    void safeSetButtonImage(juce::DrawableButton& btn, const juce::Drawable* drawable, const juce::String& fallbackText);
     juce::String formatTime(double seconds);
+    void trackLoaded();
+    void showCurrentTrack();
+    void queueNextInPlaylist();
+    void mixerTracksLoaded(bool startPlaying = true);
+    void journalPositions();
+    void updateTempoDisplay();
+    void syncMixerTempo();
+    bool isShowingLibrary() const { return playlistVisible && librarySearch.getText().isNotEmpty(); }
+    void updateLibraryResults();
+    void addToPlaylist(const juce::Array<juce::File>& files);
+    void exportPlaylist();
+    void moveSelectedPlaylistRow(int delta);
     
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PlayerGUI)
 };
@@ -0,0 +1,259 @@
+#include "Playlist.h"
+
+void PlaylistEntry::updateDisplayText()
+{
+    if (title.isEmpty())
+        displayText = file.getFileNameWithoutExtension();
+    else
+        displayText = artist.isNotEmpty() ? artist + " - " + title : title;
+
+    if (duration >= 0.0)
+    {
+        int totalSecs = (int)duration;
+        durationText = juce::String(totalSecs / 60) + ":" + juce::String(totalSecs % 60).paddedLeft('0', 2);
+    }
+    else
+    {
+        durationText.clear();
+    }
+}
+
+int PlaylistModel::indexOf(const juce::File& file) const
+{
+    for (size_t i = 0; i < entries.size(); ++i)
+        if (entries[i].file == file)
+            return (int)i;
+    return -1;
+}
+
+PlaylistEntry PlaylistModel::makeEntry(const juce::File& file) const
+{
+    PlaylistEntry entry;
+    entry.file = file;
+    if (metadataLookup)
+        metadataLookup(file, entry);
+    entry.updateDisplayText();
+    return entry;
+}
+
+void PlaylistModel::insert(int row, const juce::Array<juce::File>& files)
+{
+    std::vector<PlaylistEntry> newEntries;
+    newEntries.reserve((size_t)files.size());
+    for (auto& file : files)
+        newEntries.push_back(makeEntry(file));
+    insertEntries(row, std::move(newEntries));
+}
+
+void PlaylistModel::insertEntries(int row, std::vector<PlaylistEntry> newEntries)
+{
+    if (newEntries.empty())
+        return;
+
+    if (!juce::isPositiveAndNotGreaterThan(row, size()))
+        row = size();
+
+    int numRows = (int)newEntries.size();
+    entries.insert(entries.begin() + row, std::make_move_iterator(newEntries.begin()), std::make_move_iterator(newEntries.end()));
+    listeners.call([row, numRows](Listener& l) { l.playlistRowsInserted(row, numRows); });
+}
+
+void PlaylistModel::remove(int row, int numRows)
+{
+    if (!juce::isPositiveAndBelow(row, size()))
+        return;
+
+    numRows = juce::jmin(numRows, size() - row);
+    if (numRows <= 0)
+        return;
+
+    entries.erase(entries.begin() + row, entries.begin() + row + numRows);
+    listeners.call([row, numRows](Listener& l) { l.playlistRowsRemoved(row, numRows); });
+}
+
+void PlaylistModel::move(int fromRow, int toRow)
+{
+    if (!juce::isPositiveAndBelow(fromRow, size()) || !juce::isPositiveAndBelow(toRow, size()) || fromRow == toRow)
+        return;
+
+    if (fromRow < toRow)
+        std::rotate(entries.begin() + fromRow, entries.begin() + fromRow + 1, entries.begin() + toRow + 1);
+    else
+        std::rotate(entries.begin() + toRow, entries.begin() + fromRow, entries.begin() + fromRow + 1);
+    listeners.call([fromRow, toRow](Listener& l) { l.playlistRowMoved(fromRow, toRow); });
+}
+
+void PlaylistModel::clear()
+{
+    remove(0, size());
+}
+
+void PlaylistModel::setMetadata(const juce::File& file, const juce::String& title, const juce::String& artist, double duration)
+{
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        auto& entry = entries[i];
+        if (entry.file != file || (entry.title == title && entry.artist == artist && entry.duration == duration))
+            continue;
+
+        entry.title = title;
+        entry.artist = artist;
+        entry.duration = duration;
+        entry.updateDisplayText();
+        auto row = (int)i;
+        listeners.call([row](Listener& l) { l.playlistRowChanged(row); });
+    }
+}
+
+bool PlaylistModel::isPlaylistFile(const juce::File& file)
+{
+    return file.hasFileExtension("m3u;m3u8;pls");
+}
+
+juce::File PlaylistModel::resolvePath(const juce::File& playlistDirectory, juce::String path)
+{
+    path = path.trim();
+    if (path.startsWithIgnoreCase("file://"))
+        path = juce::URL::removeEscapeChars(path.substring(7));
+
+   #if !JUCE_WINDOWS
+    path = path.replaceCharacter('\\', '/');
+   #endif
+
+    return juce::File::isAbsolutePath(path) ? juce::File(path) : playlistDirectory.getChildFile(path);
+}
+
+void PlaylistModel::readM3U(juce::InputStream& in, const juce::File& directory, std::vector<PlaylistEntry>& result) const
+{
+    double duration = -1.0;
+    juce::String info;
+
+    while (!in.isExhausted())
+    {
+        auto line = in.readNextLine().trim();
+        if (line.isEmpty())
+            continue;
+
+        if (line.startsWith("#EXTINF:"))
+        {
+            auto fields = line.substring(8);
+            duration = fields.upToFirstOccurrenceOf(",", false, false).getDoubleValue();
+            info = fields.fromFirstOccurrenceOf(",", false, false).trim();
+            continue;
+        }
+        if (line.startsWithChar('#'))
+            continue;
+
+        auto entry = makeEntry(resolvePath(directory, line));
+        if (entry.title.isEmpty() && info.isNotEmpty())
+        {
+            entry.artist = info.upToFirstOccurrenceOf(" - ", false, false);
+            entry.title = info.fromFirstOccurrenceOf(" - ", false, false);
+            if (entry.title.isEmpty())
+                std::swap(entry.title, entry.artist);
+            entry.duration = duration > 0.0 ? duration : -1.0;
+            entry.updateDisplayText();
+        }
+        result.push_back(std::move(entry));
+        duration = -1.0;
+        info.clear();
+    }
+}
+
+void PlaylistModel::readPLS(juce::InputStream& in, const juce::File& directory, std::vector<PlaylistEntry>& result) const
+{
+    // Entries are numbered and their keys may come in any order.
+    std::map<int, std::pair<juce::String, double>> info;
+    std::map<int, juce::String> paths;
+
+    while (!in.isExhausted())
+    {
+        auto line = in.readNextLine().trim();
+        auto key = line.upToFirstOccurrenceOf("=", false, false).trim();
+        auto value = line.fromFirstOccurrenceOf("=", false, false).trim();
+        int number = key.retainCharacters("0123456789").getIntValue();
+
+        if (key.startsWithIgnoreCase("File"))
+            paths[number] = value;
+        else if (key.startsWithIgnoreCase("Title"))
+            info[number].first = value;
+        else if (key.startsWithIgnoreCase("Length"))
+            info[number].second = value.getDoubleValue();
+    }
+
+    for (auto& path : paths)
+    {
+        auto entry = makeEntry(resolvePath(directory, path.second));
+        auto found = info.find(path.first);
+        if (entry.title.isEmpty() && found != info.end())
+        {
+            entry.title = found->second.first;
+            entry.duration = found->second.second > 0.0 ? found->second.second : -1.0;
+            entry.updateDisplayText();
+        }
+        result.push_back(std::move(entry));
+    }
+}
+
+juce::Result PlaylistModel::importFrom(const juce::File& playlistFile, int row)
+{
+    juce::FileInputStream in(playlistFile);
+    if (!in.openedOk())
+        return juce::Result::fail("Cannot open " + playlistFile.getFullPathName());
+
+    std::vector<PlaylistEntry> imported;
+    if (playlistFile.hasFileExtension("pls"))
+        readPLS(in, playlistFile.getParentDirectory(), imported);
+    else
+        readM3U(in, playlistFile.getParentDirectory(), imported);
+
+    insertEntries(row, std::move(imported));
+    return juce::Result::ok();
+}
+
+juce::Result PlaylistModel::exportTo(const juce::File& playlistFile) const
+{
+    auto directory = playlistFile.getParentDirectory();
+    auto getPath = [&directory](const juce::File& file)
+    {
+        return file.isAChildOf(directory) ? file.getRelativePathFrom(directory) : file.getFullPathName();
+    };
+
+    juce::TemporaryFile temp(playlistFile);
+    {
+        juce::FileOutputStream out(temp.getFile());
+        if (!out.openedOk())
+            return juce::Result::fail("Cannot write " + playlistFile.getFullPathName());
+
+        if (playlistFile.hasFileExtension("pls"))
+        {
+            out << "[playlist]\n";
+            for (size_t i = 0; i < entries.size(); ++i)
+            {
+                auto& entry = entries[i];
+                juce::String number((int)i + 1);
+                out << "File" << number << "=" << getPath(entry.file) << "\n"
+                    << "Title" << number << "=" << entry.displayText << "\n"
+                    << "Length" << number << "=" << (entry.duration >= 0.0 ? (int)entry.duration : -1) << "\n";
+            }
+            out << "NumberOfEntries=" << (int)entries.size() << "\nVersion=2\n";
+        }
+        else
+        {
+            out << "#EXTM3U\n";
+            for (auto& entry : entries)
+            {
+                out << "#EXTINF:" << (entry.duration >= 0.0 ? (int)entry.duration : -1) << "," << entry.displayText << "\n"
+                    << getPath(entry.file) << "\n";
+            }
+        }
+
+        out.flush();
+        if (out.getStatus().failed())
+            return juce::Result::fail("Write failed: " + playlistFile.getFullPathName());
+    }
+
+    if (!temp.overwriteTargetFileWithTemporary())
+        return juce::Result::fail("Cannot replace " + playlistFile.getFullPathName());
+    return juce::Result::ok();
+}
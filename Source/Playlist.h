@@ -0,0 +1,75 @@
+#pragma once
+#include <JuceHeader.h>
+
+struct PlaylistEntry
+{
+    juce::File file;
+    juce::String title;
+    juce::String artist;
+    double duration = -1.0;
+
+    // Built once when the entry or its metadata changes, so painting a row is
+    // just a draw call.
+    juce::String displayText;
+    juce::String durationText;
+
+    void updateDisplayText();
+};
+
+// The playlist rows plus the strings the list box draws for them. Edits are
+// reported to listeners by row range so the view only touches what changed.
+class PlaylistModel
+{
+public:
+    class Listener
+    {
+    public:
+        virtual ~Listener() = default;
+        virtual void playlistRowsInserted(int startRow, int numRows) = 0;
+        virtual void playlistRowsRemoved(int startRow, int numRows) = 0;
+        virtual void playlistRowMoved(int fromRow, int toRow) = 0;
+        virtual void playlistRowChanged(int row) = 0;
+    };
+
+    // Fills in title, artist and duration for a new entry if anything already
+    // knows them; returns false to leave the file name showing.
+    using MetadataLookup = std::function<bool(const juce::File&, PlaylistEntry&)>;
+
+    PlaylistModel() = default;
+
+    int size() const { return (int)entries.size(); }
+    bool isEmpty() const { return entries.empty(); }
+    const PlaylistEntry& getEntry(int row) const { return entries[(size_t)row]; }
+    juce::File getFile(int row) const { return juce::isPositiveAndBelow(row, size()) ? entries[(size_t)row].file : juce::File(); }
+    int indexOf(const juce::File& file) const;
+
+    void insert(int row, const juce::Array<juce::File>& files);
+    void add(const juce::File& file) { insert(-1, { file }); }
+    void remove(int row, int numRows = 1);
+    void move(int fromRow, int toRow);
+    void clear();
+    void setMetadata(const juce::File& file, const juce::String& title, const juce::String& artist, double duration);
+
+    void setMetadataLookup(MetadataLookup lookup) { metadataLookup = std::move(lookup); }
+    void addListener(Listener* listener) { listeners.add(listener); }
+    void removeListener(Listener* listener) { listeners.remove(listener); }
+
+    // M3U/M3U8 and PLS are read and written a line at a time, so a playlist
+    // file is never held in memory whole.
+    static bool isPlaylistFile(const juce::File& file);
+    juce::Result importFrom(const juce::File& playlistFile, int row = -1);
+    juce::Result exportTo(const juce::File& playlistFile) const;
+
+private:
+    void insertEntries(int row, std::vector<PlaylistEntry> newEntries);
+    PlaylistEntry makeEntry(const juce::File& file) const;
+    static juce::File resolvePath(const juce::File& playlistDirectory, juce::String path);
+    void readM3U(juce::InputStream& in, const juce::File& directory, std::vector<PlaylistEntry>& result) const;
+    void readPLS(juce::InputStream& in, const juce::File& directory, std::vector<PlaylistEntry>& result) const;
+
+    std::vector<PlaylistEntry> entries;
+    MetadataLookup metadataLookup;
+    juce::ListenerList<Listener> listeners;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PlaylistModel)
+};
@@ -0,0 +1,251 @@
+#include "ReadAhead.h"
+
+LoopRegionSource::LoopRegionSource(juce::PositionableAudioSource* source)
+    : input(source)
+{
+}
+
+void LoopRegionSource::prepareToPlay(int samplesPerBlockExpected, double sampleRate)
+{
+    input->prepareToPlay(samplesPerBlockExpected, sampleRate);
+}
+
+void LoopRegionSource::releaseResources()
+{
+    input->releaseResources();
+}
+
+juce::int64 LoopRegionSource::getTotalLength() const
+{
+    // The read-ahead buffer only ever sees an unrolled timeline; the real
+    // position is recovered through toSourcePosition().
+    return input->getTotalLength() > 0 ? std::numeric_limits<juce::int64>::max() / 4 : 0;
+}
+
+juce::int64 LoopRegionSource::Mapping::getWrapEnd(juce::int64 length) const
+{
+    if (region.hasRange())
+        return region.end;
+    if (region.wholeTrack && length > 0)
+        return length;
+    return std::numeric_limits<juce::int64>::max();
+}
+
+juce::int64 LoopRegionSource::Mapping::toSource(juce::int64 position, juce::int64 length) const
+{
+    auto local = juce::jmax((juce::int64)0, position - base);
+    auto wrapEnd = getWrapEnd(length);
+    if (local < wrapEnd)
+        return local;
+
+    auto wrapStart = getWrapStart();
+    return wrapStart + (local - wrapStart) % (wrapEnd - wrapStart);
+}
+
+LoopRegionSource::Mapping LoopRegionSource::getMapping() const
+{
+    const juce::SpinLock::ScopedLockType sl(mappingLock);
+    return mapping;
+}
+
+LoopRegion LoopRegionSource::getRegion() const
+{
+    return getMapping().region;
+}
+
+juce::int64 LoopRegionSource::toSourcePosition(juce::int64 position) const
+{
+    return getMapping().toSource(position, input->getTotalLength());
+}
+
+juce::int64 LoopRegionSource::toVirtualPosition(juce::int64 sourcePosition) const
+{
+    auto current = getMapping();
+    if (current.region.hasRange() && sourcePosition >= current.region.end)
+        sourcePosition = current.region.start;
+    return current.base + juce::jmax((juce::int64)0, sourcePosition);
+}
+
+juce::int64 LoopRegionSource::setRegion(const LoopRegion& newRegion, juce::int64 currentVirtualPosition, int lookahead)
+{
+    auto length = input->getTotalLength();
+    const juce::SpinLock::ScopedLockType sl(mappingLock);
+    if (newRegion == mapping.region)
+        return -1;
+
+    Mapping updated;
+    updated.region = newRegion;
+    updated.base = mapping.base;
+
+    // Audio already buffered ahead is still valid if it lies before both the
+    // old and the new wrap point; otherwise move to a fresh stretch of the
+    // unrolled timeline so the read-ahead refills from the right place.
+    auto local = currentVirtualPosition - mapping.base;
+    if (local + lookahead < juce::jmin(mapping.getWrapEnd(length), updated.getWrapEnd(length)))
+    {
+        mapping = updated;
+        return -1;
+    }
+
+    auto sourcePosition = mapping.toSource(currentVirtualPosition, length);
+    if (newRegion.hasRange() && sourcePosition >= newRegion.end)
+        sourcePosition = newRegion.start;
+
+    updated.base = mapping.base + ((juce::int64)1 << 40);
+    mapping = updated;
+    return updated.base + sourcePosition;
+}
+
+void LoopRegionSource::readSource(juce::int64 position, juce::AudioBuffer<float>& buffer, int startSample, int numSamples)
+{
+    auto startTicks = juce::Time::getHighResolutionTicks();
+    input->setNextReadPosition(position);
+    input->getNextAudioBlock(juce::AudioSourceChannelInfo(&buffer, startSample, numSamples));
+    decodeTicks += juce::Time::getHighResolutionTicks() - startTicks;
+    decodedSamples += numSamples;
+}
+
+double LoopRegionSource::getDecodeSeconds() const
+{
+    return juce::Time::highResolutionTicksToSeconds(decodeTicks.load());
+}
+
+void LoopRegionSource::getNextAudioBlock(const juce::AudioSourceChannelInfo& bufferToFill)
+{
+    auto current = getMapping();
+    auto length = input->getTotalLength();
+    auto wrapStart = current.getWrapStart();
+    auto wrapEnd = current.getWrapEnd(length);
+    auto& buffer = *bufferToFill.buffer;
+    int done = 0;
+
+    while (done < bufferToFill.numSamples)
+    {
+        auto position = current.toSource(virtualPosition, length);
+        int numSamples = (int)juce::jmin((juce::int64)(bufferToFill.numSamples - done), wrapEnd - position);
+        if (numSamples <= 0)
+        {
+            buffer.clear(bufferToFill.startSample + done, bufferToFill.numSamples - done);
+            break;
+        }
+
+        int startSample = bufferToFill.startSample + done;
+        readSource(position, buffer, startSample, numSamples);
+
+        // After a wrap, fade from the audio that would have followed the loop
+        // end into the loop start so the jump doesn't click.
+        bool wrapped = virtualPosition - current.base >= wrapEnd;
+        auto fadePosition = position - wrapStart;
+        if (wrapped && fadePosition < current.region.fadeLength)
+        {
+            int fadeLength = current.region.fadeLength;
+            int numToFade = (int)juce::jmin((juce::int64)numSamples, fadeLength - fadePosition);
+            fadeBuffer.setSize(buffer.getNumChannels(), numToFade, false, false, true);
+            readSource(wrapEnd + fadePosition, fadeBuffer, 0, numToFade);
+
+            float startGain = (float)(fadePosition + 1) / (float)(fadeLength + 1);
+            float endGain = (float)(fadePosition + numToFade + 1) / (float)(fadeLength + 1);
+            for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            {
+                buffer.applyGainRamp(ch, startSample, numToFade, startGain, endGain);
+                buffer.addFromWithRamp(ch, startSample, fadeBuffer.getReadPointer(ch), numToFade, 1.0f - startGain, 1.0f - endGain);
+            }
+        }
+
+        virtualPosition += numSamples;
+        done += numSamples;
+    }
+}
+
+ReadAheadSource::ReadAheadSource(juce::PositionableAudioSource* source, juce::TimeSliceThread& thread, int bufferSizeSamples, int numChannels)
+    : input(source), looper(source), buffering(&looper, thread, false, bufferSizeSamples, numChannels), bufferSize(bufferSizeSamples)
+{
+}
+
+void ReadAheadSource::prepareToPlay(int samplesPerBlockExpected, double sampleRate)
+{
+    buffering.prepareToPlay(samplesPerBlockExpected, sampleRate);
+}
+
+void ReadAheadSource::releaseResources()
+{
+    buffering.releaseResources();
+}
+
+void ReadAheadSource::getNextAudioBlock(const juce::AudioSourceChannelInfo& bufferToFill)
+{
+    // BufferingAudioSource also reports "not ready" for a source with no known
+    // length or a position past its end, and neither is a read-ahead miss.
+    auto position = getNextReadPosition();
+    if (!buffering.waitForNextAudioBlockReady(bufferToFill, blockingReads.load() ? 5000 : 0)
+        && juce::isPositiveAndBelow(position, input->getTotalLength()))
+        ++underruns;
+
+    buffering.getNextAudioBlock(bufferToFill);
+}
+
+void ReadAheadSource::setNextReadPosition(juce::int64 newPosition)
+{
+    buffering.setNextReadPosition(looper.toVirtualPosition(newPosition));
+}
+
+juce::int64 ReadAheadSource::getNextReadPosition() const
+{
+    return looper.toSourcePosition(buffering.getNextReadPosition());
+}
+
+juce::int64 ReadAheadSource::getTotalLength() const
+{
+    return input->getTotalLength();
+}
+
+bool ReadAheadSource::isLooping() const
+{
+    return looper.getRegion().wholeTrack;
+}
+
+void ReadAheadSource::setLooping(bool shouldLoop)
+{
+    auto region = looper.getRegion();
+    region.wholeTrack = shouldLoop;
+    updateRegion(region);
+}
+
+void ReadAheadSource::setLoopRegion(juce::int64 startSample, juce::int64 endSample, int fadeSamples)
+{
+    auto region = looper.getRegion();
+    region.start = juce::jmax((juce::int64)0, startSample);
+    region.end = juce::jmax(region.start, endSample);
+    region.fadeLength = (int)juce::jlimit((juce::int64)0, (region.end - region.start) / 2, (juce::int64)fadeSamples);
+    updateRegion(region);
+}
+
+void ReadAheadSource::updateRegion(const LoopRegion& newRegion)
+{
+    auto seekTo = looper.setRegion(newRegion, buffering.getNextReadPosition(), bufferSize);
+    if (seekTo >= 0)
+        buffering.setNextReadPosition(seekTo);
+}
+
+ReadAheadPool::ReadAheadPool(int numThreads)
+{
+    for (int i = 0; i < juce::jmax(1, numThreads); ++i)
+    {
+        auto* thread = threads.add(new juce::TimeSliceThread("Audio Read-Ahead " + juce::String(i + 1)));
+        thread->startThread(juce::Thread::Priority::high);
+    }
+}
+
+ReadAheadPool::~ReadAheadPool()
+{
+    for (auto* thread : threads)
+        thread->stopThread(2000);
+}
+
+std::unique_ptr<ReadAheadSource> ReadAheadPool::createSource(juce::PositionableAudioSource* source, int numChannels, double sampleRate, double bufferSeconds)
+{
+    auto& thread = *threads[nextThread++ % threads.size()];
+
+    int bufferSize = juce::jmax(4096, juce::roundToInt(bufferSeconds * sampleRate));
+    return std::make_unique<ReadAheadSource>(source, thread, bufferSize, juce::jmax(2, numChannels));
+}
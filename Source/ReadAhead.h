@@ -0,0 +1,121 @@
+#pragma once
+#include <JuceHeader.h>
+
+struct LoopRegion
+{
+    juce::int64 start = 0;
+    juce::int64 end = 0;
+    int fadeLength = 0;
+    bool wholeTrack = false;
+
+    bool hasRange() const { return end > start; }
+    bool operator==(const LoopRegion& other) const
+    {
+        return start == other.start && end == other.end && fadeLength == other.fadeLength && wholeTrack == other.wholeTrack;
+    }
+};
+
+class LoopRegionSource : public juce::PositionableAudioSource
+{
+public:
+    explicit LoopRegionSource(juce::PositionableAudioSource* source);
+
+    void prepareToPlay(int samplesPerBlockExpected, double sampleRate) override;
+    void releaseResources() override;
+    void getNextAudioBlock(const juce::AudioSourceChannelInfo& bufferToFill) override;
+
+    void setNextReadPosition(juce::int64 newPosition) override { virtualPosition = newPosition; }
+    juce::int64 getNextReadPosition() const override { return virtualPosition; }
+    juce::int64 getTotalLength() const override;
+    bool isLooping() const override { return false; }
+    void setLooping(bool) override {}
+
+    LoopRegion getRegion() const;
+    juce::int64 setRegion(const LoopRegion& newRegion, juce::int64 currentVirtualPosition, int lookahead);
+    juce::int64 toSourcePosition(juce::int64 position) const;
+    juce::int64 toVirtualPosition(juce::int64 sourcePosition) const;
+
+    juce::int64 getDecodedSamples() const { return decodedSamples.load(); }
+    double getDecodeSeconds() const;
+
+private:
+    struct Mapping
+    {
+        LoopRegion region;
+        juce::int64 base = 0;
+
+        juce::int64 getWrapStart() const { return region.hasRange() ? region.start : 0; }
+        juce::int64 getWrapEnd(juce::int64 length) const;
+        juce::int64 toSource(juce::int64 position, juce::int64 length) const;
+    };
+
+    Mapping getMapping() const;
+    void readSource(juce::int64 position, juce::AudioBuffer<float>& buffer, int startSample, int numSamples);
+
+    juce::PositionableAudioSource* input;
+    juce::SpinLock mappingLock;
+    Mapping mapping;
+    juce::int64 virtualPosition = 0;
+    juce::AudioBuffer<float> fadeBuffer;
+    std::atomic<juce::int64> decodeTicks { 0 };
+    std::atomic<juce::int64> decodedSamples { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LoopRegionSource)
+};
+
+class ReadAheadSource : public juce::PositionableAudioSource
+{
+public:
+    ReadAheadSource(juce::PositionableAudioSource* source, juce::TimeSliceThread& thread, int bufferSizeSamples, int numChannels);
+
+    void prepareToPlay(int samplesPerBlockExpected, double sampleRate) override;
+    void releaseResources() override;
+    void getNextAudioBlock(const juce::AudioSourceChannelInfo& bufferToFill) override;
+
+    void setNextReadPosition(juce::int64 newPosition) override;
+    juce::int64 getNextReadPosition() const override;
+    juce::int64 getTotalLength() const override;
+    bool isLooping() const override;
+    void setLooping(bool shouldLoop) override;
+
+    void setLoopRegion(juce::int64 startSample, juce::int64 endSample, int fadeSamples);
+    void clearLoopRegion() { setLoopRegion(0, 0, 0); }
+
+    // Offline rendering pulls blocks faster than realtime, so it waits for the
+    // read-ahead thread instead of counting an underrun.
+    void setBlockingReads(bool shouldBlock) { blockingReads = shouldBlock; }
+
+    int getBufferSize() const { return bufferSize; }
+    int getUnderrunCount() const { return underruns.load(); }
+    void resetUnderrunCount() { underruns = 0; }
+    juce::int64 getDecodedSamples() const { return looper.getDecodedSamples(); }
+    double getDecodeSeconds() const { return looper.getDecodeSeconds(); }
+
+private:
+    void updateRegion(const LoopRegion& newRegion);
+
+    juce::PositionableAudioSource* input;
+    LoopRegionSource looper;
+    juce::BufferingAudioSource buffering;
+    int bufferSize;
+    std::atomic<int> underruns { 0 };
+    std::atomic<bool> blockingReads { false };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ReadAheadSource)
+};
+
+class ReadAheadPool
+{
+public:
+    explicit ReadAheadPool(int numThreads = 1);
+    ~ReadAheadPool();
+
+    std::unique_ptr<ReadAheadSource> createSource(juce::PositionableAudioSource* source, int numChannels, double sampleRate, double bufferSeconds);
+    int getNumThreads() const { return threads.size(); }
+
+private:
+    juce::OwnedArray<juce::TimeSliceThread> threads;
+    std::atomic<int> nextThread { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ReadAheadPool)
+};
@@ -0,0 +1,233 @@
+#include "SampleCache.h"
+#include "TrackCache.h"
+#include "MappedReader.h"
+
+CachedReader::CachedReader(std::unique_ptr<juce::AudioFormatReader> sourceReader)
+    : juce::AudioFormatReader(nullptr, sourceReader->getFormatName()), source(std::move(sourceReader)), slot(std::make_shared<Slot>())
+{
+    sampleRate = source->sampleRate;
+    lengthInSamples = source->lengthInSamples;
+    numChannels = source->numChannels;
+    metadataValues = source->metadataValues;
+    bitsPerSample = 32;
+    usesFloatingPointData = true;
+}
+
+void CachedReader::setClip(ClipPtr newClip)
+{
+    ++slot->generation;
+    const juce::SpinLock::ScopedLockType sl(slot->lock);
+    slot->clip = std::move(newClip);
+}
+
+ClipPtr CachedReader::getClip() const
+{
+    const juce::SpinLock::ScopedLockType sl(slot->lock);
+    return slot->clip;
+}
+
+bool CachedReader::covers(juce::int64 startSample, juce::int64 endSample) const
+{
+    auto clip = getClip();
+    return clip != nullptr && clip->start <= startSample && clip->getEnd() >= endSample;
+}
+
+bool CachedReader::readSamples(int* const* destChannels, int numDestChannels, int startOffsetInDestBuffer,
+                               juce::int64 startSampleInFile, int numSamples)
+{
+    auto clip = getClip();
+
+    while (numSamples > 0)
+    {
+        int numThisTime = numSamples;
+
+        if (clip != nullptr && startSampleInFile >= clip->start && startSampleInFile < clip->getEnd())
+        {
+            numThisTime = (int)juce::jmin((juce::int64)numSamples, clip->getEnd() - startSampleInFile);
+            auto offset = (int)(startSampleInFile - clip->start);
+            for (int ch = 0; ch < numDestChannels; ++ch)
+            {
+                if (auto* dest = reinterpret_cast<float*>(destChannels[ch]))
+                {
+                    if (ch < clip->samples.getNumChannels())
+                        juce::FloatVectorOperations::copy(dest + startOffsetInDestBuffer, clip->samples.getReadPointer(ch, offset), numThisTime);
+                    else
+                        juce::FloatVectorOperations::clear(dest + startOffsetInDestBuffer, numThisTime);
+                }
+            }
+        }
+        else if (startSampleInFile < 0 || startSampleInFile >= lengthInSamples)
+        {
+            for (int ch = 0; ch < numDestChannels; ++ch)
+                if (auto* dest = reinterpret_cast<float*>(destChannels[ch]))
+                    juce::FloatVectorOperations::clear(dest + startOffsetInDestBuffer, numThisTime);
+        }
+        else
+        {
+            auto stopAt = clip != nullptr && clip->start > startSampleInFile ? clip->start : lengthInSamples;
+            numThisTime = (int)juce::jmin((juce::int64)numSamples, stopAt - startSampleInFile);
+            readThrough(destChannels, numDestChannels, startOffsetInDestBuffer, startSampleInFile, numThisTime);
+        }
+
+        startSampleInFile += numThisTime;
+        startOffsetInDestBuffer += numThisTime;
+        numSamples -= numThisTime;
+    }
+
+    return true;
+}
+
+void CachedReader::readThrough(int* const* destChannels, int numDestChannels, int destOffset, juce::int64 startSample, int numSamples)
+{
+    // Reads only happen on the read-ahead thread, so the scratch buffer only
+    // grows to the largest block it asks for.
+    scratch.setSize((int)numChannels, numSamples, false, false, true);
+    source->read(&scratch, 0, numSamples, startSample, true, true);
+
+    for (int ch = 0; ch < numDestChannels; ++ch)
+        if (auto* dest = reinterpret_cast<float*>(destChannels[ch]))
+            juce::FloatVectorOperations::copy(dest + destOffset, scratch.getReadPointer(juce::jmin(ch, scratch.getNumChannels() - 1)), numSamples);
+}
+
+SampleCache::SampleCache(juce::AudioFormatManager& formats, size_t budgetBytes)
+    : formatManager(formats), budget(budgetBytes)
+{
+}
+
+SampleCache::~SampleCache()
+{
+    workers.removeAllJobs(true, 5000);
+}
+
+void SampleCache::setBudget(size_t bytes)
+{
+    const juce::ScopedLock sl(lock);
+    budget = bytes;
+    evictToBudget();
+}
+
+size_t SampleCache::getBudget() const
+{
+    const juce::ScopedLock sl(lock);
+    return budget;
+}
+
+size_t SampleCache::getUsedBytes() const
+{
+    const juce::ScopedLock sl(lock);
+    return usedBytes;
+}
+
+int SampleCache::getNumClips() const
+{
+    const juce::ScopedLock sl(lock);
+    return (int)entries.size();
+}
+
+void SampleCache::clear()
+{
+    const juce::ScopedLock sl(lock);
+    entries.clear();
+    usedBytes = 0;
+}
+
+juce::String SampleCache::makeKey(const juce::File& file, juce::int64 startSample, juce::int64 endSample)
+{
+    return TrackCache::getKey(file) + ":" + juce::String(startSample) + "-" + juce::String(endSample);
+}
+
+ClipPtr SampleCache::find(const juce::String& key)
+{
+    const juce::ScopedLock sl(lock);
+    for (auto it = entries.begin(); it != entries.end(); ++it)
+    {
+        if (it->key == key)
+        {
+            entries.splice(entries.begin(), entries, it);
+            return entries.front().clip;
+        }
+    }
+    return nullptr;
+}
+
+void SampleCache::insert(const juce::String& key, ClipPtr clip)
+{
+    const juce::ScopedLock sl(lock);
+    for (auto& entry : entries)
+        if (entry.key == key)
+            return;
+
+    usedBytes += clip->getSizeInBytes();
+    entries.push_front({ key, std::move(clip) });
+    evictToBudget();
+}
+
+void SampleCache::evictToBudget()
+{
+    while (usedBytes > budget && !entries.empty())
+    {
+        usedBytes -= entries.back().clip->getSizeInBytes();
+        entries.pop_back();
+    }
+}
+
+ClipPtr SampleCache::getOrDecode(const juce::File& file, juce::AudioFormatReader& reader, juce::int64 startSample, juce::int64 endSample)
+{
+    startSample = juce::jmax((juce::int64)0, startSample);
+    endSample = juce::jmin(endSample, reader.lengthInSamples);
+    if (endSample <= startSample)
+        return nullptr;
+
+    auto key = makeKey(file, startSample, endSample);
+    if (auto clip = find(key))
+        return clip;
+
+    auto numSamples = endSample - startSample;
+    auto numChannels = (int)juce::jmax(1u, reader.numChannels);
+    if ((size_t)numSamples * (size_t)numChannels * sizeof(float) > getBudget() || numSamples > std::numeric_limits<int>::max())
+        return nullptr;
+
+    auto clip = std::make_shared<DecodedClip>();
+    clip->start = startSample;
+    clip->samples.setSize(numChannels, (int)numSamples);
+    if (!reader.read(&clip->samples, 0, (int)numSamples, startSample, true, true))
+        return nullptr;
+
+    insert(key, clip);
+    return clip;
+}
+
+void SampleCache::decodeAsync(CachedReader& reader, const juce::File& file, juce::int64 startSample, juce::int64 endSample)
+{
+    int generation = ++reader.slot->generation;
+    std::weak_ptr<CachedReader::Slot> weakSlot = reader.slot;
+
+    workers.addJob([this, weakSlot, generation, file, startSample, endSample]
+    {
+        auto isWanted = [&weakSlot, generation]
+        {
+            auto slot = weakSlot.lock();
+            return slot != nullptr && slot->generation.load() == generation;
+        };
+
+        if (!isWanted())
+            return;
+
+        auto decoder = MappedReader::create(formatManager, file);
+        if (decoder == nullptr)
+            decoder.reset(formatManager.createReaderFor(file));
+        if (decoder == nullptr)
+            return;
+
+        auto clip = getOrDecode(file, *decoder, startSample, endSample);
+        if (clip == nullptr)
+            return;
+
+        if (auto slot = weakSlot.lock())
+        {
+            const juce::SpinLock::ScopedLockType sl(slot->lock);
+            if (slot->generation.load() == generation)
+                slot->clip = std::move(clip);
+        }
+    });
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include <JuceHeader.h>
+
+// A stretch of a file decoded to float, starting at sample 'start'.
+struct DecodedClip
+{
+    juce::int64 start = 0;
+    juce::AudioBuffer<float> samples;
+
+    juce::int64 getEnd() const { return start + samples.getNumSamples(); }
+    size_t getSizeInBytes() const { return (size_t)samples.getNumChannels() * (size_t)samples.getNumSamples() * sizeof(float); }
+};
+
+using ClipPtr = std::shared_ptr<const DecodedClip>;
+
+// Serves samples from a decoded clip where it has one and decodes through the
+// wrapped reader everywhere else. The clip can be swapped from any thread.
+class CachedReader : public juce::AudioFormatReader
+{
+public:
+    explicit CachedReader(std::unique_ptr<juce::AudioFormatReader> sourceReader);
+
+    bool readSamples(int* const* destChannels, int numDestChannels, int startOffsetInDestBuffer,
+                     juce::int64 startSampleInFile, int numSamples) override;
+
+    void setClip(ClipPtr newClip);
+    ClipPtr getClip() const;
+    bool covers(juce::int64 startSample, juce::int64 endSample) const;
+
+private:
+    friend class SampleCache;
+
+    struct Slot
+    {
+        juce::SpinLock lock;
+        ClipPtr clip;
+        std::atomic<int> generation { 0 };
+    };
+
+    void readThrough(int* const* destChannels, int numDestChannels, int destOffset, juce::int64 startSample, int numSamples);
+
+    std::unique_ptr<juce::AudioFormatReader> source;
+    std::shared_ptr<Slot> slot;
+    juce::AudioBuffer<float> scratch;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CachedReader)
+};
+
+// Decoded clips shared between decks, kept within a memory budget by dropping
+// the least recently used ones. A clip still held by a reader stays alive
+// after eviction until that reader lets go of it.
+class SampleCache
+{
+public:
+    explicit SampleCache(juce::AudioFormatManager& formats, size_t budgetBytes = 256 * 1024 * 1024);
+    ~SampleCache();
+
+    void setBudget(size_t bytes);
+    size_t getBudget() const;
+    size_t getUsedBytes() const;
+    int getNumClips() const;
+    void clear();
+
+    // Returns the cached copy of [startSample, endSample), decoding it from the
+    // reader first if needed, or nullptr if it would not fit in the budget.
+    ClipPtr getOrDecode(const juce::File& file, juce::AudioFormatReader& reader, juce::int64 startSample, juce::int64 endSample);
+
+    // Decodes on the cache's own thread and gives the clip to the reader when it
+    // is ready, unless another clip was requested for it in the meantime.
+    void decodeAsync(CachedReader& reader, const juce::File& file, juce::int64 startSample, juce::int64 endSample);
+
+private:
+    struct Entry
+    {
+        juce::String key;
+        ClipPtr clip;
+    };
+
+    static juce::String makeKey(const juce::File& file, juce::int64 startSample, juce::int64 endSample);
+    ClipPtr find(const juce::String& key);
+    void insert(const juce::String& key, ClipPtr clip);
+    void evictToBudget();
+
+    juce::AudioFormatManager& formatManager;
+    juce::CriticalSection lock;
+    std::list<Entry> entries;
+    size_t budget;
+    size_t usedBytes = 0;
+    juce::ThreadPool workers{1};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SampleCache)
+};
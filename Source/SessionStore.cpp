@@ -0,0 +1,519 @@
+#include "SessionStore.h"
+
+namespace
+{
+    const juce::int32 snapshotFileMagic = 0x53505041;
+    const juce::int32 journalFileMagic = 0x4a505041;
+    const juce::int32 sessionFileVersion = 1;
+    const juce::int64 maxJournalBytes = 256 * 1024;
+    const int recordOverhead = 9;
+
+    juce::uint32 fnv1a(juce::uint32 hash, const void* data, size_t size)
+    {
+        auto* bytes = static_cast<const juce::uint8*>(data);
+        for (size_t i = 0; i < size; ++i)
+            hash = (hash ^ bytes[i]) * 16777619u;
+        return hash;
+    }
+
+    juce::uint32 recordChecksum(juce::uint8 op, const void* payload, size_t payloadSize)
+    {
+        return fnv1a(fnv1a(2166136261u, &op, 1), payload, payloadSize);
+    }
+
+    bool isValidDeck(int deck)
+    {
+        return juce::isPositiveAndBelow(deck, SessionState::numDecks);
+    }
+}
+
+SessionStore::SessionStore(const juce::File& directory)
+    : snapshotFile(directory.getChildFile("session.bin")),
+      journalFile(directory.getChildFile("session.journal")),
+      legacyFile(directory.getChildFile("session.xml"))
+{
+    load();
+}
+
+SessionStore::~SessionStore()
+{
+    compact();
+}
+
+void SessionStore::load()
+{
+    bool needsCompact = false;
+    {
+        juce::FileInputStream in(snapshotFile);
+        if (in.openedOk() && in.readInt() == snapshotFileMagic && in.readInt() == sessionFileVersion)
+        {
+            generation = in.readInt();
+            readRecords(in);
+        }
+        else if (legacyFile.existsAsFile())
+        {
+            importXml(legacyFile);
+            needsCompact = true;
+        }
+    }
+
+    {
+        juce::FileInputStream in(journalFile);
+        if (in.openedOk() && !needsCompact)
+        {
+            if (in.readInt() == journalFileMagic && in.readInt() == sessionFileVersion && in.readInt() == generation)
+            {
+                readRecords(in);
+                // A torn record at the end would hide anything appended after it.
+                needsCompact = !in.isExhausted();
+            }
+            else
+            {
+                needsCompact = true;
+            }
+        }
+    }
+
+    if (needsCompact)
+        compact();
+}
+
+int SessionStore::readRecords(juce::InputStream& in)
+{
+    int numRecords = 0;
+    while (in.getNumBytesRemaining() >= recordOverhead)
+    {
+        auto start = in.getPosition();
+        int size = in.readInt();
+        if (size < 0 || size > in.getNumBytesRemaining() - 5)
+        {
+            in.setPosition(start);
+            break;
+        }
+
+        auto op = (juce::uint8)in.readByte();
+        juce::MemoryBlock payload;
+        if (size > 0)
+            in.readIntoMemoryBlock(payload, size);
+        if ((juce::uint32)in.readInt() != recordChecksum(op, payload.getData(), payload.getSize()))
+        {
+            in.setPosition(start);
+            break;
+        }
+
+        juce::MemoryInputStream payloadStream(payload, false);
+        apply((Op)op, payloadStream);
+        ++numRecords;
+    }
+    return numRecords;
+}
+
+void SessionStore::writeRecord(juce::OutputStream& out, Op op, const void* payload, size_t payloadSize)
+{
+    out.writeInt((int)payloadSize);
+    out.writeByte((char)op);
+    out.write(payload, payloadSize);
+    out.writeInt((int)recordChecksum((juce::uint8)op, payload, payloadSize));
+}
+
+void SessionStore::apply(Op op, juce::InputStream& in)
+{
+    switch (op)
+    {
+        case Op::deckFile:
+        {
+            int deck = in.readByte();
+            auto path = in.readString();
+            if (isValidDeck(deck))
+            {
+                state.decks[deck].file = path.isEmpty() ? juce::File() : juce::File(path);
+                state.decks[deck].position = 0.0;
+            }
+            break;
+        }
+        case Op::deckPosition:
+        {
+            int deck = in.readByte();
+            double seconds = in.readDouble();
+            if (isValidDeck(deck))
+                state.decks[deck].position = seconds;
+            break;
+        }
+        case Op::deckGain:
+        {
+            int deck = in.readByte();
+            float gain = in.readFloat();
+            if (isValidDeck(deck))
+                state.decks[deck].gain = gain;
+            break;
+        }
+        case Op::deckSpeed:
+        {
+            int deck = in.readByte();
+            double speed = in.readDouble();
+            if (isValidDeck(deck))
+                state.decks[deck].speed = speed;
+            break;
+        }
+        case Op::deckMuted:
+        {
+            int deck = in.readByte();
+            bool muted = in.readBool();
+            if (isValidDeck(deck))
+                state.decks[deck].muted = muted;
+            break;
+        }
+        case Op::addMarker:
+        {
+            Marker marker;
+            marker.timestamp = in.readDouble();
+            marker.label = in.readString();
+            state.markers.add(marker);
+            break;
+        }
+        case Op::removeMarker:
+            state.markers.remove(in.readInt());
+            break;
+        case Op::clearMarkers:
+            state.markers.clear();
+            break;
+        case Op::insertPlaylist:
+        {
+            int row = in.readInt();
+            int numFiles = in.readInt();
+            if (!juce::isPositiveAndNotGreaterThan(row, state.playlist.size()))
+                row = state.playlist.size();
+            for (int i = 0; i < numFiles && !in.isExhausted(); ++i)
+                state.playlist.insert(row + i, juce::File(in.readString()));
+            break;
+        }
+        case Op::removePlaylist:
+        {
+            int row = in.readInt();
+            state.playlist.removeRange(row, in.readInt());
+            break;
+        }
+        case Op::movePlaylist:
+        {
+            int fromRow = in.readInt();
+            int toRow = in.readInt();
+            if (juce::isPositiveAndBelow(fromRow, state.playlist.size()) && juce::isPositiveAndBelow(toRow, state.playlist.size()))
+                state.playlist.move(fromRow, toRow);
+            break;
+        }
+        case Op::playlistIndex:
+            state.playlistIndex = in.readInt();
+            break;
+        default:
+            break;
+    }
+}
+
+void SessionStore::record(Op op, const juce::MemoryOutputStream& payload)
+{
+    juce::MemoryInputStream in(payload.getData(), payload.getDataSize(), false);
+    apply(op, in);
+
+    if (!openJournal())
+        return;
+
+    writePending();
+    writeRecord(*journal, op, payload.getData(), payload.getDataSize());
+    finishWrite();
+}
+
+void SessionStore::commitPending()
+{
+    if (!openJournal())
+        return;
+
+    writePending();
+    finishWrite();
+}
+
+void SessionStore::writePending()
+{
+    for (int deck = 0; deck < SessionState::numDecks; ++deck)
+    {
+        auto& values = state.decks[deck];
+        auto& flags = pending[deck];
+
+        if (flags.position)
+        {
+            juce::MemoryOutputStream payload;
+            payload.writeByte((char)deck);
+            payload.writeDouble(values.position);
+            writeRecord(*journal, Op::deckPosition, payload.getData(), payload.getDataSize());
+        }
+        if (flags.gain)
+        {
+            juce::MemoryOutputStream payload;
+            payload.writeByte((char)deck);
+            payload.writeFloat(values.gain);
+            writeRecord(*journal, Op::deckGain, payload.getData(), payload.getDataSize());
+        }
+        if (flags.speed)
+        {
+            juce::MemoryOutputStream payload;
+            payload.writeByte((char)deck);
+            payload.writeDouble(values.speed);
+            writeRecord(*journal, Op::deckSpeed, payload.getData(), payload.getDataSize());
+        }
+        flags = {};
+    }
+}
+
+void SessionStore::finishWrite()
+{
+    journal->flush();
+    if (journal->getPosition() > maxJournalBytes)
+        compact();
+}
+
+bool SessionStore::openJournal()
+{
+    if (journal != nullptr)
+        return true;
+
+    journalFile.getParentDirectory().createDirectory();
+    journal = std::make_unique<juce::FileOutputStream>(journalFile);
+    if (!journal->openedOk())
+    {
+        journal.reset();
+        return false;
+    }
+
+    if (journal->getPosition() == 0)
+    {
+        journal->writeInt(journalFileMagic);
+        journal->writeInt(sessionFileVersion);
+        journal->writeInt(generation);
+    }
+    return true;
+}
+
+void SessionStore::writeSnapshot(juce::OutputStream& out) const
+{
+    auto write = [&out](Op op, const juce::MemoryOutputStream& payload)
+    {
+        writeRecord(out, op, payload.getData(), payload.getDataSize());
+    };
+
+    for (int deck = 0; deck < SessionState::numDecks; ++deck)
+    {
+        auto& deckState = state.decks[deck];
+        juce::MemoryOutputStream file, position, gain, speed, muted;
+        file.writeByte((char)deck);
+        file.writeString(deckState.file.getFullPathName());
+        write(Op::deckFile, file);
+        position.writeByte((char)deck);
+        position.writeDouble(deckState.position);
+        write(Op::deckPosition, position);
+        gain.writeByte((char)deck);
+        gain.writeFloat(deckState.gain);
+        write(Op::deckGain, gain);
+        speed.writeByte((char)deck);
+        speed.writeDouble(deckState.speed);
+        write(Op::deckSpeed, speed);
+        muted.writeByte((char)deck);
+        muted.writeBool(deckState.muted);
+        write(Op::deckMuted, muted);
+    }
+
+    for (auto& marker : state.markers)
+    {
+        juce::MemoryOutputStream payload;
+        payload.writeDouble(marker.timestamp);
+        payload.writeString(marker.label);
+        write(Op::addMarker, payload);
+    }
+
+    juce::MemoryOutputStream playlist;
+    playlist.writeInt(0);
+    playlist.writeInt(state.playlist.size());
+    for (auto& file : state.playlist)
+        playlist.writeString(file.getFullPathName());
+    write(Op::insertPlaylist, playlist);
+
+    juce::MemoryOutputStream index;
+    index.writeInt(state.playlistIndex);
+    write(Op::playlistIndex, index);
+}
+
+bool SessionStore::compact()
+{
+    auto newGeneration = generation + 1;
+    snapshotFile.getParentDirectory().createDirectory();
+    juce::TemporaryFile temp(snapshotFile);
+    {
+        juce::FileOutputStream out(temp.getFile());
+        if (!out.openedOk())
+            return false;
+
+        out.writeInt(snapshotFileMagic);
+        out.writeInt(sessionFileVersion);
+        out.writeInt(newGeneration);
+        writeSnapshot(out);
+
+        out.flush();
+        if (out.getStatus().failed())
+            return false;
+    }
+    if (!temp.overwriteTargetFileWithTemporary())
+        return false;
+
+    // The old journal no longer matches the snapshot's generation, so a crash
+    // before it is deleted still loads correctly.
+    generation = newGeneration;
+    for (auto& flags : pending)
+        flags = {};
+    journal.reset();
+    journalFile.deleteFile();
+    return true;
+}
+
+void SessionStore::importXml(const juce::File& xmlFile)
+{
+    auto root = juce::parseXML(xmlFile);
+    if (root == nullptr || root->getTagName() != "Session")
+        return;
+
+    auto& deck = state.decks[0];
+    auto lastFile = root->getStringAttribute("lastFile");
+    if (lastFile.isNotEmpty())
+    {
+        deck.file = juce::File(lastFile);
+        deck.position = root->getDoubleAttribute("lastPosition", 0.0);
+        deck.gain = (float)root->getDoubleAttribute("volume", 0.8);
+        deck.speed = root->getDoubleAttribute("speed", 1.0);
+    }
+
+    if (auto* markersElement = root->getChildByName("Markers"))
+    {
+        for (auto* markerElement : markersElement->getChildWithTagNameIterator("Marker"))
+        {
+            Marker marker;
+            marker.timestamp = markerElement->getDoubleAttribute("timestamp");
+            marker.label = markerElement->getStringAttribute("label");
+            state.markers.add(marker);
+        }
+    }
+}
+
+void SessionStore::setDeckFile(int deck, const juce::File& file)
+{
+    if (!isValidDeck(deck) || state.decks[deck].file == file)
+        return;
+
+    juce::MemoryOutputStream payload;
+    payload.writeByte((char)deck);
+    payload.writeString(file.getFullPathName());
+    record(Op::deckFile, payload);
+}
+
+void SessionStore::setDeckPosition(int deck, double seconds)
+{
+    if (!isValidDeck(deck) || std::abs(state.decks[deck].position - seconds) < 0.01)
+        return;
+
+    state.decks[deck].position = seconds;
+    pending[deck].position = true;
+}
+
+void SessionStore::setDeckGain(int deck, float gain)
+{
+    if (!isValidDeck(deck) || state.decks[deck].gain == gain)
+        return;
+
+    state.decks[deck].gain = gain;
+    pending[deck].gain = true;
+}
+
+void SessionStore::setDeckSpeed(int deck, double speed)
+{
+    if (!isValidDeck(deck) || state.decks[deck].speed == speed)
+        return;
+
+    state.decks[deck].speed = speed;
+    pending[deck].speed = true;
+}
+
+void SessionStore::setDeckMuted(int deck, bool muted)
+{
+    if (!isValidDeck(deck) || state.decks[deck].muted == muted)
+        return;
+
+    juce::MemoryOutputStream payload;
+    payload.writeByte((char)deck);
+    payload.writeBool(muted);
+    record(Op::deckMuted, payload);
+}
+
+void SessionStore::addMarker(const Marker& marker)
+{
+    juce::MemoryOutputStream payload;
+    payload.writeDouble(marker.timestamp);
+    payload.writeString(marker.label);
+    record(Op::addMarker, payload);
+}
+
+void SessionStore::removeMarker(int index)
+{
+    if (!juce::isPositiveAndBelow(index, state.markers.size()))
+        return;
+
+    juce::MemoryOutputStream payload;
+    payload.writeInt(index);
+    record(Op::removeMarker, payload);
+}
+
+void SessionStore::clearMarkers()
+{
+    if (state.markers.isEmpty())
+        return;
+
+    juce::MemoryOutputStream payload;
+    record(Op::clearMarkers, payload);
+}
+
+void SessionStore::insertPlaylistFiles(int row, const juce::Array<juce::File>& files)
+{
+    if (files.isEmpty())
+        return;
+
+    juce::MemoryOutputStream payload;
+    payload.writeInt(row);
+    payload.writeInt(files.size());
+    for (auto& file : files)
+        payload.writeString(file.getFullPathName());
+    record(Op::insertPlaylist, payload);
+}
+
+void SessionStore::removePlaylistFiles(int row, int numRows)
+{
+    if (numRows <= 0)
+        return;
+
+    juce::MemoryOutputStream payload;
+    payload.writeInt(row);
+    payload.writeInt(numRows);
+    record(Op::removePlaylist, payload);
+}
+
+void SessionStore::movePlaylistFile(int fromRow, int toRow)
+{
+    juce::MemoryOutputStream payload;
+    payload.writeInt(fromRow);
+    payload.writeInt(toRow);
+    record(Op::movePlaylist, payload);
+}
+
+void SessionStore::setPlaylistIndex(int index)
+{
+    if (state.playlistIndex == index)
+        return;
+
+    juce::MemoryOutputStream payload;
+    payload.writeInt(index);
+    record(Op::playlistIndex, payload);
+}
@@ -0,0 +1,112 @@
+#pragma once
+#include <JuceHeader.h>
+
+struct Marker
+{
+    double timestamp;
+    juce::String label;
+};
+
+struct DeckSession
+{
+    juce::File file;
+    double position = 0.0;
+    float gain = 0.8f;
+    double speed = 1.0;
+    bool muted = false;
+};
+
+struct SessionState
+{
+    static constexpr int numDecks = 2;
+
+    DeckSession decks[numDecks];
+    juce::Array<Marker> markers;
+    juce::Array<juce::File> playlist;
+    int playlistIndex = -1;
+};
+
+// Keeps the session as a binary snapshot plus an append-only journal of the
+// changes made since. Discrete edits append one checksummed record and flush
+// it, so a crash loses at most the record being written. Deck position, gain
+// and speed change continuously while playing or dragging a slider, so their
+// setters only update the state and commitPending() journals the latest
+// values in one flush. compact() writes a new snapshot through a temporary
+// file and rename, then starts an empty journal; a journal left over from an
+// older snapshot is ignored on load.
+class SessionStore
+{
+public:
+    // Reads the snapshot and replays the journal, or imports the old
+    // session.xml once if there is no binary session yet.
+    explicit SessionStore(const juce::File& directory);
+    ~SessionStore();
+
+    const SessionState& getState() const { return state; }
+
+    void setDeckFile(int deck, const juce::File& file);
+    void setDeckPosition(int deck, double seconds);
+    void setDeckGain(int deck, float gain);
+    void setDeckSpeed(int deck, double speed);
+    void setDeckMuted(int deck, bool muted);
+
+    // Journals the position, gain and speed changes made since the last
+    // commit. Discrete edits and compact() commit them as well.
+    void commitPending();
+
+    void addMarker(const Marker& marker);
+    void removeMarker(int index);
+    void clearMarkers();
+
+    void insertPlaylistFiles(int row, const juce::Array<juce::File>& files);
+    void removePlaylistFiles(int row, int numRows);
+    void movePlaylistFile(int fromRow, int toRow);
+    void setPlaylistIndex(int index);
+
+    bool compact();
+
+private:
+    enum class Op : juce::uint8
+    {
+        deckFile = 1,
+        deckPosition,
+        deckGain,
+        deckSpeed,
+        deckMuted,
+        addMarker,
+        removeMarker,
+        clearMarkers,
+        insertPlaylist,
+        removePlaylist,
+        movePlaylist,
+        playlistIndex
+    };
+
+    void load();
+    void record(Op op, const juce::MemoryOutputStream& payload);
+    void writePending();
+    void finishWrite();
+    void apply(Op op, juce::InputStream& in);
+    static void writeRecord(juce::OutputStream& out, Op op, const void* payload, size_t payloadSize);
+    int readRecords(juce::InputStream& in);
+    void writeSnapshot(juce::OutputStream& out) const;
+    bool openJournal();
+    void importXml(const juce::File& xmlFile);
+
+    juce::File snapshotFile;
+    juce::File journalFile;
+    juce::File legacyFile;
+    std::unique_ptr<juce::FileOutputStream> journal;
+    juce::int32 generation = 0;
+    SessionState state;
+
+    struct PendingValues
+    {
+        bool position = false;
+        bool gain = false;
+        bool speed = false;
+    };
+    PendingValues pending[SessionState::numDecks];
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SessionStore)
+};
@@ -0,0 +1,478 @@
+#include "TagReader.h"
+
+namespace
+{
+    juce::uint32 readBE32(const juce::uint8* p) { return ((juce::uint32)p[0] << 24) | ((juce::uint32)p[1] << 16) | ((juce::uint32)p[2] << 8) | p[3]; }
+    juce::uint32 readBE24(const juce::uint8* p) { return ((juce::uint32)p[0] << 16) | ((juce::uint32)p[1] << 8) | p[2]; }
+    juce::uint32 readLE32(const juce::uint8* p) { return ((juce::uint32)p[3] << 24) | ((juce::uint32)p[2] << 16) | ((juce::uint32)p[1] << 8) | p[0]; }
+    juce::uint32 readSyncSafe(const juce::uint8* p) { return ((juce::uint32)(p[0] & 0x7f) << 21) | ((juce::uint32)(p[1] & 0x7f) << 14) | ((juce::uint32)(p[2] & 0x7f) << 7) | (p[3] & 0x7f); }
+
+    bool matches(const juce::uint8* p, const char* id, size_t len)
+    {
+        return std::memcmp(p, id, len) == 0;
+    }
+
+    juce::MemoryBlock removeUnsynchronisation(const juce::uint8* data, size_t size)
+    {
+        juce::MemoryBlock out;
+        out.ensureSize(size);
+        size_t written = 0;
+        auto* dest = static_cast<juce::uint8*>(out.getData());
+        for (size_t i = 0; i < size; ++i)
+        {
+            dest[written++] = data[i];
+            if (data[i] == 0xff && i + 1 < size && data[i + 1] == 0x00)
+                ++i;
+        }
+        out.setSize(written);
+        return out;
+    }
+
+    juce::String fromCodePoints(juce::Array<juce::juce_wchar>& chars)
+    {
+        chars.add(0);
+        return juce::String(juce::CharPointer_UTF32(chars.getRawDataPointer()));
+    }
+
+    juce::String decodeUTF16(const juce::uint8* data, size_t size, bool bigEndian)
+    {
+        juce::Array<juce::juce_wchar> chars;
+        for (size_t i = 0; i + 1 < size; i += 2)
+        {
+            juce::uint32 unit = bigEndian ? ((juce::uint32)data[i] << 8) | data[i + 1] : ((juce::uint32)data[i + 1] << 8) | data[i];
+            if (unit == 0)
+                break;
+
+            if (unit >= 0xd800 && unit < 0xdc00 && i + 3 < size)
+            {
+                juce::uint32 low = bigEndian ? ((juce::uint32)data[i + 2] << 8) | data[i + 3] : ((juce::uint32)data[i + 3] << 8) | data[i + 2];
+                if (low >= 0xdc00 && low < 0xe000)
+                {
+                    chars.add((juce::juce_wchar)(0x10000 + ((unit - 0xd800) << 10) + (low - 0xdc00)));
+                    i += 2;
+                    continue;
+                }
+            }
+            chars.add((juce::juce_wchar)unit);
+        }
+        return fromCodePoints(chars);
+    }
+
+    juce::String decodeUTF8OrLatin1(const juce::uint8* data, size_t size)
+    {
+        size_t len = 0;
+        while (len < size && data[len] != 0)
+            ++len;
+
+        if (juce::CharPointer_UTF8::isValidString((const char*)data, (int)len))
+            return juce::String::fromUTF8((const char*)data, (int)len);
+
+        juce::Array<juce::juce_wchar> chars;
+        for (size_t i = 0; i < len; ++i)
+            chars.add((juce::juce_wchar)data[i]);
+        return fromCodePoints(chars);
+    }
+}
+
+bool TagReader::read(const juce::File& file, TrackTags& tags)
+{
+    juce::MemoryMappedFile mapped(file, juce::MemoryMappedFile::readOnly);
+    auto* data = static_cast<const juce::uint8*>(mapped.getData());
+    auto size = mapped.getSize();
+    if (data == nullptr || size < 12)
+        return false;
+
+    if (matches(data, "RIFF", 4))
+        parseRiff(data, size, tags);
+    else if (matches(data, "FORM", 4))
+        parseAiff(data, size, tags);
+    else if (matches(data, "OggS", 4))
+        parseOgg(data, size, tags);
+    else
+    {
+        size_t id3Size = getID3v2Size(data, size);
+        if (id3Size > 0)
+            parseID3v2(data, size, tags);
+
+        if (id3Size + 4 <= size && matches(data + id3Size, "fLaC", 4))
+            parseFlac(data + id3Size, size - id3Size, tags);
+
+        if (!tags.isComplete())
+            parseID3v1(data, size, tags);
+    }
+
+    tags.title = tags.title.trim();
+    tags.artist = tags.artist.trim();
+    tags.album = tags.album.trim();
+    return !tags.isEmpty();
+}
+
+size_t TagReader::getID3v2Size(const juce::uint8* data, size_t size)
+{
+    if (size < 10 || !matches(data, "ID3", 3) || data[3] < 2 || data[3] > 4)
+        return 0;
+
+    size_t tagSize = 10 + readSyncSafe(data + 6);
+    if ((data[5] & 0x10) != 0)
+        tagSize += 10;
+    return tagSize <= size ? tagSize : 0;
+}
+
+void TagReader::parseID3v2(const juce::uint8* data, size_t size, TrackTags& tags)
+{
+    size_t tagSize = getID3v2Size(data, size);
+    if (tagSize == 0)
+        return;
+
+    int major = data[3];
+    juce::uint8 flags = data[5];
+    size_t bodySize = juce::jmin((size_t)readSyncSafe(data + 6), size - 10);
+
+    juce::MemoryBlock unsynced;
+    const juce::uint8* body = data + 10;
+    if ((flags & 0x80) != 0 && major < 4)
+    {
+        unsynced = removeUnsynchronisation(body, bodySize);
+        body = static_cast<const juce::uint8*>(unsynced.getData());
+        bodySize = unsynced.getSize();
+    }
+
+    size_t pos = 0;
+    if ((flags & 0x40) != 0 && bodySize >= 4)
+    {
+        if (major == 3)
+            pos = readBE32(body) + 4;
+        else if (major == 4)
+            pos = readSyncSafe(body);
+    }
+
+    juce::String albumArtist;
+    const size_t headerSize = major == 2 ? 6 : 10;
+    while (pos + headerSize <= bodySize && body[pos] != 0)
+    {
+        const juce::uint8* header = body + pos;
+        juce::String id;
+        size_t frameSize;
+        juce::uint8 formatFlags = 0;
+
+        if (major == 2)
+        {
+            id = juce::String((const char*)header, 3);
+            frameSize = readBE24(header + 3);
+        }
+        else
+        {
+            id = juce::String((const char*)header, 4);
+            frameSize = major == 4 ? readSyncSafe(header + 4) : readBE32(header + 4);
+            formatFlags = header[9];
+        }
+
+        pos += headerSize;
+        if (frameSize == 0 || frameSize > bodySize - pos)
+            break;
+
+        const juce::uint8* frame = body + pos;
+        size_t frameDataSize = frameSize;
+        pos += frameSize;
+
+        juce::String* field = nullptr;
+        if (id == "TIT2" || id == "TT2")
+            field = &tags.title;
+        else if (id == "TPE1" || id == "TP1")
+            field = &tags.artist;
+        else if (id == "TALB" || id == "TAL")
+            field = &tags.album;
+        else if (id == "TPE2" || id == "TP2")
+            field = &albumArtist;
+
+        if (field == nullptr || field->isNotEmpty())
+            continue;
+
+        juce::MemoryBlock frameUnsynced;
+        if (major == 3)
+        {
+            if ((formatFlags & 0xc0) != 0)
+                continue;
+            if ((formatFlags & 0x20) != 0 && frameDataSize > 1)
+            {
+                ++frame;
+                --frameDataSize;
+            }
+        }
+        else if (major == 4)
+        {
+            if ((formatFlags & 0x0c) != 0)
+                continue;
+            if ((formatFlags & 0x40) != 0 && frameDataSize > 1)
+            {
+                ++frame;
+                --frameDataSize;
+            }
+            if ((formatFlags & 0x01) != 0 && frameDataSize > 4)
+            {
+                frame += 4;
+                frameDataSize -= 4;
+            }
+            if ((formatFlags & 0x02) != 0)
+            {
+                frameUnsynced = removeUnsynchronisation(frame, frameDataSize);
+                frame = static_cast<const juce::uint8*>(frameUnsynced.getData());
+                frameDataSize = frameUnsynced.getSize();
+            }
+        }
+
+        *field = decodeID3Text(frame, frameDataSize);
+    }
+
+    setIfEmpty(tags.artist, albumArtist);
+}
+
+void TagReader::parseID3v1(const juce::uint8* data, size_t size, TrackTags& tags)
+{
+    if (size < 128)
+        return;
+
+    const juce::uint8* tag = data + size - 128;
+    if (!matches(tag, "TAG", 3))
+        return;
+
+    setIfEmpty(tags.title, decodeLatin1(tag + 3, 30).trim());
+    setIfEmpty(tags.artist, decodeLatin1(tag + 33, 30).trim());
+    setIfEmpty(tags.album, decodeLatin1(tag + 63, 30).trim());
+}
+
+void TagReader::parseFlac(const juce::uint8* data, size_t size, TrackTags& tags)
+{
+    size_t pos = 4;
+    while (pos + 4 <= size)
+    {
+        bool isLast = (data[pos] & 0x80) != 0;
+        int type = data[pos] & 0x7f;
+        size_t blockSize = readBE24(data + pos + 1);
+        pos += 4;
+        if (blockSize > size - pos)
+            return;
+
+        if (type == 4)
+        {
+            parseVorbisComment(data + pos, blockSize, tags);
+            return;
+        }
+
+        pos += blockSize;
+        if (isLast)
+            return;
+    }
+}
+
+void TagReader::parseOgg(const juce::uint8* data, size_t size, TrackTags& tags)
+{
+    const size_t maxPacketSize = 16 * 1024 * 1024;
+    juce::MemoryBlock packet;
+    juce::uint32 streamSerial = 0;
+    bool haveSerial = false;
+    int packetIndex = 0;
+    size_t pos = 0;
+
+    while (pos + 27 <= size && matches(data + pos, "OggS", 4))
+    {
+        int numSegments = data[pos + 26];
+        juce::uint32 serial = readLE32(data + pos + 14);
+        const juce::uint8* segmentTable = data + pos + 27;
+        size_t dataPos = pos + 27 + (size_t)numSegments;
+        if (dataPos > size)
+            return;
+
+        if (!haveSerial)
+        {
+            streamSerial = serial;
+            haveSerial = true;
+        }
+
+        for (int i = 0; i < numSegments; ++i)
+        {
+            size_t segmentSize = segmentTable[i];
+            if (dataPos + segmentSize > size)
+                return;
+
+            if (serial == streamSerial)
+            {
+                if (packetIndex == 1)
+                {
+                    packet.append(data + dataPos, segmentSize);
+                    if (packet.getSize() > maxPacketSize)
+                        return;
+                }
+
+                if (segmentSize < 255)
+                {
+                    if (packetIndex == 1)
+                    {
+                        auto* p = static_cast<const juce::uint8*>(packet.getData());
+                        size_t n = packet.getSize();
+                        if (n > 7 && p[0] == 0x03 && matches(p + 1, "vorbis", 6))
+                            parseVorbisComment(p + 7, n - 7, tags);
+                        else if (n > 8 && matches(p, "OpusTags", 8))
+                            parseVorbisComment(p + 8, n - 8, tags);
+                        else if (n > 4 && (p[0] & 0x7f) == 4)
+                            parseVorbisComment(p + 4, n - 4, tags);
+                        return;
+                    }
+                    ++packetIndex;
+                }
+            }
+            dataPos += segmentSize;
+        }
+        pos = dataPos;
+    }
+}
+
+void TagReader::parseVorbisComment(const juce::uint8* data, size_t size, TrackTags& tags)
+{
+    if (size < 8)
+        return;
+
+    size_t pos = 4 + (size_t)readLE32(data);
+    if (pos + 4 > size)
+        return;
+
+    juce::uint32 count = readLE32(data + pos);
+    pos += 4;
+    juce::String albumArtist;
+
+    for (juce::uint32 i = 0; i < count && pos + 4 <= size; ++i)
+    {
+        size_t length = readLE32(data + pos);
+        pos += 4;
+        if (length > size - pos)
+            return;
+
+        auto comment = juce::String::fromUTF8((const char*)data + pos, (int)length);
+        pos += length;
+
+        auto key = comment.upToFirstOccurrenceOf("=", false, false).toUpperCase();
+        auto value = comment.fromFirstOccurrenceOf("=", false, false);
+        if (key == "TITLE")
+            setIfEmpty(tags.title, value);
+        else if (key == "ARTIST")
+            setIfEmpty(tags.artist, value);
+        else if (key == "ALBUM")
+            setIfEmpty(tags.album, value);
+        else if (key == "ALBUMARTIST")
+            setIfEmpty(albumArtist, value);
+    }
+
+    setIfEmpty(tags.artist, albumArtist);
+}
+
+void TagReader::parseRiff(const juce::uint8* data, size_t size, TrackTags& tags)
+{
+    if (!matches(data + 8, "WAVE", 4))
+        return;
+
+    size_t pos = 12;
+    while (pos + 8 <= size)
+    {
+        const juce::uint8* chunk = data + pos;
+        size_t chunkSize = readLE32(chunk + 4);
+        size_t chunkData = pos + 8;
+        if (chunkSize > size - chunkData)
+            chunkSize = size - chunkData;
+
+        if (matches(chunk, "LIST", 4) && chunkSize >= 4 && matches(data + chunkData, "INFO", 4))
+        {
+            size_t sub = chunkData + 4;
+            size_t end = chunkData + chunkSize;
+            while (sub + 8 <= end)
+            {
+                const juce::uint8* info = data + sub;
+                size_t infoSize = juce::jmin((size_t)readLE32(info + 4), end - sub - 8);
+                auto value = decodeUTF8OrLatin1(info + 8, infoSize);
+
+                if (matches(info, "INAM", 4))
+                    setIfEmpty(tags.title, value);
+                else if (matches(info, "IART", 4))
+                    setIfEmpty(tags.artist, value);
+                else if (matches(info, "IPRD", 4))
+                    setIfEmpty(tags.album, value);
+
+                sub += 8 + infoSize + (infoSize & 1);
+            }
+        }
+        else if (matches(chunk, "id3 ", 4) || matches(chunk, "ID3 ", 4))
+        {
+            parseID3v2(data + chunkData, chunkSize, tags);
+        }
+
+        if (tags.isComplete())
+            return;
+        pos = chunkData + chunkSize + (chunkSize & 1);
+    }
+}
+
+void TagReader::parseAiff(const juce::uint8* data, size_t size, TrackTags& tags)
+{
+    if (!matches(data + 8, "AIFF", 4) && !matches(data + 8, "AIFC", 4))
+        return;
+
+    size_t pos = 12;
+    while (pos + 8 <= size)
+    {
+        const juce::uint8* chunk = data + pos;
+        size_t chunkSize = readBE32(chunk + 4);
+        size_t chunkData = pos + 8;
+        if (chunkSize > size - chunkData)
+            chunkSize = size - chunkData;
+
+        if (matches(chunk, "NAME", 4))
+            setIfEmpty(tags.title, decodeUTF8OrLatin1(data + chunkData, chunkSize));
+        else if (matches(chunk, "AUTH", 4))
+            setIfEmpty(tags.artist, decodeUTF8OrLatin1(data + chunkData, chunkSize));
+        else if (matches(chunk, "ID3 ", 4))
+            parseID3v2(data + chunkData, chunkSize, tags);
+
+        if (tags.isComplete())
+            return;
+        pos = chunkData + chunkSize + (chunkSize & 1);
+    }
+}
+
+juce::String TagReader::decodeID3Text(const juce::uint8* data, size_t size)
+{
+    if (size < 2)
+        return {};
+
+    const juce::uint8 encoding = data[0];
+    const juce::uint8* text = data + 1;
+    size_t length = size - 1;
+
+    switch (encoding)
+    {
+        case 1:
+            if (length >= 2 && text[0] == 0xfe && text[1] == 0xff)
+                return decodeUTF16(text + 2, length - 2, true);
+            if (length >= 2 && text[0] == 0xff && text[1] == 0xfe)
+                return decodeUTF16(text + 2, length - 2, false);
+            return decodeUTF16(text, length, false);
+        case 2:
+            return decodeUTF16(text, length, true);
+        case 3:
+            return decodeUTF8OrLatin1(text, length);
+        default:
+            return decodeLatin1(text, length);
+    }
+}
+
+juce::String TagReader::decodeLatin1(const juce::uint8* data, size_t size)
+{
+    juce::Array<juce::juce_wchar> chars;
+    for (size_t i = 0; i < size && data[i] != 0; ++i)
+        chars.add((juce::juce_wchar)data[i]);
+    return fromCodePoints(chars);
+}
+
+void TagReader::setIfEmpty(juce::String& field, const juce::String& value)
+{
+    if (field.isEmpty() && value.isNotEmpty())
+        field = value;
+}
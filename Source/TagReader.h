@@ -0,0 +1,32 @@
+#pragma once
+#include <JuceHeader.h>
+
+struct TrackTags
+{
+    juce::String title;
+    juce::String artist;
+    juce::String album;
+
+    bool isComplete() const { return title.isNotEmpty() && artist.isNotEmpty() && album.isNotEmpty(); }
+    bool isEmpty() const { return title.isEmpty() && artist.isEmpty() && album.isEmpty(); }
+};
+
+class TagReader
+{
+public:
+    static bool read(const juce::File& file, TrackTags& tags);
+
+private:
+    static void parseID3v2(const juce::uint8* data, size_t size, TrackTags& tags);
+    static void parseID3v1(const juce::uint8* data, size_t size, TrackTags& tags);
+    static void parseFlac(const juce::uint8* data, size_t size, TrackTags& tags);
+    static void parseOgg(const juce::uint8* data, size_t size, TrackTags& tags);
+    static void parseRiff(const juce::uint8* data, size_t size, TrackTags& tags);
+    static void parseAiff(const juce::uint8* data, size_t size, TrackTags& tags);
+    static void parseVorbisComment(const juce::uint8* data, size_t size, TrackTags& tags);
+
+    static size_t getID3v2Size(const juce::uint8* data, size_t size);
+    static juce::String decodeID3Text(const juce::uint8* data, size_t size);
+    static juce::String decodeLatin1(const juce::uint8* data, size_t size);
+    static void setIfEmpty(juce::String& field, const juce::String& value);
+};
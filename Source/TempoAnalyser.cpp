@@ -0,0 +1,372 @@
+#include "TempoAnalyser.h"
+#include "TrackCache.h"
+#include "MappedReader.h"
+#include <complex>
+#include <numeric>
+
+namespace
+{
+    const juce::int32 tempoFileMagic = 0x54505041;
+    const juce::int32 tempoFileVersion = 1;
+    const double analysisRate = 11025.0;
+    const int fftOrder = 9;
+    const int hopSize = 128;
+    const double maxAnalysisSeconds = 600.0;
+
+    // Radix-2 FFT of a Hann-windowed real frame, returning log-compressed
+    // magnitudes for bins 0..size/2.
+    class Spectrum
+    {
+    public:
+        explicit Spectrum(int order)
+            : size(1 << order), window((size_t)size), windowed((size_t)size), buffer((size_t)size),
+              twiddles((size_t)size / 2), reversed((size_t)size)
+        {
+            for (int i = 0; i < size; ++i)
+                window[(size_t)i] = 0.5f - 0.5f * std::cos(juce::MathConstants<float>::twoPi * (float)i / (float)size);
+
+            for (int i = 0; i < size / 2; ++i)
+                twiddles[(size_t)i] = std::polar(1.0f, -juce::MathConstants<float>::twoPi * (float)i / (float)size);
+
+            for (int i = 0; i < size; ++i)
+            {
+                int r = 0;
+                for (int bit = 0; bit < order; ++bit)
+                    if (i & (1 << bit))
+                        r |= 1 << (order - 1 - bit);
+                reversed[(size_t)i] = r;
+            }
+        }
+
+        int getSize() const { return size; }
+        int getNumBins() const { return size / 2 + 1; }
+
+        void process(const float* input, float* magnitudes)
+        {
+            juce::FloatVectorOperations::multiply(windowed.data(), input, window.data(), size);
+            for (int i = 0; i < size; ++i)
+                buffer[(size_t)reversed[(size_t)i]] = { windowed[(size_t)i], 0.0f };
+
+            for (int length = 2; length <= size; length <<= 1)
+            {
+                int half = length / 2;
+                int step = size / length;
+                for (int start = 0; start < size; start += length)
+                {
+                    for (int j = 0; j < half; ++j)
+                    {
+                        auto u = buffer[(size_t)(start + j)];
+                        auto v = buffer[(size_t)(start + j + half)] * twiddles[(size_t)(j * step)];
+                        buffer[(size_t)(start + j)] = u + v;
+                        buffer[(size_t)(start + j + half)] = u - v;
+                    }
+                }
+            }
+
+            for (int i = 0; i < getNumBins(); ++i)
+                magnitudes[i] = std::log1p(100.0f * std::abs(buffer[(size_t)i]));
+        }
+
+    private:
+        const int size;
+        std::vector<float> window, windowed;
+        std::vector<std::complex<float>> buffer, twiddles;
+        std::vector<int> reversed;
+    };
+}
+
+bool TempoEstimate::analyse(juce::AudioFormatReader& reader, const std::function<bool()>& shouldStop)
+{
+    double envelopeRate = 0.0;
+    auto envelope = computeOnsetEnvelope(reader, envelopeRate, shouldStop);
+    if (shouldStop())
+        return false;
+
+    estimateTempo(envelope, envelopeRate);
+    ready = true;
+    return true;
+}
+
+std::vector<float> TempoEstimate::computeOnsetEnvelope(juce::AudioFormatReader& reader, double& envelopeRate,
+                                                       const std::function<bool()>& shouldStop) const
+{
+    std::vector<float> envelope;
+    if (reader.sampleRate <= 0.0 || reader.lengthInSamples <= 0)
+        return envelope;
+
+    // A plain box filter is enough ahead of the decimation: the onsets that
+    // carry the beat are broadband.
+    int decimation = juce::jmax(1, juce::roundToInt(reader.sampleRate / analysisRate));
+    double rate = reader.sampleRate / decimation;
+    envelopeRate = rate / hopSize;
+
+    Spectrum spectrum(fftOrder);
+    std::vector<float> magnitudes((size_t)spectrum.getNumBins()), previous((size_t)spectrum.getNumBins());
+    std::vector<float> pending;
+    size_t frameStart = 0;
+    bool firstFrame = true;
+
+    const int chunkSize = 65536;
+    juce::AudioBuffer<float> chunk(juce::jmin(2, (int)reader.numChannels), chunkSize);
+    auto totalSamples = juce::jmin(reader.lengthInSamples, (juce::int64)(maxAnalysisSeconds * reader.sampleRate));
+    float sum = 0.0f;
+    int summed = 0;
+
+    for (juce::int64 position = 0; position < totalSamples; position += chunkSize)
+    {
+        if (shouldStop())
+            return {};
+
+        int numSamples = (int)juce::jmin((juce::int64)chunkSize, totalSamples - position);
+        if (!reader.read(&chunk, 0, numSamples, position, true, chunk.getNumChannels() > 1))
+            break;
+
+        if (chunk.getNumChannels() > 1)
+        {
+            juce::FloatVectorOperations::add(chunk.getWritePointer(0), chunk.getReadPointer(1), numSamples);
+            juce::FloatVectorOperations::multiply(chunk.getWritePointer(0), 0.5f, numSamples);
+        }
+
+        auto* mono = chunk.getReadPointer(0);
+        for (int i = 0; i < numSamples; ++i)
+        {
+            sum += mono[i];
+            if (++summed == decimation)
+            {
+                pending.push_back(sum / (float)decimation);
+                sum = 0.0f;
+                summed = 0;
+            }
+        }
+
+        while (frameStart + (size_t)spectrum.getSize() <= pending.size())
+        {
+            spectrum.process(pending.data() + frameStart, magnitudes.data());
+            if (!firstFrame)
+            {
+                // Spectral flux: the summed rise in each bin since the last frame.
+                juce::FloatVectorOperations::subtract(previous.data(), magnitudes.data(), previous.data(), (int)previous.size());
+                juce::FloatVectorOperations::max(previous.data(), previous.data(), 0.0f, (int)previous.size());
+                envelope.push_back(std::accumulate(previous.begin(), previous.end(), 0.0f));
+            }
+            firstFrame = false;
+            std::swap(previous, magnitudes);
+            frameStart += hopSize;
+        }
+
+        pending.erase(pending.begin(), pending.begin() + (std::ptrdiff_t)frameStart);
+        frameStart = 0;
+    }
+    return envelope;
+}
+
+void TempoEstimate::estimateTempo(const std::vector<float>& envelope, double envelopeRate)
+{
+    info = {};
+    int minLag = juce::jmax(1, (int)std::floor(60.0 * envelopeRate / maxBpm));
+    int maxLag = (int)std::ceil(60.0 * envelopeRate / minBpm);
+    int length = (int)envelope.size();
+    if (envelopeRate <= 0.0 || length < maxLag * 8)
+        return;
+
+    // Removing the local mean leaves the onsets standing out from the overall
+    // loudness of each passage.
+    int meanLength = juce::jmax(1, juce::roundToInt(0.4 * envelopeRate));
+    std::vector<float> onsets((size_t)length);
+    double running = 0.0;
+    for (int i = 0; i < length; ++i)
+    {
+        running += envelope[(size_t)i];
+        if (i >= meanLength)
+            running -= envelope[(size_t)(i - meanLength)];
+        float mean = (float)(running / juce::jmin(i + 1, meanLength));
+        onsets[(size_t)i] = juce::jmax(0.0f, envelope[(size_t)i] - mean);
+    }
+
+    // Lags run to four of the slowest beats so the period can be refined on
+    // the fourth peak below.
+    std::vector<double> correlation((size_t)maxLag * 4 + 4);
+    for (int lag = 0; lag < (int)correlation.size(); ++lag)
+    {
+        double total = 0.0;
+        for (int i = 0; i + lag < length; ++i)
+            total += (double)onsets[(size_t)i] * onsets[(size_t)(i + lag)];
+        correlation[(size_t)lag] = total / (length - lag);
+    }
+    if (correlation[0] <= 0.0)
+        return;
+
+    // Weighted towards 120 BPM so the pick favours the tactus over half or
+    // double time.
+    int bestLag = minLag;
+    double bestScore = -1.0;
+    double meanCorrelation = 0.0;
+    for (int lag = minLag; lag <= maxLag; ++lag)
+    {
+        double octaves = std::log2(60.0 * envelopeRate / lag / 120.0);
+        double score = correlation[(size_t)lag] * std::exp(-0.5 * octaves * octaves / (0.9 * 0.9));
+        meanCorrelation += correlation[(size_t)lag];
+        if (score > bestScore)
+        {
+            bestScore = score;
+            bestLag = lag;
+        }
+    }
+    meanCorrelation /= (maxLag - minLag + 1);
+
+    auto refinePeak = [&correlation](int lag)
+    {
+        double before = correlation[(size_t)lag - 1];
+        double at = correlation[(size_t)lag];
+        double after = correlation[(size_t)lag + 1];
+        double denominator = before - 2.0 * at + after;
+        return lag + (denominator < 0.0 ? juce::jlimit(-0.5, 0.5, 0.5 * (before - after) / denominator) : 0.0);
+    };
+
+    // One envelope frame is over 1% of a beat at fast tempos, so the period
+    // is measured again across two and then four beats.
+    double period = refinePeak(bestLag);
+    const int lastLag = (int)correlation.size() - 2;
+    for (int beats : { 2, 4 })
+    {
+        int first = juce::jlimit(1, lastLag, juce::roundToInt(period * beats) - beats / 2);
+        int last = juce::jlimit(1, lastLag, juce::roundToInt(period * beats) + beats / 2);
+        int peak = first;
+        for (int lag = first; lag <= last; ++lag)
+            if (correlation[(size_t)lag] > correlation[(size_t)peak])
+                peak = lag;
+        period = refinePeak(peak) / beats;
+    }
+
+    // The grid phase is the offset whose beats collect the most onset energy.
+    int bestPhase = 0;
+    double bestPhaseScore = -1.0;
+    for (int phase = 0; phase < (int)std::ceil(period); ++phase)
+    {
+        double total = 0.0;
+        for (double position = phase; position < length; position += period)
+            total += onsets[(size_t)juce::jmin(length - 1, juce::roundToInt(position))];
+        if (total > bestPhaseScore)
+        {
+            bestPhaseScore = total;
+            bestPhase = phase;
+        }
+    }
+
+    info.bpm = 60.0 * envelopeRate / period;
+    info.confidence = (float)juce::jlimit(0.0, 1.0, (correlation[(size_t)bestLag] - meanCorrelation) / correlation[0]);
+
+    // Each envelope value describes the frame one hop after its index, centred
+    // half an FFT later.
+    double frameOffset = (hopSize + 0.5 * (1 << fftOrder)) / (envelopeRate * hopSize);
+    info.firstBeat = bestPhase / envelopeRate + frameOffset;
+    info.firstBeat = std::fmod(info.firstBeat, info.getBeatLength());
+}
+
+bool TempoEstimate::writeTo(const juce::File& file) const
+{
+    if (!ready)
+        return false;
+
+    file.getParentDirectory().createDirectory();
+    juce::TemporaryFile temp(file);
+    {
+        juce::FileOutputStream out(temp.getFile());
+        if (!out.openedOk())
+            return false;
+
+        out.writeInt(tempoFileMagic);
+        out.writeInt(tempoFileVersion);
+        out.writeDouble(info.bpm);
+        out.writeDouble(info.firstBeat);
+        out.writeFloat(info.confidence);
+
+        out.flush();
+        if (out.getStatus().failed())
+            return false;
+    }
+    return temp.overwriteTargetFileWithTemporary();
+}
+
+bool TempoEstimate::readFrom(const juce::File& file)
+{
+    juce::FileInputStream in(file);
+    if (!in.openedOk())
+        return false;
+
+    if (in.getTotalLength() < 28 || in.readInt() != tempoFileMagic || in.readInt() != tempoFileVersion)
+        return false;
+
+    TempoInfo loaded;
+    loaded.bpm = in.readDouble();
+    loaded.firstBeat = in.readDouble();
+    loaded.confidence = in.readFloat();
+
+    info = loaded;
+    ready = true;
+    return true;
+}
+
+double TempoEstimate::getSyncSpeed(double leaderBpm, double followerBpm)
+{
+    if (leaderBpm <= 0.0 || followerBpm <= 0.0)
+        return 1.0;
+
+    double best = leaderBpm / followerBpm;
+    for (double factor : { 0.5, 2.0 })
+    {
+        double candidate = leaderBpm * factor / followerBpm;
+        if (std::abs(std::log(candidate)) < std::abs(std::log(best)))
+            best = candidate;
+    }
+    return best;
+}
+
+class TempoAnalyser::AnalyseJob : public juce::ThreadPoolJob
+{
+public:
+    AnalyseJob(std::shared_ptr<TempoEstimate> estimateToFill, const juce::File& fileToScan, juce::AudioFormatManager& formats)
+        : juce::ThreadPoolJob("Tempo Analysis"), estimate(std::move(estimateToFill)), file(fileToScan), formatManager(formats)
+    {
+    }
+
+    JobStatus runJob() override
+    {
+        auto cacheFile = TrackCache::getCacheFile(file, "tempo");
+        if (estimate->readFrom(cacheFile))
+            return jobHasFinished;
+
+        auto reader = MappedReader::create(formatManager, file);
+        if (reader == nullptr)
+            reader.reset(formatManager.createReaderFor(file));
+        if (reader == nullptr)
+            return jobHasFinished;
+
+        auto shouldStop = [this] { return shouldExit() || estimate.use_count() == 1; };
+        if (estimate->analyse(*reader, shouldStop))
+            estimate->writeTo(cacheFile);
+
+        return jobHasFinished;
+    }
+
+private:
+    std::shared_ptr<TempoEstimate> estimate;
+    juce::File file;
+    juce::AudioFormatManager& formatManager;
+};
+
+TempoAnalyser::TempoAnalyser()
+{
+}
+
+TempoAnalyser::~TempoAnalyser()
+{
+    workers.removeAllJobs(true, 5000);
+}
+
+std::shared_ptr<TempoEstimate> TempoAnalyser::getTempo(const juce::File& file, juce::AudioFormatManager& formats)
+{
+    auto estimate = std::make_shared<TempoEstimate>();
+    workers.addJob(new AnalyseJob(estimate, file, formats), true);
+    return estimate;
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <JuceHeader.h>
+
+struct TempoInfo
+{
+    double bpm = 0.0;
+    double firstBeat = 0.0;
+    float confidence = 0.0f;
+
+    bool isValid() const { return bpm > 0.0; }
+    double getBeatLength() const { return isValid() ? 60.0 / bpm : 0.0; }
+};
+
+// Tempo and beat grid of one file, filled in by a TempoAnalyser job. The GUI
+// polls isReady() and then reads getInfo().
+class TempoEstimate
+{
+public:
+    static constexpr double minBpm = 60.0;
+    static constexpr double maxBpm = 200.0;
+
+    bool analyse(juce::AudioFormatReader& reader, const std::function<bool()>& shouldStop);
+    bool writeTo(const juce::File& file) const;
+    bool readFrom(const juce::File& file);
+
+    bool isReady() const { return ready.load(); }
+    TempoInfo getInfo() const { return ready.load() ? info : TempoInfo(); }
+
+    // Speed for a deck at followerBpm to match a leader playing leaderBpm
+    // (already multiplied by its speed). Half and double time are allowed,
+    // whichever is closest to the follower's natural speed.
+    static double getSyncSpeed(double leaderBpm, double followerBpm);
+
+private:
+    std::vector<float> computeOnsetEnvelope(juce::AudioFormatReader& reader, double& envelopeRate,
+                                            const std::function<bool()>& shouldStop) const;
+    void estimateTempo(const std::vector<float>& envelope, double envelopeRate);
+
+    TempoInfo info;
+    std::atomic<bool> ready { false };
+};
+
+class TempoAnalyser
+{
+public:
+    TempoAnalyser();
+    ~TempoAnalyser();
+
+    std::shared_ptr<TempoEstimate> getTempo(const juce::File& file, juce::AudioFormatManager& formats);
+
+private:
+    class AnalyseJob;
+
+    juce::ThreadPool workers{1};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TempoAnalyser)
+};
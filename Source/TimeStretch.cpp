@@ -0,0 +1,254 @@
+#include "TimeStretch.h"
+
+#if JUCE_USE_SSE_INTRINSICS
+ #include <emmintrin.h>
+#elif JUCE_USE_ARM_NEON
+ #include <arm_neon.h>
+#endif
+
+namespace
+{
+    constexpr int readChunk = 512;
+
+    float dotProduct(const float* a, const float* b, int num)
+    {
+        float sum = 0.0f;
+        int i = 0;
+       #if JUCE_USE_SSE_INTRINSICS
+        __m128 acc0 = _mm_setzero_ps();
+        __m128 acc1 = _mm_setzero_ps();
+        for (; i + 8 <= num; i += 8)
+        {
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+        }
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, _mm_add_ps(acc0, acc1));
+        sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+       #elif JUCE_USE_ARM_NEON
+        float32x4_t acc0 = vdupq_n_f32(0.0f);
+        float32x4_t acc1 = vdupq_n_f32(0.0f);
+        for (; i + 8 <= num; i += 8)
+        {
+            acc0 = vmlaq_f32(acc0, vld1q_f32(a + i), vld1q_f32(b + i));
+            acc1 = vmlaq_f32(acc1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+        }
+        float32x4_t acc = vaddq_f32(acc0, acc1);
+        sum = vgetq_lane_f32(acc, 0) + vgetq_lane_f32(acc, 1) + vgetq_lane_f32(acc, 2) + vgetq_lane_f32(acc, 3);
+       #endif
+        for (; i < num; ++i)
+            sum += a[i] * b[i];
+        return sum;
+    }
+}
+
+TimeStretchSource::TimeStretchSource(juce::AudioSource* source, int numChannels)
+    : input(source), channels(juce::jmax(1, numChannels))
+{
+}
+
+TimeStretchSource::Settings TimeStretchSource::getSettings(Quality q) const
+{
+    auto samples = [this](double ms) { return juce::roundToInt(preparedSampleRate * ms / 1000.0); };
+
+    Settings s;
+    switch (q)
+    {
+        case Quality::fast:   s = { samples(20.0), samples(4.0), 4 }; break;
+        case Quality::normal: s = { samples(30.0), samples(8.0), 2 }; break;
+        case Quality::high:   s = { samples(40.0), samples(12.0), 1 }; break;
+        case Quality::off:    break;
+    }
+    s.frameSize &= ~1;
+    return s;
+}
+
+void TimeStretchSource::prepareToPlay(int samplesPerBlockExpected, double sampleRate)
+{
+    preparedSampleRate = sampleRate;
+    input->prepareToPlay(samplesPerBlockExpected, sampleRate);
+
+    // Size everything for the most expensive setting so a quality change on the
+    // audio thread never allocates.
+    auto largest = getSettings(Quality::high);
+    window.assign((size_t)largest.frameSize, 0.0f);
+    inputBuffer.setSize(channels, largest.frameSize * 3 + largest.searchRadius * 2 + readChunk * 2);
+    readBuffer.setSize(channels, readChunk);
+    outputBuffer.setSize(channels, largest.frameSize * 2);
+    settings = getSettings(quality);
+    clearState();
+}
+
+void TimeStretchSource::releaseResources()
+{
+    input->releaseResources();
+}
+
+void TimeStretchSource::setQuality(Quality newQuality)
+{
+    if (newQuality == quality)
+        return;
+
+    quality = newQuality;
+    settings = getSettings(quality);
+    resetPending = true;
+}
+
+void TimeStretchSource::clearState()
+{
+    resetPending = false;
+    inputStart = 0;
+    inputCount = 0;
+    analysisPosition = 0.0;
+    previousFrame = -1;
+    outputReady = 0;
+    outputBuffer.clear();
+
+    // Periodic Hann window: overlapping at half a frame sums to exactly one.
+    int size = settings.frameSize;
+    for (int i = 0; i < size; ++i)
+        window[(size_t)i] = 0.5f - 0.5f * std::cos(juce::MathConstants<float>::twoPi * (float)i / (float)size);
+}
+
+void TimeStretchSource::getNextAudioBlock(const juce::AudioSourceChannelInfo& bufferToFill)
+{
+    if (quality == Quality::off || settings.frameSize <= 0 || window.empty())
+    {
+        input->getNextAudioBlock(bufferToFill);
+        return;
+    }
+
+    if (resetPending.load())
+        clearState();
+
+    auto& buffer = *bufferToFill.buffer;
+    int numChannels = juce::jmin(channels, buffer.getNumChannels());
+    int done = 0;
+    while (done < bufferToFill.numSamples)
+    {
+        if (outputReady == 0)
+            produceFrame();
+
+        int numSamples = juce::jmin(outputReady, bufferToFill.numSamples - done);
+        int pending = settings.frameSize - settings.frameSize / 2;
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto* data = outputBuffer.getWritePointer(ch);
+            buffer.copyFrom(ch, bufferToFill.startSample + done, data, numSamples);
+            std::memmove(data, data + numSamples, sizeof(float) * (size_t)(outputReady - numSamples + pending));
+            juce::FloatVectorOperations::clear(data + outputReady - numSamples + pending, numSamples);
+        }
+        for (int ch = numChannels; ch < buffer.getNumChannels(); ++ch)
+            buffer.copyFrom(ch, bufferToFill.startSample + done, buffer, 0, bufferToFill.startSample + done, numSamples);
+
+        outputReady -= numSamples;
+        done += numSamples;
+    }
+}
+
+void TimeStretchSource::produceFrame()
+{
+    int frameSize = settings.frameSize;
+    int hop = frameSize / 2;
+    auto ideal = (juce::int64)std::llround(analysisPosition);
+    auto chosen = ideal;
+
+    if (previousFrame >= 0)
+    {
+        auto templateStart = previousFrame + hop;
+        auto low = juce::jmax(inputStart, ideal - settings.searchRadius);
+        auto high = ideal + settings.searchRadius;
+        ensureInput(juce::jmax(high, templateStart) + frameSize);
+        chosen = findBestOffset(templateStart, low, high, frameSize - hop, settings.searchStep);
+    }
+    else
+    {
+        ensureInput(ideal + frameSize);
+    }
+
+    int offset = (int)(chosen - inputStart);
+    for (int ch = 0; ch < channels; ++ch)
+        juce::FloatVectorOperations::addWithMultiply(outputBuffer.getWritePointer(ch, outputReady),
+                                                     inputBuffer.getReadPointer(ch, offset), window.data(), frameSize);
+
+    previousFrame = chosen;
+    outputReady += hop;
+    analysisPosition += hop * tempo;
+    discardInputBefore(juce::jmin(previousFrame + hop, (juce::int64)analysisPosition - settings.searchRadius));
+}
+
+juce::int64 TimeStretchSource::findBestOffset(juce::int64 templateStart, juce::int64 low, juce::int64 high, int length, int step) const
+{
+    auto best = juce::jlimit(low, high, templateStart);
+    float bestScore = getSimilarity(best, templateStart, length);
+
+    auto search = [&](juce::int64 from, juce::int64 to, int stride)
+    {
+        for (auto candidate = from; candidate <= to; candidate += stride)
+        {
+            float score = getSimilarity(candidate, templateStart, length);
+            if (score > bestScore)
+            {
+                bestScore = score;
+                best = candidate;
+            }
+        }
+    };
+
+    search(low, high, step);
+    if (step > 1)
+    {
+        auto centre = best;
+        search(juce::jmax(low, centre - step + 1), juce::jmin(high, centre + step - 1), 1);
+    }
+    return best;
+}
+
+float TimeStretchSource::getSimilarity(juce::int64 candidate, juce::int64 templateStart, int length) const
+{
+    int candidateOffset = (int)(candidate - inputStart);
+    int templateOffset = (int)(templateStart - inputStart);
+    float correlation = 0.0f;
+    float energy = 1.0e-9f;
+    for (int ch = 0; ch < channels; ++ch)
+    {
+        auto* c = inputBuffer.getReadPointer(ch, candidateOffset);
+        correlation += dotProduct(c, inputBuffer.getReadPointer(ch, templateOffset), length);
+        energy += dotProduct(c, c, length);
+    }
+    return correlation / std::sqrt(energy);
+}
+
+bool TimeStretchSource::ensureInput(juce::int64 endPosition)
+{
+    while (inputStart + inputCount < endPosition)
+    {
+        int numSamples = juce::jmin(readChunk, inputBuffer.getNumSamples() - inputCount);
+        if (numSamples <= 0)
+        {
+            jassertfalse;
+            return false;
+        }
+
+        input->getNextAudioBlock(juce::AudioSourceChannelInfo(&readBuffer, 0, numSamples));
+        for (int ch = 0; ch < channels; ++ch)
+            inputBuffer.copyFrom(ch, inputCount, readBuffer, juce::jmin(ch, readBuffer.getNumChannels() - 1), 0, numSamples);
+        inputCount += numSamples;
+    }
+    return true;
+}
+
+void TimeStretchSource::discardInputBefore(juce::int64 position)
+{
+    int numToDiscard = (int)juce::jlimit((juce::int64)0, (juce::int64)inputCount, position - inputStart);
+    if (numToDiscard == 0)
+        return;
+
+    for (int ch = 0; ch < channels; ++ch)
+    {
+        auto* data = inputBuffer.getWritePointer(ch);
+        std::memmove(data, data + numToDiscard, sizeof(float) * (size_t)(inputCount - numToDiscard));
+    }
+    inputStart += numToDiscard;
+    inputCount -= numToDiscard;
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include <JuceHeader.h>
+
+// Changes tempo without changing pitch using WSOLA: Hann-windowed frames at a
+// fixed output hop are taken from the input at hop * tempo, each one nudged
+// within a search radius to the offset that best continues the previous frame.
+// Runs at the source sample rate in front of the deck's resampler; with the
+// quality set to off it passes audio straight through.
+class TimeStretchSource : public juce::AudioSource
+{
+public:
+    enum class Quality
+    {
+        off,
+        fast,
+        normal,
+        high
+    };
+
+    TimeStretchSource(juce::AudioSource* source, int numChannels = 2);
+
+    void prepareToPlay(int samplesPerBlockExpected, double sampleRate) override;
+    void releaseResources() override;
+    void getNextAudioBlock(const juce::AudioSourceChannelInfo& bufferToFill) override;
+
+    void setTempo(double newTempo) { tempo = juce::jlimit(0.25, 4.0, newTempo); }
+    void setQuality(Quality newQuality);
+    Quality getQuality() const { return quality; }
+    bool isActive() const { return quality != Quality::off; }
+    void reset() { resetPending = true; }
+
+private:
+    struct Settings
+    {
+        int frameSize = 0;
+        int searchRadius = 0;
+        int searchStep = 1;
+    };
+
+    Settings getSettings(Quality q) const;
+    void clearState();
+    void produceFrame();
+    bool ensureInput(juce::int64 endPosition);
+    void discardInputBefore(juce::int64 position);
+    juce::int64 findBestOffset(juce::int64 templateStart, juce::int64 low, juce::int64 high, int length, int step) const;
+    float getSimilarity(juce::int64 candidate, juce::int64 templateStart, int length) const;
+
+    juce::AudioSource* input;
+    int channels;
+    double preparedSampleRate = 0.0;
+    Quality quality = Quality::off;
+    Settings settings;
+    double tempo = 1.0;
+    std::atomic<bool> resetPending { true };
+
+    std::vector<float> window;
+    juce::AudioBuffer<float> inputBuffer;
+    juce::AudioBuffer<float> readBuffer;
+    juce::int64 inputStart = 0;
+    int inputCount = 0;
+    double analysisPosition = 0.0;
+    juce::int64 previousFrame = -1;
+
+    juce::AudioBuffer<float> outputBuffer;
+    int outputReady = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TimeStretchSource)
+};
@@ -0,0 +1,49 @@
+#include "TrackCache.h"
+
+juce::File TrackCache::getAppDataDirectory()
+{
+    return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory).getChildFile("AudioPlayer");
+}
+
+juce::File TrackCache::getCacheDirectory()
+{
+    return getAppDataDirectory().getChildFile("cache");
+}
+
+juce::String TrackCache::getKey(const juce::File& file)
+{
+    juce::String identity = file.getFullPathName()
+        + "|" + juce::String(file.getSize())
+        + "|" + juce::String(file.getLastModificationTime().toMilliseconds());
+    return juce::String::toHexString(identity.hashCode64());
+}
+
+juce::File TrackCache::getCacheFile(const juce::File& file, const juce::String& extension)
+{
+    return getCacheDirectory().getChildFile(getKey(file) + "." + extension);
+}
+
+void TrackCache::trim(juce::int64 maxBytes)
+{
+    auto files = getCacheDirectory().findChildFiles(juce::File::findFiles, false);
+
+    juce::int64 totalBytes = 0;
+    for (auto& file : files)
+        totalBytes += file.getSize();
+    if (totalBytes <= maxBytes)
+        return;
+
+    std::sort(files.begin(), files.end(), [](const juce::File& a, const juce::File& b)
+    {
+        return a.getLastAccessTime() < b.getLastAccessTime();
+    });
+
+    for (auto& file : files)
+    {
+        if (totalBytes <= maxBytes)
+            break;
+        auto size = file.getSize();
+        if (file.deleteFile())
+            totalBytes -= size;
+    }
+}
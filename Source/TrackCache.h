@@ -0,0 +1,15 @@
+#pragma once
+#include <JuceHeader.h>
+
+class TrackCache
+{
+public:
+    static juce::File getAppDataDirectory();
+    static juce::File getCacheDirectory();
+    static juce::String getKey(const juce::File& file);
+    static juce::File getCacheFile(const juce::File& file, const juce::String& extension);
+
+    // Deletes the least recently used cache files until the directory holds
+    // no more than maxBytes.
+    static void trim(juce::int64 maxBytes);
+};
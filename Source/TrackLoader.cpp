@@ -0,0 +1,129 @@
+#include "TrackLoader.h"
+#include "TagReader.h"
+#include "MappedReader.h"
+
+TrackLoader::TrackLoader(juce::AudioFormatManager& formats, ReadAheadPool& pool, SampleCache& cache)
+    : formatManager(formats), readAheadPool(pool), sampleCache(cache)
+{
+}
+
+TrackLoader::~TrackLoader()
+{
+    cancelPendingUpdate();
+    workers.removeAllJobs(true, 5000);
+    const juce::ScopedLock sl(resultLock);
+    results.clear();
+}
+
+std::unique_ptr<PreparedTrack> TrackLoader::prepare(const LoadRequest& request, juce::int64 requestTicks)
+{
+    // Uncompressed files are read from a memory map; everything else decodes
+    // through the normal buffered stream reader.
+    auto mapped = MappedReader::create(formatManager, request.file, request.readAheadSeconds * 2.0);
+    bool memoryMapped = mapped != nullptr;
+    auto* reader = memoryMapped ? mapped.release() : formatManager.createReaderFor(request.file);
+    if (reader == nullptr)
+        return nullptr;
+
+    // In memory mode short files are decoded once up front; longer ones still
+    // stream but can have their A-B region decoded later.
+    bool decodedInMemory = false;
+    if (request.decodeToMemory)
+    {
+        ClipPtr clip;
+        if (reader->lengthInSamples <= (juce::int64)(request.maxMemorySeconds * reader->sampleRate))
+            clip = sampleCache.getOrDecode(request.file, *reader, 0, reader->lengthInSamples);
+
+        auto* cached = new CachedReader(std::unique_ptr<juce::AudioFormatReader>(reader));
+        decodedInMemory = clip != nullptr;
+        cached->setClip(std::move(clip));
+        reader = cached;
+    }
+
+    auto track = std::make_unique<PreparedTrack>();
+    track->file = request.file;
+    track->reader = reader;
+    track->requestTicks = requestTicks;
+    track->formatName = reader->getFormatName();
+    track->memoryMapped = memoryMapped;
+    track->decodedInMemory = decodedInMemory;
+    track->sampleRate = reader->sampleRate;
+
+    TrackTags tags;
+    TagReader::read(request.file, tags);
+    track->title = tags.title.isNotEmpty() ? tags.title : reader->metadataValues.getValue("title", request.file.getFileNameWithoutExtension());
+    track->artist = tags.artist.isNotEmpty() ? tags.artist : reader->metadataValues.getValue("artist", "Unknown Artist");
+    track->album = tags.album.isNotEmpty() ? tags.album : reader->metadataValues.getValue("album", "");
+    track->duration = reader->sampleRate > 0.0 ? (double)reader->lengthInSamples / reader->sampleRate : 0.0;
+
+    track->readerSource = std::make_unique<juce::AudioFormatReaderSource>(reader, true);
+    track->readAheadSource = readAheadPool.createSource(track->readerSource.get(), (int)reader->numChannels,
+                                                        reader->sampleRate, request.readAheadSeconds);
+    track->readAheadSource->setLooping(request.looping);
+    track->readAheadSource->setBlockingReads(request.blockingReads);
+
+    if (request.blockSize > 0 && request.outputSampleRate > 0.0)
+    {
+        double ratio = reader->sampleRate / request.outputSampleRate;
+        track->readAheadSource->prepareToPlay(juce::roundToInt(request.blockSize * ratio), request.outputSampleRate * ratio);
+    }
+
+    if (request.useFfprobeFallback && track->artist == "Unknown Artist")
+        probeTags(request.file, track->artist, track->title);
+
+    track->openMs = juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - requestTicks) * 1000.0;
+    return track;
+}
+
+void TrackLoader::prepareAsync(const LoadRequest& request, Callback onReady)
+{
+    auto requestTicks = juce::Time::getHighResolutionTicks();
+    workers.addJob([this, request, requestTicks, onReady]
+    {
+        auto track = prepare(request, requestTicks);
+        {
+            const juce::ScopedLock sl(resultLock);
+            results.push_back({ std::move(track), onReady });
+        }
+        triggerAsyncUpdate();
+    });
+}
+
+void TrackLoader::handleAsyncUpdate()
+{
+    std::vector<Result> ready;
+    {
+        const juce::ScopedLock sl(resultLock);
+        ready.swap(results);
+    }
+
+    for (auto& result : ready)
+        if (result.callback)
+            result.callback(std::move(result.track));
+}
+
+void TrackLoader::probeTags(const juce::File& file, juce::String& artist, juce::String& title)
+{
+    juce::ChildProcess ffprobe;
+    juce::StringArray args;
+    args.add("ffprobe");
+    args.add("-v");
+    args.add("error");
+    args.add("-show_entries");
+    args.add("format_tags=artist,title");
+    args.add("-of");
+    args.add("default=nw=1:nk=1");
+    args.add(file.getFullPathName());
+
+    if (ffprobe.start(args))
+    {
+        juce::String out = ffprobe.readAllProcessOutput().trim();
+        juce::StringArray lines;
+        lines.addLines(out);
+        if (lines.size() >= 2)
+        {
+            artist = lines[0];
+            title = lines[1];
+        }
+    }
+}
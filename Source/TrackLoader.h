@@ -0,0 +1,67 @@
+#pragma once
+#include <JuceHeader.h>
+#include "ReadAhead.h"
+#include "SampleCache.h"
+
+struct PreparedTrack
+{
+    juce::File file;
+    juce::AudioFormatReader* reader = nullptr;
+    std::unique_ptr<juce::AudioFormatReaderSource> readerSource;
+    std::unique_ptr<ReadAheadSource> readAheadSource;
+    juce::String title;
+    juce::String artist;
+    juce::String album;
+    juce::String formatName;
+    bool memoryMapped = false;
+    bool decodedInMemory = false;
+    double duration = 0.0;
+    double sampleRate = 0.0;
+    float trackGain = 1.0f;
+    juce::int64 requestTicks = 0;
+    double openMs = 0.0;
+};
+
+struct LoadRequest
+{
+    juce::File file;
+    double readAheadSeconds = 2.0;
+    bool looping = false;
+    bool useFfprobeFallback = false;
+    bool blockingReads = false;
+    bool decodeToMemory = false;
+    double maxMemorySeconds = 120.0;
+    int blockSize = 0;
+    double outputSampleRate = 0.0;
+};
+
+class TrackLoader : private juce::AsyncUpdater
+{
+public:
+    using Callback = std::function<void(std::unique_ptr<PreparedTrack>)>;
+
+    TrackLoader(juce::AudioFormatManager& formats, ReadAheadPool& pool, SampleCache& cache);
+    ~TrackLoader() override;
+
+    std::unique_ptr<PreparedTrack> prepare(const LoadRequest& request, juce::int64 requestTicks);
+    void prepareAsync(const LoadRequest& request, Callback onReady);
+
+private:
+    struct Result
+    {
+        std::unique_ptr<PreparedTrack> track;
+        Callback callback;
+    };
+
+    void handleAsyncUpdate() override;
+    static void probeTags(const juce::File& file, juce::String& artist, juce::String& title);
+
+    juce::AudioFormatManager& formatManager;
+    ReadAheadPool& readAheadPool;
+    SampleCache& sampleCache;
+    juce::ThreadPool workers{2};
+    juce::CriticalSection resultLock;
+    std::vector<Result> results;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TrackLoader)
+};